@@ -254,6 +254,8 @@ FLINT_DLL slong fmpz_mat_fflu(fmpz_mat_t B, fmpz_t den, slong * perm,
 FLINT_DLL slong fmpz_mat_rref(fmpz_mat_t B, fmpz_t den, const fmpz_mat_t A);
 FLINT_DLL slong fmpz_mat_rref_fflu(fmpz_mat_t B, fmpz_t den, const fmpz_mat_t A);
 FLINT_DLL slong fmpz_mat_rref_mul(fmpz_mat_t B, fmpz_t den, const fmpz_mat_t A);
+FLINT_DLL slong fmpz_mat_rref_multi_mod(fmpz_mat_t B, fmpz_t den,
+                                                        const fmpz_mat_t A);
 FLINT_DLL int fmpz_mat_is_in_rref_with_rank(const fmpz_mat_t A, const fmpz_t den,
         slong rank);
 
@@ -308,6 +310,14 @@ FLINT_DLL void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op);
 
 FLINT_DLL void fmpz_mat_charpoly_modular(fmpz_poly_t cp, const fmpz_mat_t mat);
 
+FLINT_DLL void _fmpz_mat_charpoly_small(fmpz * rop, const fmpz_mat_t op);
+
+FLINT_DLL void _fmpz_mat_charpoly_multi_mod(fmpz * rop,
+                                            const fmpz_mat_t op, int proved);
+
+FLINT_DLL void fmpz_mat_charpoly_multi_mod(fmpz_poly_t cp,
+                                            const fmpz_mat_t mat, int proved);
+
 FMPZ_MAT_INLINE
 void _fmpz_mat_charpoly(fmpz * cp, const fmpz_mat_t mat)
 {
@@ -423,6 +433,9 @@ FLINT_DLL void fmpz_mat_snf_diagonal(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_kannan_bachem(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A,
         const fmpz_t mod);
+FLINT_DLL void fmpz_mat_snf_modular(fmpz_mat_t S, const fmpz_mat_t A);
+FLINT_DLL void fmpz_mat_snf_largest_invariant(fmpz_t s, const fmpz_mat_t A,
+        flint_rand_t state);
 FLINT_DLL int fmpz_mat_is_in_snf(const fmpz_mat_t A);
 
 /* Special matrices **********************************************************/
@@ -0,0 +1,241 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <pthread.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+#define CHARPOLY_M_LOG2E  1.44269504088896340736  /* log2(e) */
+
+static __inline__ long double _log2(const long double x)
+{
+    return log(x) * CHARPOLY_M_LOG2E;
+}
+
+typedef struct
+{
+    const fmpz_mat_struct * mat;
+    mp_ptr * residues;
+    mp_srcptr primes;
+    slong p0;
+    slong p1;
+}
+charpoly_mod_arg_t;
+
+static void
+_fmpz_mat_charpoly_mod(charpoly_mod_arg_t * arg)
+{
+    slong i, n = arg->mat->r;
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        nmod_mat_t A;
+        nmod_poly_t poly;
+
+        nmod_mat_init(A, n, n, arg->primes[i]);
+        nmod_poly_init(poly, arg->primes[i]);
+
+        fmpz_mat_get_nmod_mat(A, arg->mat);
+        nmod_mat_charpoly(poly, A);
+        _nmod_vec_set(arg->residues[i], poly->coeffs, n + 1);
+
+        nmod_mat_clear(A);
+        nmod_poly_clear(poly);
+    }
+}
+
+static void *
+_fmpz_mat_charpoly_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_charpoly_mod((charpoly_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* sets residues[i] to the characteristic polynomial of mat mod primes[i] */
+static void
+_fmpz_mat_charpoly_mod_threaded(mp_ptr * residues, const fmpz_mat_t mat,
+                                            mp_srcptr primes, slong num_primes)
+{
+    pthread_t * threads;
+    charpoly_mod_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(charpoly_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].mat = mat;
+        args[i].residues = residues;
+        args[i].primes = primes;
+        args[i].p0 = (num_primes * i) / num_threads;
+        args[i].p1 = (num_primes * (i + 1)) / num_threads;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+            _fmpz_mat_charpoly_mod_worker, &args[i]);
+
+    _fmpz_mat_charpoly_mod(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void _fmpz_mat_charpoly_multi_mod(fmpz * rop, const fmpz_mat_t op, int proved)
+{
+    const slong n = op->r;
+    slong bound, num_primes, alloc, i, j;
+    mp_ptr primes, * residues;
+
+    if (n < 4)
+    {
+        _fmpz_mat_charpoly_small(rop, op);
+        return;
+    }
+
+    /*
+        If $A$ is an $n \times n$ matrix with $n \geq 4$ and coefficients
+        bounded in absolute value by $B > 1$ then the coefficients of the
+        characteristic polynomial have less than
+        $\ceil{n/2 (\log_2(n) + \log_2(B^2) + 1.6669)}$ bits.
+        See Lemma 4.1 in Dumas, Pernet, and Wan, "Efficient computation
+        of the characteristic polynomial", 2008.
+    */
+    {
+        fmpz * ptr;
+        double t;
+
+        ptr = fmpz_mat_entry(op, 0, 0);
+        for (i = 0; i < n; i++)
+            for (j = 0; j < n; j++)
+                if (fmpz_cmpabs(ptr, fmpz_mat_entry(op, i, j)) < 0)
+                    ptr = fmpz_mat_entry(op, i, j);
+
+        if (fmpz_bits(ptr) == 0)  /* Zero matrix */
+        {
+            _fmpz_vec_zero(rop, n);
+            fmpz_one(rop + n);
+            return;
+        }
+
+        t = (fmpz_bits(ptr) <= FLINT_D_BITS) ?
+            _log2(FLINT_ABS(fmpz_get_d(ptr))) : fmpz_bits(ptr);
+
+        bound = ceil((n / 2.0) * (_log2(n) + 2.0 * t + 1.6669));
+    }
+
+    /* primes exceed 2^(FLINT_BITS - 1); one extra bit for the sign */
+    num_primes = (bound + 1 + (FLINT_BITS - 1) - 1) / (FLINT_BITS - 1);
+
+    /* without proof, primes are taken in batches of one per thread */
+    alloc = proved ? num_primes :
+                FLINT_MIN(num_primes, flint_get_num_threads());
+
+    primes = flint_malloc(sizeof(mp_limb_t) * alloc);
+    residues = flint_malloc(sizeof(mp_ptr) * alloc);
+    for (i = 0; i < alloc; i++)
+        residues[i] = _nmod_vec_init(n + 1);
+
+    primes[0] = n_nextprime(UWORD(1) << (FLINT_BITS - 1), 0);
+    for (i = 1; i < alloc; i++)
+        primes[i] = n_nextprime(primes[i - 1], 0);
+
+    if (proved)
+    {
+        _fmpz_mat_charpoly_mod_threaded(residues, op, primes, num_primes);
+        _fmpz_vec_multi_mod_ui_threaded(residues, rop, n + 1,
+                                                primes, num_primes, 1);
+    }
+    else
+    {
+        fmpz_t m, stable_m;
+        fmpz * xnew;
+        slong num;
+
+        fmpz_init_set_ui(m, 1);
+        fmpz_init(stable_m);
+        xnew = _fmpz_vec_init(n + 1);
+        _fmpz_vec_zero(rop, n + 1);
+
+        /*
+            Stop once the result has not changed over primes whose product
+            exceeds 2^100, as in fmpz_mat_det_modular_given_divisor, or
+            when the bound is reached.
+        */
+        for (num = 0; num < num_primes; )
+        {
+            slong batch = FLINT_MIN(alloc, num_primes - num);
+
+            if (num != 0)
+            {
+                primes[0] = n_nextprime(primes[alloc - 1], 0);
+                for (i = 1; i < batch; i++)
+                    primes[i] = n_nextprime(primes[i - 1], 0);
+            }
+
+            _fmpz_mat_charpoly_mod_threaded(residues, op, primes, batch);
+
+            for (i = 0; i < batch; i++)
+            {
+                nmod_t mod;
+
+                nmod_init(&mod, primes[i]);
+                _fmpz_poly_CRT_ui(xnew, rop, n + 1, m, residues[i], n + 1,
+                                                        mod.n, mod.ninv, 1);
+                fmpz_mul_ui(m, m, primes[i]);
+
+                if (_fmpz_vec_equal(xnew, rop, n + 1))
+                    fmpz_mul_ui(stable_m, stable_m, primes[i]);
+                else
+                {
+                    fmpz_set_ui(stable_m, primes[i]);
+                    _fmpz_vec_swap(rop, xnew, n + 1);
+                }
+            }
+
+            num += batch;
+
+            if (fmpz_bits(stable_m) > 100)
+                break;
+        }
+
+        _fmpz_vec_clear(xnew, n + 1);
+        fmpz_clear(m);
+        fmpz_clear(stable_m);
+    }
+
+    for (i = 0; i < alloc; i++)
+        _nmod_vec_clear(residues[i]);
+    flint_free(residues);
+    flint_free(primes);
+}
+
+void fmpz_mat_charpoly_multi_mod(fmpz_poly_t cp,
+                                            const fmpz_mat_t mat, int proved)
+{
+    fmpz_poly_fit_length(cp, mat->r + 1);
+    _fmpz_poly_set_length(cp, mat->r + 1);
+
+    _fmpz_mat_charpoly_multi_mod(cp->coeffs, mat, proved);
+}
@@ -11,6 +11,7 @@
 */
 
 #include <math.h>
+#include <pthread.h>
 
 #include "flint.h"
 #include "fmpz.h"
@@ -108,6 +109,40 @@ void _fmpz_mat_bound_ovals_of_cassini(fmpz_t b, const fmpz_mat_t op)
    fmpz_clear(q);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * op;
+    nmod_poly_t poly;
+    ulong * P;
+}
+minpoly_mod_arg_t;
+
+static void
+_fmpz_mat_minpoly_mod(minpoly_mod_arg_t * arg)
+{
+    nmod_mat_t mat;
+    slong i, n = arg->op->r;
+
+    nmod_mat_init(mat, n, n, arg->poly->mod.n);
+
+    for (i = 0; i < n; i++)
+       arg->P[i] = 0;
+
+    fmpz_mat_get_nmod_mat(mat, arg->op);
+    nmod_mat_minpoly_with_gens(arg->poly, mat, arg->P);
+
+    nmod_mat_clear(mat);
+}
+
+static void *
+_fmpz_mat_minpoly_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_minpoly_mod((minpoly_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
 slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -135,6 +170,10 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
         slong pbits  = FLINT_BITS - 1, i, j;
         mp_limb_t p = (UWORD(1) << pbits);
         ulong * P, * Q;
+        slong k, num_threads;
+        pthread_t * threads;
+        minpoly_mod_arg_t * args;
+        int done = 0;
 
         fmpz_mat_t v1, v2, v3;
         fmpz * rold;
@@ -170,7 +209,6 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
             fmpz_clear(b);
         }
 
-        P = (ulong *) flint_calloc(n, sizeof(ulong));
         Q = (ulong *) flint_calloc(n, sizeof(ulong));
         rold = (fmpz *) _fmpz_vec_init(n + 1);
         fmpz_mat_init(v1, n, 1);
@@ -182,113 +220,131 @@ slong _fmpz_mat_minpoly_modular(fmpz * rop, const fmpz_mat_t op)
         oldlen = 0;
         len = 0;
 
-        for ( ; fmpz_bits(m) <= bound; )
-        {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
-            
-            p = n_nextprime(p, 0);
-
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
-
-            for (i = 0; i < n; i++)
-               P[i] = 0;
+        num_threads = flint_get_num_threads();
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(minpoly_mod_arg_t) * num_threads);
 
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_minpoly_with_gens(poly, mat, P);
-
-            len = poly->length;
-
-            if (oldlen != 0 && len > oldlen)
-            {
-               /* all previous primes were bad, discard */
-                           
-               fmpz_one(m);
-               oldlen = len;
-
-               for (i = 0; i < n + 1; i++)
-                  fmpz_zero(rop + i);
+        for (k = 0; k < num_threads; k++)
+        {
+            args[k].op = op;
+            args[k].P = (ulong *) flint_malloc(n * sizeof(ulong));
+        }
 
-               for (i = 0; i < n; i++)
-                  Q[i] = 0;
-            } else if (len < oldlen)
+        /*
+            The minimal polynomials modulo a batch of primes, one per thread,
+            are computed in parallel and then processed in order.
+        */
+        while (!done && fmpz_bits(m) <= bound)
+        {
+            for (k = 0; k < num_threads; k++)
             {
-               /* this prime was bad, skip */
-
-               nmod_mat_clear(mat);
-               nmod_poly_clear(poly);
-            
-               continue;   
+                p = n_nextprime(p, 0);
+                nmod_poly_init(args[k].poly, p);
             }
 
-            for (i = 0; i < n; i++)
-               Q[i] |= P[i];
-
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs, 
-                              poly->length, poly->mod.n, poly->mod.ninv, 1);
-
-            fmpz_mul_ui(m, m, p);
+            for (k = 0; k < num_threads - 1; k++)
+                pthread_create(&threads[k], NULL,
+                    _fmpz_mat_minpoly_mod_worker, &args[k]);
 
-            /* check if stabilised */
-            for (i = 0; i < len; i++)
-            {
-               if (!fmpz_equal(rop + i, rold + i))
-                  break;
-            }
+            _fmpz_mat_minpoly_mod(&args[num_threads - 1]);
 
-            for (j = 0; j < len; j++)
-               fmpz_set(rold + j, rop + j);
+            for (k = 0; k < num_threads - 1; k++)
+                pthread_join(threads[k], NULL);
 
-            if (i == len) /* stabilised */
+            for (k = 0; k < num_threads && !done
+                                        && fmpz_bits(m) <= bound; k++)
             {
-               for (i = 0; i < n; i++)
-               {
-                  if (Q[i] == 1)
-                  {
-                     fmpz_mat_zero(v1);
-                     fmpz_mat_zero(v3);
-
-                     fmpz_set_ui(fmpz_mat_entry(v1, i, 0), 1);
-
-                     for (j = 0; j < len; j++)
-                     {
-                        fmpz_mat_scalar_mul_fmpz(v2, v1, rop + j);
-                        fmpz_mat_add(v3, v3, v2);
-
-                        if (j != len - 1)
-                        {
-                           fmpz_mat_mul(v2, op, v1);
-                           fmpz_mat_swap(v1, v2);
-                        }
-                     }
-                  
-                     /* check f(A)v = 0 */
-                     for (j = 0; j < n; j++)
-                     {
-                        if (!fmpz_is_zero(v3->rows[j] + 0))
+                nmod_poly_struct * poly = args[k].poly;
+
+                P = args[k].P;
+                len = poly->length;
+
+                if (oldlen != 0 && len > oldlen)
+                {
+                   /* all previous primes were bad, discard */
+
+                   fmpz_one(m);
+                   oldlen = len;
+
+                   for (i = 0; i < n + 1; i++)
+                      fmpz_zero(rop + i);
+
+                   for (i = 0; i < n; i++)
+                      Q[i] = 0;
+                } else if (len < oldlen)
+                {
+                   /* this prime was bad, skip */
+                   continue;
+                }
+
+                for (i = 0; i < n; i++)
+                   Q[i] |= P[i];
+
+                _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs,
+                                  poly->length, poly->mod.n, poly->mod.ninv, 1);
+
+                fmpz_mul_ui(m, m, poly->mod.n);
+
+                /* check if stabilised */
+                for (i = 0; i < len; i++)
+                {
+                   if (!fmpz_equal(rop + i, rold + i))
+                      break;
+                }
+
+                for (j = 0; j < len; j++)
+                   fmpz_set(rold + j, rop + j);
+
+                if (i == len) /* stabilised */
+                {
+                   for (i = 0; i < n; i++)
+                   {
+                      if (Q[i] == 1)
+                      {
+                         fmpz_mat_zero(v1);
+                         fmpz_mat_zero(v3);
+
+                         fmpz_set_ui(fmpz_mat_entry(v1, i, 0), 1);
+
+                         for (j = 0; j < len; j++)
+                         {
+                            fmpz_mat_scalar_mul_fmpz(v2, v1, rop + j);
+                            fmpz_mat_add(v3, v3, v2);
+
+                            if (j != len - 1)
+                            {
+                               fmpz_mat_mul(v2, op, v1);
+                               fmpz_mat_swap(v1, v2);
+                            }
+                         }
+
+                         /* check f(A)v = 0 */
+                         for (j = 0; j < n; j++)
+                         {
+                            if (!fmpz_is_zero(v3->rows[j] + 0))
+                                break;
+                         }
+
+                         if (j != n)
                             break;
-                     }
-
-                     if (j != n)
-                        break;
-                  }
-               }
-
-               /* if f(A)v = 0 for all generators v, we are done */
-               if (i == n)
-               {
-                  nmod_mat_clear(mat);
-                  nmod_poly_clear(poly);
-                  break;
-               }
+                      }
+                   }
+
+                   /* if f(A)v = 0 for all generators v, we are done */
+                   if (i == n)
+                      done = 1;
+                }
             }
 
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
+            for (k = 0; k < num_threads; k++)
+                nmod_poly_clear(args[k].poly);
         }
 
-        flint_free(P);
+        for (k = 0; k < num_threads; k++)
+            flint_free(args[k].P);
+
+        flint_free(threads);
+        flint_free(args);
         flint_free(Q);
         fmpz_mat_clear(v2);
         fmpz_mat_clear(v1);
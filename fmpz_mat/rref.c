@@ -17,6 +17,8 @@ fmpz_mat_rref(fmpz_mat_t R, fmpz_t den, const fmpz_mat_t A)
 {
     if (FLINT_MIN(A->c, A->r) <= 20)
         return fmpz_mat_rref_fflu(R, den, A);
+    else if (flint_get_num_threads() > 1 || A->c >= 4 * A->r)
+        return fmpz_mat_rref_multi_mod(R, den, A);
     else if (A->r <= 105 && A->c >= 1.4 * A->r)
         return fmpz_mat_rref_fflu(R, den, A);
     else
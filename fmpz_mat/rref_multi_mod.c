@@ -0,0 +1,370 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "fmpz_mat.h"
+#include "fmpq.h"
+#include "fmpz_vec.h"
+#include "perm.h"
+
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    nmod_mat_struct * Amod;
+    slong * pivs;
+    slong * P;
+    slong rank;
+}
+rref_mod_arg_t;
+
+static void
+_fmpz_mat_rref_mod(rref_mod_arg_t * arg)
+{
+    fmpz_mat_get_nmod_mat(arg->Amod, arg->A);
+    arg->rank = _nmod_mat_rref(arg->Amod, arg->pivs, arg->P);
+}
+
+static void *
+_fmpz_mat_rref_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_rref_mod((rref_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Returns 1 if the pivot pattern (rank1, pivs1) is better than
+    (rank2, pivs2), -1 if it is worse and 0 if they agree. The pattern of A
+    over Q has maximal rank and the lexicographically smallest pivots of all
+    its reductions modulo primes.
+*/
+static int
+_pivots_cmp(slong rank1, const slong * pivs1, slong rank2, const slong * pivs2)
+{
+    slong i;
+
+    if (rank1 != rank2)
+        return rank1 > rank2 ? 1 : -1;
+
+    for (i = 0; i < rank1; i++)
+        if (pivs1[i] != pivs2[i])
+            return pivs1[i] < pivs2[i] ? 1 : -1;
+
+    return 0;
+}
+
+/*
+    Given the candidate numerators N of the non-pivot columns and the
+    denominator den, writes the candidate rref into R and checks that every
+    row of A lies in its row space, i.e. that A_P N = den A_Q where A_P and
+    A_Q are the pivot and non-pivot columns of A. Since the rank over Q is
+    at least the rank modulo p, this proves that R is the rref of A.
+*/
+static int
+_fmpz_mat_rref_multi_mod_certify(fmpz_mat_t R, const fmpz_mat_t A,
+    const fmpz_mat_t N, const fmpz_t den, const slong * pivs, slong rank)
+{
+    fmpz_mat_t AP, AN;
+    slong i, j, m, n;
+    int result;
+
+    m = A->r;
+    n = A->c;
+
+    fmpz_mat_zero(R);
+    for (i = 0; i < rank; i++)
+    {
+        fmpz_set(fmpz_mat_entry(R, i, pivs[i]), den);
+        for (j = 0; j < n - rank; j++)
+            fmpz_set(fmpz_mat_entry(R, i, pivs[rank + j]),
+                     fmpz_mat_entry(N, i, j));
+    }
+
+    if (!fmpz_mat_is_in_rref_with_rank(R, den, rank))
+        return 0;
+
+    fmpz_mat_init(AP, m, rank);
+    fmpz_mat_init(AN, m, n - rank);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < rank; j++)
+            fmpz_set(fmpz_mat_entry(AP, i, j), fmpz_mat_entry(A, i, pivs[j]));
+
+    fmpz_mat_mul(AN, AP, N);
+
+    result = 1;
+    for (i = 0; i < m && result; i++)
+    {
+        for (j = 0; j < n - rank && result; j++)
+        {
+            fmpz_submul(fmpz_mat_entry(AN, i, j), den,
+                        fmpz_mat_entry(A, i, pivs[rank + j]));
+            result = fmpz_is_zero(fmpz_mat_entry(AN, i, j));
+        }
+    }
+
+    fmpz_mat_clear(AP);
+    fmpz_mat_clear(AN);
+
+    return result;
+}
+
+/* sets t to the symmetric remainder of d x modulo M */
+static void
+_fmpz_mul_smod(fmpz_t t, const fmpz_t d, const fmpz_t x,
+                                    const fmpz_t M, const fmpz_t halfM)
+{
+    fmpz_mul(t, d, x);
+    fmpz_fdiv_r(t, t, M);
+    if (fmpz_cmp(t, halfM) > 0)
+        fmpz_sub(t, t, M);
+}
+
+/*
+    Reconstructs a common denominator d for the entries of X modulo M,
+    using the fact that d x mod M is the numerator of x once d is correct,
+    so that at most a few entries need actual rational reconstruction.
+    Returns 0 if the modulus is too small.
+*/
+static int
+_fmpz_vec_reconstruct_den(fmpz_t d, const fmpz * X, slong len,
+                                    const fmpz_t M, const fmpz_t halfM)
+{
+    fmpz_t t, u, num, den;
+    slong i;
+    int success = 1;
+
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(num);
+    fmpz_init(den);
+
+    for (i = 0; i < len && success; i++)
+    {
+        _fmpz_mul_smod(t, d, X + i, M, halfM);
+
+        /* the numerator and denominator must fit in half the modulus */
+        if (2 * (fmpz_bits(t) + fmpz_bits(d)) + 2 <= fmpz_bits(M))
+            continue;
+
+        fmpz_mod(u, t, M);
+        success = _fmpq_reconstruct_fmpz(num, den, u, M);
+
+        if (success)
+            fmpz_mul(d, d, den);
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(num);
+    fmpz_clear(den);
+
+    return success;
+}
+
+slong
+fmpz_mat_rref_multi_mod(fmpz_mat_t R, fmpz_t den, const fmpz_mat_t A)
+{
+    pthread_t * threads;
+    rref_mod_arg_t * args;
+    nmod_mat_t * res;
+    fmpz_mat_t X, N, T;
+    fmpz * probe;
+    fmpz_t M, halfM;
+    mp_limb_t p;
+    slong i, j, k, m, n, rank, num_threads, num, alloc, next, * pivs;
+    int cmp, done, success;
+
+    m = fmpz_mat_nrows(A);
+    n = fmpz_mat_ncols(A);
+
+    if (m == 0 || n == 0)
+    {
+        fmpz_one(den);
+        return 0;
+    }
+
+    num_threads = flint_get_num_threads();
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(rref_mod_arg_t) * num_threads);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        args[k].A = A;
+        args[k].Amod = NULL;
+        args[k].pivs = flint_malloc(sizeof(slong) * n);
+        args[k].P = _perm_init(m);
+    }
+
+    /* non-pivot parts of the rref modulo the good primes */
+    alloc = num_threads;
+    res = flint_malloc(sizeof(nmod_mat_t) * alloc);
+    num = 0;
+
+    pivs = flint_malloc(sizeof(slong) * n);
+    probe = _fmpz_vec_init(m);
+    rank = -1;
+    next = 1;
+    done = 0;
+
+    fmpz_init(M);
+    fmpz_init(halfM);
+    fmpz_mat_init(T, m, n);
+
+    p = UWORD(1) << (FLINT_BITS - 1);
+
+    while (!done)
+    {
+        /* reduce A modulo a batch of primes, one per thread */
+        for (k = 0; k < num_threads; k++)
+        {
+            p = n_nextprime(p, 0);
+            args[k].Amod = flint_malloc(sizeof(nmod_mat_struct));
+            nmod_mat_init(args[k].Amod, m, n, p);
+        }
+
+        for (k = 0; k < num_threads - 1; k++)
+            pthread_create(&threads[k], NULL,
+                _fmpz_mat_rref_mod_worker, &args[k]);
+
+        _fmpz_mat_rref_mod(&args[num_threads - 1]);
+
+        for (k = 0; k < num_threads - 1; k++)
+            pthread_join(threads[k], NULL);
+
+        for (k = 0; k < num_threads && !done; k++)
+        {
+            cmp = (rank == -1) ? 1 :
+                _pivots_cmp(args[k].rank, args[k].pivs, rank, pivs);
+
+            if (cmp < 0)
+                continue;
+
+            if (cmp > 0)
+            {
+                /* all previous primes were bad */
+                rank = args[k].rank;
+                for (i = 0; i < n; i++)
+                    pivs[i] = args[k].pivs[i];
+
+                if (rank == n)
+                {
+                    /* full column rank is certified by a single prime */
+                    fmpz_mat_zero(R);
+                    for (i = 0; i < n; i++)
+                        fmpz_one(fmpz_mat_entry(R, i, i));
+                    fmpz_one(den);
+                    done = 1;
+                    break;
+                }
+
+                for (i = 0; i < num; i++)
+                    nmod_mat_clear(res[i]);
+                num = 0;
+                next = 1;
+                _fmpz_vec_zero(probe, rank);
+                fmpz_one(M);
+            }
+
+            if (num == alloc)
+            {
+                alloc *= 2;
+                res = flint_realloc(res, sizeof(nmod_mat_t) * alloc);
+            }
+
+            nmod_mat_init(res[num], rank, n - rank, args[k].Amod->mod.n);
+            for (i = 0; i < rank; i++)
+                for (j = 0; j < n - rank; j++)
+                    nmod_mat_entry(res[num], i, j) =
+                        nmod_mat_entry(args[k].Amod, i, pivs[rank + j]);
+
+            /* keep the last non-pivot column lifted for cheap probing */
+            for (i = 0; i < rank; i++)
+                fmpz_CRT_ui(probe + i, probe + i, M,
+                    nmod_mat_entry(res[num], i, n - rank - 1),
+                    args[k].Amod->mod.n, 1);
+
+            fmpz_mul_ui(M, M, args[k].Amod->mod.n);
+            num++;
+        }
+
+        for (k = 0; k < num_threads; k++)
+        {
+            nmod_mat_clear(args[k].Amod);
+            flint_free(args[k].Amod);
+        }
+
+        if (done || num < next)
+            continue;
+
+        /*
+            Once the probe column reconstructs, lift everything and try to
+            prove the result; if that fails, wait until the number of primes
+            has doubled before trying again.
+        */
+        fmpz_fdiv_q_2exp(halfM, M, 1);
+        fmpz_one(den);
+
+        if (!_fmpz_vec_reconstruct_den(den, probe, rank, M, halfM))
+            continue;
+
+        fmpz_mat_init(X, rank, n - rank);
+        fmpz_mat_multi_CRT_ui(X, res, num, 1);
+
+        success = 1;
+        for (i = 0; i < rank && success; i++)
+            success = _fmpz_vec_reconstruct_den(den, X->rows[i],
+                                                    n - rank, M, halfM);
+
+        if (success)
+        {
+            fmpz_mat_init(N, rank, n - rank);
+
+            for (i = 0; i < rank; i++)
+                for (j = 0; j < n - rank; j++)
+                    _fmpz_mul_smod(fmpz_mat_entry(N, i, j), den,
+                        fmpz_mat_entry(X, i, j), M, halfM);
+
+            done = _fmpz_mat_rref_multi_mod_certify(T, A, N, den, pivs, rank);
+
+            fmpz_mat_clear(N);
+        }
+
+        fmpz_mat_clear(X);
+
+        if (done)
+            fmpz_mat_swap(R, T);
+        else
+            next = 2 * num;
+    }
+
+    for (k = 0; k < num_threads; k++)
+    {
+        flint_free(args[k].pivs);
+        _perm_clear(args[k].P);
+    }
+
+    for (i = 0; i < num; i++)
+        nmod_mat_clear(res[i]);
+
+    flint_free(res);
+    flint_free(threads);
+    flint_free(args);
+    flint_free(pivs);
+    _fmpz_vec_clear(probe, m);
+    fmpz_mat_clear(T);
+    fmpz_clear(M);
+    fmpz_clear(halfM);
+
+    return rank;
+}
@@ -14,7 +14,6 @@
 void
 fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A)
 {
-    fmpz_t det;
     slong m = A->r, n = A->c, b = fmpz_mat_max_bits(A), cutoff = 9;
 
     if (b <= 2)
@@ -33,18 +32,5 @@ fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A)
     if (FLINT_MAX(m, n) < cutoff || m != n)
         fmpz_mat_snf_kannan_bachem(S, A);
     else
-    {
-        fmpz_init(det);
-        fmpz_mat_det(det, A);
-        if (!fmpz_is_zero(det))
-        {
-            fmpz_abs(det, det);
-            fmpz_mat_snf_iliopoulos(S, A, det);
-        }
-        else
-        {
-            fmpz_mat_snf_kannan_bachem(S, A);
-        }
-        fmpz_clear(det);
-    }
+        fmpz_mat_snf_modular(S, A);
 }
@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+#include "fmpq.h"
+
+/* number of random right hand sides */
+#define SNF_LARGEST_NUM_RHS 8
+
+void
+fmpz_mat_snf_largest_invariant(fmpz_t s, const fmpz_mat_t A,
+                                                        flint_rand_t state)
+{
+    fmpz_mat_t X, B;
+    fmpz_t t, u, v, mod;
+    slong i, j, n;
+
+    n = A->r;
+
+    if (n != A->c)
+    {
+        flint_printf("Exception (fmpz_mat_snf_largest_invariant). "
+                     "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (n == 0)
+    {
+        fmpz_one(s);
+        return;
+    }
+
+    fmpz_mat_init(B, n, SNF_LARGEST_NUM_RHS);
+    fmpz_mat_init(X, n, SNF_LARGEST_NUM_RHS);
+    fmpz_init(t);
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(mod);
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < SNF_LARGEST_NUM_RHS; j++)
+            fmpz_set_si(fmpz_mat_entry(B, i, j),
+                        (slong) n_randint(state, 513) - 256);
+
+    if (fmpz_mat_solve_dixon(X, mod, A, B))
+    {
+        /* the lcm of the denominators of A^{-1} B divides s_n */
+        fmpz_one(s);
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < SNF_LARGEST_NUM_RHS; j++)
+            {
+                fmpz_mul(t, s, fmpz_mat_entry(X, i, j));
+                fmpz_fdiv_qr(u, t, t, mod);
+                if (!_fmpq_reconstruct_fmpz(u, v, t, mod))
+                {
+                    flint_printf("Exception (fmpz_mat_snf_largest_invariant). "
+                           "Rational reconstruction failed.\n");
+                    flint_abort();
+                }
+
+                fmpz_mul(s, s, v);
+            }
+        }
+    }
+    else
+    {
+        fmpz_zero(s);
+    }
+
+    fmpz_mat_clear(B);
+    fmpz_mat_clear(X);
+    fmpz_clear(t);
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(mod);
+}
@@ -0,0 +1,315 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+#include "fmpz_vec.h"
+
+/* number of small primes tried against det(A)/d before resorting to gcds */
+#define SNF_MODULAR_TRIAL_PRIMES 3000
+
+/*
+    Computes the exponents of p in the elementary divisors of A, given that
+    p^e exactly divides det(A) and q = p^e fits in a limb. Since Z/qZ is a
+    local ring, an entry of minimal valuation divides every other entry, so
+    no gcds are needed and the elimination is done with word-size arithmetic.
+    The exponents are returned in exps in nondecreasing order.
+*/
+static void
+_fmpz_mat_snf_local_ui(slong * exps, const fmpz_mat_t A, ulong p, slong e)
+{
+    nmod_mat_t M;
+    nmod_t mod;
+    mp_limb_t q, x, u, f;
+    slong n, i, j, k, r, c, v, w;
+
+    n = A->r;
+    q = n_pow(p, e);
+
+    nmod_mat_init(M, n, n, q);
+    fmpz_mat_get_nmod_mat(M, A);
+    mod = M->mod;
+
+    for (k = 0; k < n; k++)
+    {
+        /* find an entry of minimal valuation, stopping at the first unit */
+        r = c = -1;
+        v = e;
+
+        for (i = k; i < n && v != 0; i++)
+        {
+            for (j = k; j < n; j++)
+            {
+                x = nmod_mat_entry(M, i, j);
+
+                if (x == 0)
+                    continue;
+
+                for (w = 0; w < v && x % p == 0; w++)
+                    x /= p;
+
+                if (w < v)
+                {
+                    v = w;
+                    r = i;
+                    c = j;
+
+                    if (v == 0)
+                        break;
+                }
+            }
+        }
+
+        if (r == -1)
+        {
+            for ( ; k < n; k++)
+                exps[k] = e;
+            break;
+        }
+
+        exps[k] = v;
+
+        if (r != k)
+        {
+            mp_ptr t = M->rows[r];
+            M->rows[r] = M->rows[k];
+            M->rows[k] = t;
+        }
+
+        if (c != k)
+        {
+            for (i = k; i < n; i++)
+            {
+                x = nmod_mat_entry(M, i, c);
+                nmod_mat_entry(M, i, c) = nmod_mat_entry(M, i, k);
+                nmod_mat_entry(M, i, k) = x;
+            }
+        }
+
+        /* pivot = p^v u with u a unit */
+        u = nmod_mat_entry(M, k, k);
+        for (w = 0; w < v; w++)
+            u /= p;
+        u = n_invmod(u % q, q);
+
+        for (i = k + 1; i < n; i++)
+        {
+            x = nmod_mat_entry(M, i, k);
+
+            if (x == 0)
+                continue;
+
+            for (w = 0; w < v; w++)
+                x /= p;
+
+            f = nmod_neg(nmod_mul(x, u, mod), mod);
+            _nmod_vec_scalar_addmul_nmod(M->rows[i] + k + 1,
+                                    M->rows[k] + k + 1, n - k - 1, f, mod);
+        }
+
+        /*
+            After the row operations column k is zero below the pivot, so the
+            column operations clearing row k touch nothing else.
+        */
+    }
+
+    nmod_mat_clear(M);
+}
+
+static void
+_fmpz_mat_snf_add_prime(fmpz * s, fmpz_t R, const fmpz_mat_t A,
+                                                ulong p, const fmpz_t D)
+{
+    fmpz_t P, pe;
+    slong i, e, n = A->r;
+
+    fmpz_init_set_ui(P, p);
+    fmpz_init(pe);
+
+    e = fmpz_remove(pe, D, P);
+    fmpz_pow_ui(pe, P, e);
+
+    if (e == 0)
+        ;
+    else if (fmpz_abs_fits_ui(pe))
+    {
+        slong * exps = flint_malloc(sizeof(slong) * n);
+
+        _fmpz_mat_snf_local_ui(exps, A, p, e);
+
+        for (i = 0; i < n; i++)
+        {
+            if (exps[i] != 0)
+            {
+                fmpz_set_ui(pe, p);
+                fmpz_pow_ui(pe, pe, exps[i]);
+                fmpz_mul(s + i, s + i, pe);
+            }
+        }
+
+        flint_free(exps);
+    }
+    else
+    {
+        fmpz_mul(R, R, pe);
+    }
+
+    fmpz_clear(P);
+    fmpz_clear(pe);
+}
+
+/*
+    Multiplies s by the elementary divisors of A modulo R, where R is made
+    up of full prime power parts of det(A). The lattice spanned by A and
+    R Z^n is put into Hermite form modulo R, the unit pivots are split off
+    and the remaining block is handled by Iliopoulos' algorithm modulo R.
+*/
+static void
+_fmpz_mat_snf_mod_part(fmpz * s, const fmpz_mat_t A, const fmpz_t R)
+{
+    fmpz_mat_t H, B;
+    slong * piv;
+    slong i, j, k, n = A->r;
+
+    fmpz_mat_init_set(H, A);
+    fmpz_mat_hnf_modular_eldiv(H, R);
+
+    piv = flint_malloc(sizeof(slong) * n);
+    for (i = k = 0; i < n; i++)
+        if (!fmpz_is_one(fmpz_mat_entry(H, i, i)))
+            piv[k++] = i;
+
+    fmpz_mat_init(B, k, k);
+    for (i = 0; i < k; i++)
+        for (j = 0; j < k; j++)
+            fmpz_set(fmpz_mat_entry(B, i, j),
+                     fmpz_mat_entry(H, piv[i], piv[j]));
+
+    fmpz_mat_snf_iliopoulos(B, B, R);
+
+    for (i = 0; i < k; i++)
+        fmpz_mul(s + n - k + i, s + n - k + i, fmpz_mat_entry(B, i, i));
+
+    fmpz_mat_clear(B);
+    fmpz_mat_clear(H);
+    flint_free(piv);
+}
+
+void
+fmpz_mat_snf_modular(fmpz_mat_t S, const fmpz_mat_t A)
+{
+    fmpz_t d, D, Q, R, g, t;
+    fmpz * s;
+    slong i, n = A->r;
+
+    if (n != A->c)
+    {
+        flint_printf("Exception (fmpz_mat_snf_modular). Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (n == 0)
+        return;
+
+    fmpz_init(d);
+    fmpz_mat_det_divisor(d, A);
+
+    if (fmpz_is_zero(d))
+    {
+        fmpz_clear(d);
+        fmpz_mat_snf_kannan_bachem(S, A);
+        return;
+    }
+
+    fmpz_init(D);
+    fmpz_init(Q);
+    fmpz_init(R);
+    fmpz_init(g);
+    fmpz_init(t);
+    s = _fmpz_vec_init(n);
+
+    fmpz_abs(d, d);
+    fmpz_mat_det_modular_given_divisor(D, A, d, 1);
+    fmpz_abs(D, D);
+
+    for (i = 0; i < n; i++)
+        fmpz_one(s + i);
+    fmpz_one(R);
+
+    /*
+        d divides the largest elementary divisor, so any prime p not dividing
+        Q = D/d occurs only in the last elementary divisor. Only the primes
+        of Q need any work, and Q is small for most matrices.
+    */
+    fmpz_divexact(Q, D, d);
+
+    if (!fmpz_is_one(Q) && !fmpz_abs_fits_ui(Q))
+    {
+        const mp_limb_t * primes;
+
+        primes = n_primes_arr_readonly(SNF_MODULAR_TRIAL_PRIMES);
+
+        for (i = 0; i < SNF_MODULAR_TRIAL_PRIMES && !fmpz_abs_fits_ui(Q); i++)
+        {
+            if (fmpz_fdiv_ui(Q, primes[i]) == 0)
+            {
+                fmpz_set_ui(t, primes[i]);
+                fmpz_remove(Q, Q, t);
+                _fmpz_mat_snf_add_prime(s, R, A, primes[i], D);
+            }
+        }
+    }
+
+    if (fmpz_abs_fits_ui(Q))
+    {
+        n_factor_t fac;
+
+        n_factor_init(&fac);
+        n_factor(&fac, fmpz_get_ui(Q), 1);
+
+        for (i = 0; i < fac.num; i++)
+            _fmpz_mat_snf_add_prime(s, R, A, fac.p[i], D);
+    }
+    else
+    {
+        /* unfactored cofactor: take its full support in D */
+        fmpz_set(t, D);
+        fmpz_gcd(g, t, Q);
+
+        while (!fmpz_is_one(g))
+        {
+            fmpz_divexact(t, t, g);
+            fmpz_mul(R, R, g);
+            fmpz_gcd(g, t, g);
+        }
+    }
+
+    if (!fmpz_is_one(R))
+        _fmpz_mat_snf_mod_part(s, A, R);
+
+    /* everything not yet accounted for belongs to the last divisor */
+    fmpz_one(t);
+    for (i = 0; i < n; i++)
+        fmpz_mul(t, t, s + i);
+    fmpz_divexact(t, D, t);
+    fmpz_mul(s + n - 1, s + n - 1, t);
+
+    fmpz_mat_zero(S);
+    for (i = 0; i < n; i++)
+        fmpz_swap(fmpz_mat_entry(S, i, i), s + i);
+
+    _fmpz_vec_clear(s, n);
+    fmpz_clear(d);
+    fmpz_clear(D);
+    fmpz_clear(Q);
+    fmpz_clear(R);
+    fmpz_clear(g);
+    fmpz_clear(t);
+}
@@ -0,0 +1,74 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong n, rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("charpoly_multi_mod....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 500 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A;
+        fmpz_poly_t f, g, h;
+        slong bits;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        n = n_randint(state, 15);
+        bits = 1 + n_randint(state, 100);
+
+        fmpz_mat_init(A, n, n);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+
+        if (n_randint(state, 2))
+            fmpz_mat_randtest(A, state, bits);
+        else
+            fmpz_mat_randrank(A, state, n_randint(state, n + 1), bits);
+
+        fmpz_mat_charpoly_berkowitz(f, A);
+        fmpz_mat_charpoly_multi_mod(g, A, 1);
+        fmpz_mat_charpoly_multi_mod(h, A, 0);
+
+        if (!fmpz_poly_equal(f, g) || !fmpz_poly_equal(f, h))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("berkowitz = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("proved = "), fmpz_poly_print_pretty(g, "X"), flint_printf("\n");
+            flint_printf("unproved = "), fmpz_poly_print_pretty(h, "X"), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
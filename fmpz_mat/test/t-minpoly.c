@@ -33,6 +33,8 @@ main(void)
         fmpz_mat_t A;
         fmpz_poly_t f, g, q, r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         m = n_randint(state, 4);
         n = m;
 
@@ -89,6 +91,8 @@ main(void)
         fmpz_mat_t A, B;
         fmpz_poly_t f, g;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         m = n_randint(state, 4);
         n = m;
 
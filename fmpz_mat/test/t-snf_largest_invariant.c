@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong iter, misses = 0;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("snf_largest_invariant....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 2000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S;
+        fmpz_t s;
+        slong n, b, d, r;
+
+        n = n_randint(state, 12);
+        r = n_randint(state, 4) == 0 ? n_randint(state, n + 1) : n;
+
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(S, n, n);
+        fmpz_init(s);
+
+        b = 1 + n_randint(state, 10) * n_randint(state, 10);
+        d = n_randint(state, 2*n*n + 1);
+        fmpz_mat_randrank(A, state, r, b);
+
+        if (n_randint(state, 2))
+            fmpz_mat_randops(A, state, d);
+
+        fmpz_mat_snf_largest_invariant(s, A, state);
+        fmpz_mat_snf_kannan_bachem(S, A);
+
+        if (n == 0)
+        {
+            if (!fmpz_is_one(s))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("empty matrix!\n");
+                abort();
+            }
+        }
+        else if (fmpz_is_zero(fmpz_mat_entry(S, n - 1, n - 1)))
+        {
+            if (!fmpz_is_zero(s))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("expected zero for a singular matrix!\n");
+                fmpz_mat_print_pretty(A); flint_printf("\n\n");
+                abort();
+            }
+        }
+        else if (fmpz_sgn(s) <= 0
+            || !fmpz_divisible(fmpz_mat_entry(S, n - 1, n - 1), s))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("not a divisor of the largest invariant factor!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_print(s); flint_printf("\n\n");
+            abort();
+        }
+        else if (!fmpz_equal(fmpz_mat_entry(S, n - 1, n - 1), s))
+        {
+            misses++;
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(S);
+        fmpz_clear(s);
+    }
+
+    if (misses > 50 * flint_test_multiplier())
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("too many wrong results (%wd)\n", misses);
+        abort();
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
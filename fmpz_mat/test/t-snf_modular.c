@@ -0,0 +1,148 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("snf_modular....");
+    fflush(stdout);
+
+    /* compare with Kannan-Bachem on random matrices */
+    for (iter = 0; iter < 2000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S, S2;
+        slong n, b, d, r;
+
+        n = n_randint(state, 12);
+        r = n_randint(state, 4) == 0 ? n_randint(state, n + 1) : n;
+
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(S, n, n);
+        fmpz_mat_init(S2, n, n);
+
+        b = 1 + n_randint(state, 10) * n_randint(state, 10);
+        d = n_randint(state, 2*n*n + 1);
+        fmpz_mat_randrank(A, state, r, b);
+
+        if (n_randint(state, 2))
+            fmpz_mat_randops(A, state, d);
+
+        fmpz_mat_snf_modular(S, A);
+        fmpz_mat_snf_kannan_bachem(S2, A);
+
+        if (!fmpz_mat_is_in_snf(S) || !fmpz_mat_equal(S, S2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong snf!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+            abort();
+        }
+
+        /* aliasing */
+        fmpz_mat_snf_modular(A, A);
+
+        if (!fmpz_mat_equal(S, A))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("aliasing failed!\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_clear(S2);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(A);
+    }
+
+    /* known invariant factors with repeated small and large primes */
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S, D;
+        fmpz_t p;
+        slong n, i, j, k;
+
+        n = 1 + n_randint(state, 16);
+
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(S, n, n);
+        fmpz_mat_init(D, n, n);
+        fmpz_init(p);
+
+        for (i = 0; i < n; i++)
+            fmpz_one(fmpz_mat_entry(D, i, i));
+
+        for (k = n_randint(state, 5); k > 0; k--)
+        {
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 8), 0));
+                    break;
+                case 1:
+                    fmpz_set_ui(p, n_randprime(state, 20, 0));
+                    break;
+                case 2:
+                    fmpz_set_ui(p, n_randprime(state, 40, 0));
+                    break;
+                default:
+                    fmpz_randprime(p, state, 70 + n_randint(state, 60), 0);
+            }
+
+            /* multiply p into a random tail of the diagonal */
+            for (i = n_randint(state, n); i < n; i++)
+            {
+                for (j = n_randint(state, 3); j >= 0; j--)
+                    fmpz_mul(fmpz_mat_entry(D, i, i),
+                             fmpz_mat_entry(D, i, i), p);
+            }
+        }
+
+        /* keep the divisibility chain */
+        fmpz_mat_snf_diagonal(D, D);
+
+        fmpz_mat_set(A, D);
+        fmpz_mat_randops(A, state, n_randint(state, 4*n*n + 1));
+
+        fmpz_mat_snf_modular(S, A);
+
+        if (!fmpz_mat_equal(S, D))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong snf for known invariant factors!\n");
+            fmpz_mat_print_pretty(D); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(D);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,269 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FMPZ_MOD_H
+#define FMPZ_MOD_H
+
+#ifdef FMPZ_MOD_INLINES_C
+#define FMPZ_MOD_INLINE FLINT_DLL
+#else
+#define FMPZ_MOD_INLINE static __inline__
+#endif
+
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "fmpz.h"
+#include "nmod_vec.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Moduli of 2 up to FMPZ_MOD_FIXED_LIMBS limbs are handled by fixed-width
+    mpn arithmetic on the stack with Barrett reduction. Single limb moduli
+    use nmod arithmetic and larger ones plain fmpz arithmetic.
+*/
+#define FMPZ_MOD_FIXED_LIMBS 4
+
+/*
+    Number of reductions from which setting up a context for a fixed-width
+    modulus pays off against calling fmpz_mod directly.
+*/
+#define FMPZ_MOD_CTX_CUTOFF 8
+
+/*  Type definitions *********************************************************/
+
+typedef struct
+{
+    fmpz_t n;
+    slong limbs;                                 /* number of limbs of n  */
+    nmod_t mod;                                  /* if limbs == 1         */
+    mp_limb_t n_limbs[FMPZ_MOD_FIXED_LIMBS];     /* n, if fixed width     */
+    mp_limb_t mu[FMPZ_MOD_FIXED_LIMBS + 1];      /* (B^(2L) - 1) div n    */
+    mp_limb_t c[FMPZ_MOD_FIXED_LIMBS];           /* B^(2L) mod n          */
+}
+fmpz_mod_ctx_struct;
+
+typedef fmpz_mod_ctx_struct fmpz_mod_ctx_t[1];
+
+/*  Context management *******************************************************/
+
+FLINT_DLL void fmpz_mod_ctx_init(fmpz_mod_ctx_t ctx, const fmpz_t n);
+
+FLINT_DLL void fmpz_mod_ctx_clear(fmpz_mod_ctx_t ctx);
+
+FMPZ_MOD_INLINE
+const fmpz * fmpz_mod_ctx_modulus(const fmpz_mod_ctx_t ctx)
+{
+    return ctx->n;
+}
+
+/*  Fixed-width mpn arithmetic ***********************************************/
+
+FLINT_DLL void _fmpz_mod_mpn_reduce(mp_ptr r, mp_srcptr x, mp_size_t xn,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mulmod(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                                const fmpz_mod_ctx_t ctx);
+
+/*
+    The kernels below are written for a small constant L, so that the
+    compiler can unroll them when they are inlined with L = 2, 3 or 4.
+*/
+
+/* t = a b, where a has an limbs, b has bn limbs and t has an + bn limbs */
+FMPZ_MOD_INLINE
+void _fmpz_mod_mpn_mul_basecase(mp_ptr t, mp_srcptr a, slong an,
+                                                    mp_srcptr b, slong bn)
+{
+    mp_limb_t hi, lo, cy;
+    slong i, j;
+
+    for (i = 0; i < bn; i++)
+        t[i] = 0;
+
+    for (i = 0; i < an; i++)
+    {
+        cy = 0;
+        for (j = 0; j < bn; j++)
+        {
+            umul_ppmm(hi, lo, a[i], b[j]);
+            add_ssaaaa(hi, lo, hi, lo, 0, t[i + j]);
+            add_ssaaaa(hi, lo, hi, lo, 0, cy);
+            t[i + j] = lo;
+            cy = hi;
+        }
+        t[i + bn] = cy;
+    }
+}
+
+/* returns the borrow of r = a - b, all of n limbs */
+FMPZ_MOD_INLINE
+mp_limb_t _fmpz_mod_mpn_sub_n(mp_ptr r, mp_srcptr a, mp_srcptr b, slong n)
+{
+    mp_limb_t t, bw = 0;
+    slong i;
+
+    for (i = 0; i < n; i++)
+    {
+        t = a[i] - b[i] - bw;
+        bw = (a[i] < b[i]) | ((a[i] == b[i]) & bw);
+        r[i] = t;
+    }
+
+    return bw;
+}
+
+/* returns whether a >= b, both of n limbs */
+FMPZ_MOD_INLINE
+int _fmpz_mod_mpn_geq(mp_srcptr a, mp_srcptr b, slong n)
+{
+    slong i;
+
+    for (i = n - 1; i >= 0; i--)
+        if (a[i] != b[i])
+            return a[i] > b[i];
+
+    return 1;
+}
+
+/*
+    Sets r to x mod n, where x has 2L limbs, using the precomputed
+    mu = (B^(2L) - 1) div n. The quotient estimate is at most three too
+    small.
+*/
+FMPZ_MOD_INLINE
+void _fmpz_mod_mpn_barrett(mp_ptr r, mp_srcptr x, mp_srcptr n,
+                                                    mp_srcptr mu, slong L)
+{
+    mp_limb_t q[2 * FMPZ_MOD_FIXED_LIMBS + 2];
+    mp_limb_t t[2 * FMPZ_MOD_FIXED_LIMBS + 1];
+    mp_limb_t s[FMPZ_MOD_FIXED_LIMBS + 1];
+    slong i;
+
+    _fmpz_mod_mpn_mul_basecase(q, x + L - 1, L + 1, mu, L + 1);
+    _fmpz_mod_mpn_mul_basecase(t, q + L + 1, L + 1, n, L);
+    _fmpz_mod_mpn_sub_n(s, x, t, L + 1);
+
+    while (s[L] != 0 || _fmpz_mod_mpn_geq(s, n, L))
+        s[L] -= _fmpz_mod_mpn_sub_n(s, s, n, L);
+
+    for (i = 0; i < L; i++)
+        r[i] = s[i];
+}
+
+FMPZ_MOD_INLINE
+int _fmpz_mod_is_fixed(const fmpz_mod_ctx_t ctx)
+{
+    return ctx->limbs >= 2 && ctx->limbs <= FMPZ_MOD_FIXED_LIMBS;
+}
+
+/* whether len reductions modulo n should go through an fmpz_mod_ctx */
+FMPZ_MOD_INLINE
+int _fmpz_mod_use_ctx(const fmpz_t n, slong len)
+{
+    slong L = fmpz_size(n);
+
+    return L >= 2 && L <= FMPZ_MOD_FIXED_LIMBS && len >= FMPZ_MOD_CTX_CUTOFF;
+}
+
+/* writes the absolute value of a, which must fit, into L limbs */
+FMPZ_MOD_INLINE
+void _fmpz_mod_get_limbs(mp_ptr r, const fmpz_t a, slong L)
+{
+    fmpz c = *a;
+    slong i, size;
+
+    if (!COEFF_IS_MPZ(c))
+    {
+        r[0] = FLINT_ABS(c);
+        size = 1;
+    }
+    else
+    {
+        __mpz_struct * m = COEFF_TO_PTR(c);
+
+        size = FLINT_ABS(m->_mp_size);
+        for (i = 0; i < size; i++)
+            r[i] = m->_mp_d[i];
+    }
+
+    for (i = size; i < L; i++)
+        r[i] = 0;
+}
+
+FMPZ_MOD_INLINE
+void _fmpz_mod_set_limbs(fmpz_t a, mp_srcptr r, slong L)
+{
+    __mpz_struct * m;
+    slong i;
+
+    while (L > 0 && r[L - 1] == 0)
+        L--;
+
+    if (L <= 1)
+    {
+        fmpz_set_ui(a, L == 0 ? 0 : r[0]);
+        return;
+    }
+
+    m = _fmpz_promote(a);
+    if (m->_mp_alloc < L)
+        mpz_realloc2(m, L * FLINT_BITS);
+
+    for (i = 0; i < L; i++)
+        m->_mp_d[i] = r[i];
+    m->_mp_size = L;
+}
+
+/*  Arithmetic ***************************************************************/
+
+FLINT_DLL int fmpz_mod_is_canonical(const fmpz_t a, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_set_fmpz(fmpz_t a, const fmpz_t b,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_add(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_sub(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_neg(fmpz_t a, const fmpz_t b,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_mul(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_inv(fmpz_t a, const fmpz_t b,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_pow_ui(fmpz_t a, const fmpz_t b, ulong e,
+                                                const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_pow_fmpz(fmpz_t a, const fmpz_t b, const fmpz_t e,
+                                                const fmpz_mod_ctx_t ctx);
+
+/*  Vector functions *********************************************************/
+
+FLINT_DLL void _fmpz_mod_vec_set_fmpz_vec(fmpz * A, const fmpz * B,
+                                        slong len, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_vec_scalar_mul_fmpz_mod(fmpz * A, const fmpz * B,
+                        slong len, const fmpz_t c, const fmpz_mod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_add(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    if (_fmpz_mod_is_fixed(ctx))
+    {
+        mp_limb_t s[FMPZ_MOD_FIXED_LIMBS], t[FMPZ_MOD_FIXED_LIMBS];
+        slong L = ctx->limbs;
+
+        _fmpz_mod_get_limbs(s, b, L);
+        _fmpz_mod_get_limbs(t, c, L);
+
+        if (mpn_add_n(s, s, t, L) || mpn_cmp(s, ctx->n_limbs, L) >= 0)
+            mpn_sub_n(s, s, ctx->n_limbs, L);
+
+        _fmpz_mod_set_limbs(a, s, L);
+    }
+    else
+    {
+        fmpz_add(a, b, c);
+        if (fmpz_cmpabs(a, ctx->n) >= 0)
+            fmpz_sub(a, a, ctx->n);
+    }
+}
@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_ctx_init(fmpz_mod_ctx_t ctx, const fmpz_t n)
+{
+    slong i, L;
+
+    if (fmpz_sgn(n) <= 0)
+    {
+        flint_printf("Exception (fmpz_mod_ctx_init). Modulus must be positive.\n");
+        flint_abort();
+    }
+
+    fmpz_init_set(ctx->n, n);
+    L = fmpz_size(n);
+    ctx->limbs = L;
+
+    if (L == 1)
+    {
+        nmod_init(&ctx->mod, fmpz_get_ui(n));
+    }
+    else if (L <= FMPZ_MOD_FIXED_LIMBS)
+    {
+        mp_limb_t t[2 * FMPZ_MOD_FIXED_LIMBS], r[FMPZ_MOD_FIXED_LIMBS];
+
+        _fmpz_mod_get_limbs(ctx->n_limbs, n, L);
+
+        /* B^(2L) - 1 rather than B^(2L), so that mu fits in L + 1 limbs */
+        for (i = 0; i < 2 * L; i++)
+            t[i] = ~UWORD(0);
+        mpn_tdiv_qr(ctx->mu, r, 0, t, 2 * L, ctx->n_limbs, L);
+
+        mpn_add_1(r, r, L, 1);
+        if (mpn_cmp(r, ctx->n_limbs, L) == 0)
+            flint_mpn_zero(r, L);
+        flint_mpn_copyi(ctx->c, r, L);
+    }
+}
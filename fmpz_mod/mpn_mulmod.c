@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+static __inline__ void
+_fmpz_mod_mpn_mulmod_fixed(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                    mp_srcptr n, mp_srcptr mu, slong L)
+{
+    mp_limb_t t[2 * FMPZ_MOD_FIXED_LIMBS];
+
+    _fmpz_mod_mpn_mul_basecase(t, a, L, b, L);
+    _fmpz_mod_mpn_barrett(r, t, n, mu, L);
+}
+
+void _fmpz_mod_mpn_mulmod(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    switch (ctx->limbs)
+    {
+        case 2:
+            _fmpz_mod_mpn_mulmod_fixed(r, a, b, ctx->n_limbs, ctx->mu, 2);
+            break;
+        case 3:
+            _fmpz_mod_mpn_mulmod_fixed(r, a, b, ctx->n_limbs, ctx->mu, 3);
+            break;
+        default:
+            _fmpz_mod_mpn_mulmod_fixed(r, a, b, ctx->n_limbs, ctx->mu, 4);
+    }
+}
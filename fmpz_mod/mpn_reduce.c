@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+/*
+    A single extra limb h, as in products of reduced values, is folded in
+    using h B^(2L) = h c mod n. Longer inputs are reduced from the top, one
+    window of 2L limbs at a time: the remainder of each window takes the
+    place of its top 2L - k limbs, where k <= L limbs are brought down next.
+*/
+static __inline__ void
+_fmpz_mod_mpn_reduce_fixed(mp_ptr r, mp_srcptr x, mp_size_t xn,
+                    mp_srcptr n, mp_srcptr mu, mp_srcptr c, slong L)
+{
+    mp_limb_t w[2 * FMPZ_MOD_FIXED_LIMBS + 1];
+    mp_limb_t hi, lo, cy;
+    slong i, k, m;
+
+    if (xn < L)
+    {
+        for (i = 0; i < xn; i++)
+            r[i] = x[i];
+        for ( ; i < L; i++)
+            r[i] = 0;
+        return;
+    }
+
+    if (xn <= 2 * L)
+    {
+        for (i = 0; i < xn; i++)
+            w[i] = x[i];
+        for ( ; i < 2 * L; i++)
+            w[i] = 0;
+        _fmpz_mod_mpn_barrett(r, w, n, mu, L);
+        return;
+    }
+
+    if (xn == 2 * L + 1)
+    {
+        cy = 0;
+        for (i = 0; i < L; i++)
+        {
+            umul_ppmm(hi, lo, x[2 * L], c[i]);
+            add_ssaaaa(hi, lo, hi, lo, 0, x[i]);
+            add_ssaaaa(hi, lo, hi, lo, 0, cy);
+            w[i] = lo;
+            cy = hi;
+        }
+        for ( ; i < 2 * L; i++)
+        {
+            w[i] = x[i] + cy;
+            cy = (w[i] < cy);
+        }
+
+        /* the low 2L limbs are now below B^(L + 1), so this cannot carry */
+        if (cy != 0)
+            mpn_add(w, w, 2 * L, c, L);
+
+        _fmpz_mod_mpn_barrett(r, w, n, mu, L);
+        return;
+    }
+
+    m = xn - 2 * L;
+    _fmpz_mod_mpn_barrett(r, x + m, n, mu, L);
+
+    while (m > 0)
+    {
+        k = FLINT_MIN(L, m);
+        m -= k;
+
+        for (i = 0; i < k; i++)
+            w[i] = x[m + i];
+        for (i = 0; i < L; i++)
+            w[k + i] = r[i];
+        for (i = k + L; i < 2 * L; i++)
+            w[i] = 0;
+
+        _fmpz_mod_mpn_barrett(r, w, n, mu, L);
+    }
+}
+
+void _fmpz_mod_mpn_reduce(mp_ptr r, mp_srcptr x, mp_size_t xn,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    switch (ctx->limbs)
+    {
+        case 2:
+            _fmpz_mod_mpn_reduce_fixed(r, x, xn, ctx->n_limbs, ctx->mu,
+                                                            ctx->c, 2);
+            break;
+        case 3:
+            _fmpz_mod_mpn_reduce_fixed(r, x, xn, ctx->n_limbs, ctx->mu,
+                                                            ctx->c, 3);
+            break;
+        default:
+            _fmpz_mod_mpn_reduce_fixed(r, x, xn, ctx->n_limbs, ctx->mu,
+                                                            ctx->c, 4);
+    }
+}
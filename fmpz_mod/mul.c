@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_mul(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    if (_fmpz_mod_is_fixed(ctx))
+    {
+        mp_limb_t s[FMPZ_MOD_FIXED_LIMBS], t[FMPZ_MOD_FIXED_LIMBS];
+        slong L = ctx->limbs;
+
+        _fmpz_mod_get_limbs(s, b, L);
+
+        if (b == c)
+        {
+            _fmpz_mod_mpn_mulmod(s, s, s, ctx);
+        }
+        else
+        {
+            _fmpz_mod_get_limbs(t, c, L);
+            _fmpz_mod_mpn_mulmod(s, s, t, ctx);
+        }
+
+        _fmpz_mod_set_limbs(a, s, L);
+    }
+    else if (ctx->limbs == 1)
+    {
+        fmpz_set_ui(a, n_mulmod2_preinv(fmpz_get_ui(b), fmpz_get_ui(c),
+                                            ctx->mod.n, ctx->mod.ninv));
+    }
+    else
+    {
+        fmpz_mul(a, b, c);
+        fmpz_mod_set_fmpz(a, a, ctx);
+    }
+}
@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_pow_fmpz(fmpz_t a, const fmpz_t b, const fmpz_t e,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    if (fmpz_sgn(e) < 0)
+    {
+        flint_printf("Exception (fmpz_mod_pow_fmpz). Negative exponent.\n");
+        flint_abort();
+    }
+
+    fmpz_powm(a, b, e, ctx->n);
+}
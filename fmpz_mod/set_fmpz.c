@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_set_fmpz(fmpz_t a, const fmpz_t b, const fmpz_mod_ctx_t ctx)
+{
+    fmpz c = *b;
+
+    if (ctx->limbs == 1)
+    {
+        if (!COEFF_IS_MPZ(c))
+        {
+            mp_limb_t r;
+
+            NMOD_RED(r, FLINT_ABS(c), ctx->mod);
+            if (c < 0 && r != 0)
+                r = ctx->mod.n - r;
+            fmpz_set_ui(a, r);
+        }
+        else
+        {
+            fmpz_set_ui(a, fmpz_fdiv_ui(b, ctx->mod.n));
+        }
+    }
+    else if (!COEFF_IS_MPZ(c))
+    {
+        /* |b| is smaller than the modulus */
+        if (c >= 0)
+            fmpz_set_si(a, c);
+        else
+            fmpz_sub_ui(a, ctx->n, -c);
+    }
+    else if (_fmpz_mod_is_fixed(ctx))
+    {
+        __mpz_struct * m = COEFF_TO_PTR(c);
+        mp_limb_t r[FMPZ_MOD_FIXED_LIMBS];
+        slong L = ctx->limbs;
+
+        _fmpz_mod_mpn_reduce(r, m->_mp_d, FLINT_ABS(m->_mp_size), ctx);
+
+        if (m->_mp_size < 0 && !flint_mpn_zero_p(r, L))
+            mpn_sub_n(r, ctx->n_limbs, r, L);
+
+        _fmpz_mod_set_limbs(a, r, L);
+    }
+    else
+    {
+        fmpz_mod(a, b, ctx->n);
+    }
+}
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+#include "ulong_extras.h"
+
+/* moduli of up to five limbs, including powers of B and B^k - 1 */
+static void
+_randtest_modulus(fmpz_t n, flint_rand_t state)
+{
+    switch (n_randint(state, 8))
+    {
+        case 0:
+            fmpz_one(n);
+            fmpz_mul_2exp(n, n, FLINT_BITS * n_randint(state, 5));
+            break;
+        case 1:
+            fmpz_one(n);
+            fmpz_mul_2exp(n, n, FLINT_BITS * (1 + n_randint(state, 5)));
+            fmpz_sub_ui(n, n, 1);
+            break;
+        default:
+            fmpz_randtest_not_zero(n, state, 5 * FLINT_BITS);
+            fmpz_abs(n, n);
+    }
+}
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_fmpz....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 10000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mod_ctx_t ctx;
+        fmpz_t n, a, b, c;
+
+        fmpz_init(n);
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        _randtest_modulus(n, state);
+        fmpz_mod_ctx_init(ctx, n);
+
+        fmpz_randtest(b, state, 1 + n_randint(state, 12 * FLINT_BITS));
+        fmpz_mod(c, b, n);
+
+        if (n_randint(state, 2))
+        {
+            fmpz_mod_set_fmpz(a, b, ctx);
+        }
+        else
+        {
+            fmpz_set(a, b);
+            fmpz_mod_set_fmpz(a, a, ctx);
+        }
+
+        if (!fmpz_equal(a, c) || !fmpz_mod_is_canonical(a, ctx))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = "), fmpz_print(n), flint_printf("\n");
+            flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+            flint_printf("c = "), fmpz_print(c), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mod_ctx_clear(ctx);
+        fmpz_clear(n);
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+
+void _fmpz_mod_vec_scalar_mul_fmpz_mod(fmpz * A, const fmpz * B,
+                        slong len, const fmpz_t c, const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+
+    if (_fmpz_mod_is_fixed(ctx))
+    {
+        mp_limb_t s[FMPZ_MOD_FIXED_LIMBS], t[FMPZ_MOD_FIXED_LIMBS];
+        slong L = ctx->limbs;
+
+        _fmpz_mod_get_limbs(t, c, L);
+
+        for (i = 0; i < len; i++)
+        {
+            _fmpz_mod_get_limbs(s, B + i, L);
+            _fmpz_mod_mpn_mulmod(s, s, t, ctx);
+            _fmpz_mod_set_limbs(A + i, s, L);
+        }
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            fmpz_mod_mul(A + i, B + i, c, ctx);
+    }
+}
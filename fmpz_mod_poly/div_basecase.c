@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011, 2010 Sebastian Pancratz
     Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -12,6 +13,7 @@
 
 #include <stdlib.h>
 #include "fmpz_vec.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_div_basecase(fmpz *Q, fmpz *R, 
@@ -19,7 +21,12 @@ void _fmpz_mod_poly_div_basecase(fmpz *Q, fmpz *R,
     const fmpz_t invB, const fmpz_t p)
 {
     const slong alloc = (R == NULL) ? lenA : 0;
+    const int use_ctx = _fmpz_mod_use_ctx(p, (lenA - lenB + 1) * lenB);
     slong lenR = lenB - 1, iQ;
+    fmpz_mod_ctx_t ctx;
+
+    if (use_ctx)
+        fmpz_mod_ctx_init(ctx, p);
 
     if (alloc)
         R = _fmpz_vec_init(alloc);
@@ -35,10 +42,19 @@ void _fmpz_mod_poly_div_basecase(fmpz *Q, fmpz *R,
         else
         {
             fmpz_mul(Q + iQ, R + lenA - 1, invB);
-            fmpz_mod(Q + iQ, Q + iQ, p);
+            if (use_ctx)
+                fmpz_mod_set_fmpz(Q + iQ, Q + iQ, ctx);
+            else
+                fmpz_mod(Q + iQ, Q + iQ, p);
 
             _fmpz_vec_scalar_submul_fmpz(R + lenA - lenR - 1, B, lenR, Q + iQ);
-            _fmpz_vec_scalar_mod_fmpz(R + lenA - lenR - 1, R + lenA - lenR - 1, lenR, p);
+
+            if (use_ctx)
+                _fmpz_mod_vec_set_fmpz_vec(R + lenA - lenR - 1,
+                                           R + lenA - lenR - 1, lenR, ctx);
+            else
+                _fmpz_vec_scalar_mod_fmpz(R + lenA - lenR - 1,
+                                          R + lenA - lenR - 1, lenR, p);
         }
 
         if (lenR - 1 >= iQ)
@@ -52,6 +68,9 @@ void _fmpz_mod_poly_div_basecase(fmpz *Q, fmpz *R,
 
     if (alloc)
         _fmpz_vec_clear(R, alloc);
+
+    if (use_ctx)
+        fmpz_mod_ctx_clear(ctx);
 }
 
 void fmpz_mod_poly_div_basecase(fmpz_mod_poly_t Q, 
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011, 2010 Sebastian Pancratz
     Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -12,14 +13,20 @@
 
 #include <stdlib.h>
 #include "fmpz_vec.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_divrem_basecase(fmpz *Q, fmpz *R, 
     const fmpz *A, slong lenA, const fmpz *B, slong lenB, 
     const fmpz_t invB, const fmpz_t p)
 {
+    const int use_ctx = _fmpz_mod_use_ctx(p, (lenA - lenB + 1) * lenB);
     slong iQ, iR;
     fmpz * W;
+    fmpz_mod_ctx_t ctx;
+
+    if (use_ctx)
+        fmpz_mod_ctx_init(ctx, p);
 
     if (R != A)
     {
@@ -35,10 +42,17 @@ void _fmpz_mod_poly_divrem_basecase(fmpz *Q, fmpz *R,
         else
         {
             fmpz_mul(Q + iQ, W + iR, invB);
-            fmpz_mod(Q + iQ, Q + iQ, p);
+            if (use_ctx)
+                fmpz_mod_set_fmpz(Q + iQ, Q + iQ, ctx);
+            else
+                fmpz_mod(Q + iQ, Q + iQ, p);
 
             _fmpz_vec_scalar_submul_fmpz(W + iQ, B, lenB, Q + iQ);
-            _fmpz_vec_scalar_mod_fmpz(W + iQ, W + iQ, lenB, p);
+
+            if (use_ctx)
+                _fmpz_mod_vec_set_fmpz_vec(W + iQ, W + iQ, lenB, ctx);
+            else
+                _fmpz_vec_scalar_mod_fmpz(W + iQ, W + iQ, lenB, p);
         }
     }
 
@@ -47,6 +61,9 @@ void _fmpz_mod_poly_divrem_basecase(fmpz *Q, fmpz *R,
        _fmpz_vec_set(R, W, lenB - 1);
        _fmpz_vec_clear(W, lenA);
     }
+
+    if (use_ctx)
+        fmpz_mod_ctx_clear(ctx);
 }
 
 void fmpz_mod_poly_divrem_basecase(fmpz_mod_poly_t Q, fmpz_mod_poly_t R, 
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -14,13 +15,33 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_mul(fmpz *res, const fmpz *poly1, slong len1, 
                                    const fmpz *poly2, slong len2, const fmpz_t p)
 {
+    fmpz_mod_ctx_t ctx;
+
+    if (_fmpz_poly_mul_use_multi_mod(len2, 2 * fmpz_size(p)))
+    {
+        _fmpz_poly_mullow_multi_mod_reduce(res, poly1, len1, poly2, len2,
+                                                        len1 + len2 - 1, p);
+        return;
+    }
+
     _fmpz_poly_mul(res, poly1, len1, poly2, len2);
-    _fmpz_vec_scalar_mod_fmpz(res, res, len1 + len2 - 1, p);
+
+    if (_fmpz_mod_use_ctx(p, len1 + len2 - 1))
+    {
+        fmpz_mod_ctx_init(ctx, p);
+        _fmpz_mod_vec_set_fmpz_vec(res, res, len1 + len2 - 1, ctx);
+        fmpz_mod_ctx_clear(ctx);
+    }
+    else
+    {
+        _fmpz_vec_scalar_mod_fmpz(res, res, len1 + len2 - 1, p);
+    }
 }
 
 void fmpz_mod_poly_mul(fmpz_mod_poly_t res, 
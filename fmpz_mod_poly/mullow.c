@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -14,14 +15,33 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_mullow(fmpz *res, const fmpz *poly1, slong len1, 
                                       const fmpz *poly2, slong len2, 
                                       const fmpz_t p, slong n)
 {
+    fmpz_mod_ctx_t ctx;
+
+    if (_fmpz_poly_mul_use_multi_mod(FLINT_MIN(len2, n), 2 * fmpz_size(p)))
+    {
+        _fmpz_poly_mullow_multi_mod_reduce(res, poly1, len1, poly2, len2, n, p);
+        return;
+    }
+
     _fmpz_poly_mullow(res, poly1, len1, poly2, len2, n);
-    _fmpz_vec_scalar_mod_fmpz(res, res, n, p);
+
+    if (_fmpz_mod_use_ctx(p, n))
+    {
+        fmpz_mod_ctx_init(ctx, p);
+        _fmpz_mod_vec_set_fmpz_vec(res, res, n, ctx);
+        fmpz_mod_ctx_clear(ctx);
+    }
+    else
+    {
+        _fmpz_vec_scalar_mod_fmpz(res, res, n, p);
+    }
 }
 
 void fmpz_mod_poly_mullow(fmpz_mod_poly_t res, 
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011, 2010 Sebastian Pancratz
     Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -12,17 +13,22 @@
 
 #include <stdlib.h>
 #include "fmpz_vec.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_rem_basecase(fmpz *R, 
     const fmpz *A, slong lenA, const fmpz *B, slong lenB, 
     const fmpz_t invB, const fmpz_t p)
 {
+    const int use_ctx = _fmpz_mod_use_ctx(p, (lenA - lenB + 1) * lenB);
     fmpz_t q;
     slong iR;
     fmpz * W;
+    fmpz_mod_ctx_t ctx;
 
     fmpz_init(q);
+    if (use_ctx)
+        fmpz_mod_ctx_init(ctx, p);
 
     if (R != A)
     {
@@ -36,10 +42,19 @@ void _fmpz_mod_poly_rem_basecase(fmpz *R,
         if (!fmpz_is_zero(W + iR))
         {
             fmpz_mul(q, W + iR, invB);
-            fmpz_mod(q, q, p);
+            if (use_ctx)
+                fmpz_mod_set_fmpz(q, q, ctx);
+            else
+                fmpz_mod(q, q, p);
 
             _fmpz_vec_scalar_submul_fmpz(W + (iR - lenB + 1), B, lenB, q);
-            _fmpz_vec_scalar_mod_fmpz(W + (iR - lenB + 1), W + (iR - lenB + 1), lenB, p);
+
+            if (use_ctx)
+                _fmpz_mod_vec_set_fmpz_vec(W + (iR - lenB + 1),
+                                           W + (iR - lenB + 1), lenB, ctx);
+            else
+                _fmpz_vec_scalar_mod_fmpz(W + (iR - lenB + 1),
+                                          W + (iR - lenB + 1), lenB, p);
         }
     }
 
@@ -50,6 +65,8 @@ void _fmpz_mod_poly_rem_basecase(fmpz *R,
     }
 
     fmpz_clear(q);
+    if (use_ctx)
+        fmpz_mod_ctx_clear(ctx);
 }
 
 void fmpz_mod_poly_rem_basecase(fmpz_mod_poly_t R, 
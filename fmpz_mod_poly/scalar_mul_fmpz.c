@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,13 +14,26 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_scalar_mul_fmpz(fmpz *res, const fmpz *poly, slong len, 
                                     const fmpz_t x, const fmpz_t p)
 {
+    fmpz_mod_ctx_t ctx;
+
     _fmpz_vec_scalar_mul_fmpz(res, poly, len, x);
-    _fmpz_vec_scalar_mod_fmpz(res, res, len, p);
+
+    if (_fmpz_mod_use_ctx(p, len))
+    {
+        fmpz_mod_ctx_init(ctx, p);
+        _fmpz_mod_vec_set_fmpz_vec(res, res, len, ctx);
+        fmpz_mod_ctx_clear(ctx);
+    }
+    else
+    {
+        _fmpz_vec_scalar_mod_fmpz(res, res, len, p);
+    }
 }
 
 void fmpz_mod_poly_scalar_mul_fmpz(fmpz_mod_poly_t res, 
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -14,12 +15,32 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "fmpz_mod.h"
 #include "fmpz_mod_poly.h"
 
 void _fmpz_mod_poly_sqr(fmpz *res, const fmpz *poly, slong len, const fmpz_t p)
 {
+    fmpz_mod_ctx_t ctx;
+
+    if (_fmpz_poly_sqr_use_multi_mod(len, fmpz_size(p)))
+    {
+        _fmpz_poly_mullow_multi_mod_reduce(res, poly, len, poly, len,
+                                                            2 * len - 1, p);
+        return;
+    }
+
     _fmpz_poly_sqr(res, poly, len);
-    _fmpz_vec_scalar_mod_fmpz(res, res, 2 * len - 1, p);
+
+    if (_fmpz_mod_use_ctx(p, 2 * len - 1))
+    {
+        fmpz_mod_ctx_init(ctx, p);
+        _fmpz_mod_vec_set_fmpz_vec(res, res, 2 * len - 1, ctx);
+        fmpz_mod_ctx_clear(ctx);
+    }
+    else
+    {
+        _fmpz_vec_scalar_mod_fmpz(res, res, 2 * len - 1, p);
+    }
 }
 
 void fmpz_mod_poly_sqr(fmpz_mod_poly_t res, const fmpz_mod_poly_t poly)
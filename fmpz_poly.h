@@ -3,6 +3,7 @@
     Copyright (C) 2009, 2011 Andy Novocin
     Copyright (C) 2010 Sebastian Pancratz
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -447,6 +448,49 @@ FLINT_DLL void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong le
 FLINT_DLL void fmpz_poly_mullow_SS(fmpz_poly_t res,
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL void _fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1,
+                            slong len1, const fmpz * poly2, slong len2);
+
+FLINT_DLL void fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
+FLINT_DLL void _fmpz_poly_mullow_multi_mod(fmpz * res, const fmpz * poly1,
+                    slong len1, const fmpz * poly2, slong len2, slong n);
+
+FLINT_DLL void fmpz_poly_mullow_multi_mod(fmpz_poly_t res,
+                  const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
+
+FLINT_DLL void _fmpz_poly_mullow_multi_mod_reduce(fmpz * res,
+    const fmpz * poly1, slong len1, const fmpz * poly2, slong len2,
+    slong n, const fmpz_t m);
+
+/*
+    Whether the multi-modular algorithm is used for a product whose shorter
+    factor has length len, where the coefficients of the factors have limbs
+    limbs in total, respectively for a square of a polynomial of length len
+    with coefficients of limbs limbs.
+*/
+FMPZ_POLY_INLINE
+int _fmpz_poly_mul_use_multi_mod(slong len, mp_size_t limbs)
+{
+#if FLINT64
+    return len >= 1024 && ((limbs <= 32 && len >= 8192)
+        || (limbs <= 16 && len >= 2048) || (limbs >= 4 && limbs <= 8));
+#else
+    return 0;
+#endif
+}
+
+FMPZ_POLY_INLINE
+int _fmpz_poly_sqr_use_multi_mod(slong len, mp_size_t limbs)
+{
+#if FLINT64
+    return (limbs <= 16 && len >= 8192) || (limbs <= 8 && len >= 4096);
+#else
+    return 0;
+#endif
+}
+
 FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1, 
                                   slong len1, const fmpz * poly2, slong len2);
 
@@ -923,6 +967,9 @@ FLINT_DLL void _fmpz_poly_taylor_shift_divconquer(fmpz * poly, const fmpz_t c, s
 FLINT_DLL void fmpz_poly_taylor_shift_divconquer(fmpz_poly_t g, const fmpz_poly_t f,
     const fmpz_t c);
 
+FLINT_DLL void _fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec,
+    slong len, mp_srcptr primes, slong num_primes, int crt);
+
 FLINT_DLL void _fmpz_poly_taylor_shift_multi_mod_threaded(fmpz * poly, const fmpz_t c, slong n);
 
 FLINT_DLL void _fmpz_poly_taylor_shift_multi_mod_omp(fmpz * poly, const fmpz_t c, slong n);
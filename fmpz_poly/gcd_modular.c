@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
@@ -16,6 +18,73 @@
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    const fmpz * A;
+    const fmpz * B;
+    slong len1;
+    slong len2;
+    mp_ptr a;
+    mp_ptr b;
+    mp_ptr * h;
+    slong * hlen;
+    mp_srcptr primes;
+    slong p0;
+    slong p1;
+}
+gcd_mod_arg_t;
+
+static void
+_fmpz_poly_gcd_mod(gcd_mod_arg_t * arg)
+{
+    slong i;
+    nmod_t mod;
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        nmod_init(&mod, arg->primes[i]);
+
+        _fmpz_vec_get_nmod_vec(arg->a, arg->A, arg->len1, mod);
+        _fmpz_vec_get_nmod_vec(arg->b, arg->B, arg->len2, mod);
+
+        /* switches to the half-gcd above NMOD_POLY_GCD_CUTOFF */
+        arg->hlen[i] = _nmod_poly_gcd(arg->h[i], arg->a, arg->len1,
+                                                arg->b, arg->len2, mod);
+    }
+}
+
+static void *
+_fmpz_poly_gcd_mod_worker(void * arg_ptr)
+{
+    _fmpz_poly_gcd_mod((gcd_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* sets h[i] to the gcd of A and B modulo primes[i], one prime per thread */
+static void
+_fmpz_poly_gcd_mod_threaded(gcd_mod_arg_t * args, pthread_t * threads,
+                                    slong num_threads, mp_srcptr primes)
+{
+    slong i;
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].primes = primes;
+        args[i].p0 = i;
+        args[i].p1 = i + 1;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+            _fmpz_poly_gcd_mod_worker, &args[i]);
+
+    _fmpz_poly_gcd_mod(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+}
 
 void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
@@ -23,11 +92,13 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     mp_bitcnt_t bits1, bits2, nb1, nb2, bits_small, pbits, curr_bits = 0, new_bits;   
     fmpz_t ac, bc, hc, d, g, l, eval_A, eval_B, eval_GCD, modulus;
     fmpz * A, * B, * Q, * lead_A, * lead_B;
-    mp_ptr a, b, h;
+    mp_ptr h, primes, * hs;
     mp_limb_t p, h_inv, g_mod;
     nmod_t mod;
-    slong i, n, n0, unlucky, hlen, bound;
-    int g_pm1;
+    slong i, k, n, n0, unlucky, hlen, bound, num_threads, num, used, * hlens;
+    gcd_mod_arg_t * args;
+    pthread_t * threads;
+    int g_pm1, reset, done;
 
     fmpz_init(ac);
     fmpz_init(bc);
@@ -126,10 +197,28 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     Q = _fmpz_vec_init(len1);
 
+    /* primes are handled in batches of one per thread */
+    num_threads = flint_get_num_threads();
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(gcd_mod_arg_t) * num_threads);
+    primes = flint_malloc(sizeof(mp_limb_t) * num_threads);
+    hs = flint_malloc(sizeof(mp_ptr) * num_threads);
+    hlens = flint_malloc(sizeof(slong) * num_threads);
+
     /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    h = _nmod_vec_init(len2);
+    for (k = 0; k < num_threads; k++)
+    {
+        args[k].A = A;
+        args[k].B = B;
+        args[k].len1 = len1;
+        args[k].len2 = len2;
+        args[k].a = _nmod_vec_init(len1);
+        args[k].b = _nmod_vec_init(len2);
+        args[k].h = hs;
+        args[k].hlen = hlens;
+        hs[k] = _nmod_vec_init(len2);
+    }
 
     /* zero entire output */
     _fmpz_vec_zero(res, len2);
@@ -142,106 +231,93 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     n0 = len1 - 1;
     bound = (n0 + 3)*FLINT_MAX(nb1, nb2) + (n0 + 1); /* initialise bound */
     unlucky = 0;
+    hlen = 0;
+    done = 0;
 
-    for (;;)
+    while (!done)
     {
-        /* get new prime and initialise modulus */
-        p = n_nextprime(p, 0);
-        if (fmpz_fdiv_ui(l, p) == 0)
+        /* get a batch of primes not dividing the leading coefficients */
+        for (num = 0; num < num_threads; )
         {
-            unlucky += pbits;
-            continue;
+            p = n_nextprime(p, 0);
+            if (fmpz_fdiv_ui(l, p) == 0)
+                unlucky += pbits;
+            else
+                primes[num++] = p;
         }
-        nmod_init(&mod, p);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+        /* compute the gcds over Z/pZ in parallel */
+        _fmpz_poly_gcd_mod_threaded(args, threads, num_threads, primes);
 
-        /* compute gcd over Z/pZ */
-        hlen = _nmod_poly_gcd(h, a, len1, b, len2, mod);
+        reset = 0;
+        used = 0;
 
-        if (hlen == 1) /* gcd is 1 */
+        for (k = 0; k < num && !done; k++)
         {
-            fmpz_one(res);
-            _fmpz_vec_zero(res + 1, len2 - 1);
-            break; 
-        }
+            h = hs[k];
+            nmod_init(&mod, primes[k]);
 
-        if (hlen > n + 1) /* discard this prime */
-        {
-            unlucky += pbits;
-            continue;
-        }
+            if (hlens[k] == 1) /* gcd is 1 */
+            {
+                fmpz_one(res);
+                _fmpz_vec_zero(res + 1, len2 - 1);
+                hlen = 1;
+                done = 1;
+                break;
+            }
 
-        /* scale new polynomial mod p appropriately */
-        if (g_pm1) _nmod_poly_make_monic(h, h, hlen, mod);
-        else
-        {
-            h_inv = n_invmod(h[hlen - 1], mod.n);
-            g_mod = fmpz_fdiv_ui(g, mod.n);
-            h_inv = n_mulmod2_preinv(h_inv, g_mod, mod.n, mod.ninv);
-            _nmod_vec_scalar_mul_nmod(h, h, hlen, h_inv, mod);
-        }
+            if (hlens[k] > n + 1) /* discard this prime */
+            {
+                unlucky += pbits;
+                continue;
+            }
 
-        if (hlen <= n) /* we have a new bound on size of result */
-        {
-            unlucky += fmpz_bits(modulus);
-            _fmpz_vec_set_nmod_vec(res, h, hlen, mod);
-            _fmpz_vec_zero(res + hlen, len2 - hlen);
+            used++;
 
-            if (g_pm1)
+            /* scale new polynomial mod p appropriately */
+            if (g_pm1) _nmod_poly_make_monic(h, h, hlens[k], mod);
+            else
             {
-                /* are we done? */
-                if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                    _fmpz_poly_divides(Q, A, len1, res, hlen))
-                break;
+                h_inv = n_invmod(h[hlens[k] - 1], mod.n);
+                g_mod = fmpz_fdiv_ui(g, mod.n);
+                h_inv = n_mulmod2_preinv(h_inv, g_mod, mod.n, mod.ninv);
+                _nmod_vec_scalar_mul_nmod(h, h, hlens[k], h_inv, mod);
             }
-            else
+
+            if (hlens[k] <= n) /* we have a new bound on size of result */
             {
-                if (pbits + unlucky >= bound) /* if we reach the bound with one prime */
-                { 
-                    _fmpz_vec_content(hc, res, hlen);
-
-                   /* divide by content */
-                   _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
-                   break;
-                }
-
-                if (pbits >= bits_small) /* if one prime is already big enough to check */
-                {
-                    /* divide by content */
-                    _fmpz_vec_content(hc, res, hlen);
-
-                    /* correct sign of leading term */
-                    if (fmpz_sgn(res + hlen - 1) < 0)
-                        fmpz_neg(hc, hc);
-
-                    _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
-
-                    /* are we done? */
-                    if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                        _fmpz_poly_divides(Q, A, len1, res, hlen))
-                        break;
-
-                    /* no, so multiply by content again */
-                    _fmpz_vec_scalar_mul_fmpz(res, res, hlen, hc);
-                }
+                unlucky += fmpz_bits(modulus);
+
+                hlen = hlens[k];
+                _fmpz_vec_set_nmod_vec(res, h, hlen, mod);
+                _fmpz_vec_zero(res + hlen, len2 - hlen);
+                fmpz_set_ui(modulus, mod.n);
+                n = hlen - 1;
+                reset = 1;
+                continue;
             }
 
-            curr_bits = FLINT_ABS(_fmpz_vec_max_bits(res, hlen));
-            fmpz_set_ui(modulus, p);
-            n = hlen - 1; /* if we reach this we have a new bound on length of result */
-            continue;
+            _fmpz_poly_CRT_ui(res, res, hlen, modulus, h, hlen,
+                                                    mod.n, mod.ninv, 1);
+            fmpz_mul_ui(modulus, modulus, mod.n);
         }
 
-        _fmpz_poly_CRT_ui(res, res, hlen, modulus, h, hlen, mod.n, mod.ninv, 1);
-        fmpz_mul_ui(modulus, modulus, mod.n);
+        if (done)
+            break;
 
+        if (used == 0)
+            continue;
+
+        /*
+            The divisibility test is done at most once per batch, once the
+            lifted coefficients have stopped growing or the modulus exceeds
+            the heuristic size of the gcd.
+        */
         new_bits = _fmpz_vec_max_bits(res, hlen);
         new_bits = FLINT_ABS(new_bits);
 
-        if (new_bits == curr_bits || fmpz_bits(modulus) >= bits_small)
+        if ((!reset && new_bits == curr_bits) || (reset && g_pm1)
+                                || fmpz_bits(modulus) >= bits_small)
         {
             if (!g_pm1)
             {
@@ -273,15 +349,24 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
         curr_bits = new_bits;
     }
 
+    for (k = 0; k < num_threads; k++)
+    {
+        _nmod_vec_clear(args[k].a);
+        _nmod_vec_clear(args[k].b);
+        _nmod_vec_clear(hs[k]);
+    }
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(primes);
+    flint_free(hs);
+    flint_free(hlens);
+
     fmpz_clear(modulus);
     fmpz_clear(g); 
     fmpz_clear(l); 
     fmpz_clear(hc);
 
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-    _nmod_vec_clear(h); 
-
     /* finally multiply by content */
     _fmpz_vec_scalar_mul_fmpz(res, res, hlen, d);
 
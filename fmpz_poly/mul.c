@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -143,6 +144,12 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     limbs1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
+    if (_fmpz_poly_mul_use_multi_mod(len2, limbs1 + limbs2))
+    {
+        _fmpz_poly_mul_multi_mod(res, poly1, len1, poly2, len2);
+        return;
+    }
+
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
         _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
     else if (limbs1 + limbs2 <= 8)
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -147,6 +148,12 @@ _fmpz_poly_mullow(fmpz * res, const fmpz * poly1, slong len1,
     limbs1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
+    if (_fmpz_poly_mul_use_multi_mod(len2, limbs1 + limbs2))
+    {
+        _fmpz_poly_mullow_multi_mod(res, poly1, len1, poly2, len2, n);
+        return;
+    }
+
     if (n < 16 && (limbs1 > 12 || limbs2 > 12))
     {
         int clear = 0, i;
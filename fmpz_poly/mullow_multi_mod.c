@@ -0,0 +1,661 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod.h"
+
+#if FLINT64
+
+/*
+    Primes j 2^32 + 1 just below 2^62, so that transforms of length up to
+    2^32 exist and lazy butterflies on [0, 4p) fit in a word.
+*/
+static const mp_limb_t _fmpz_poly_multi_mod_primes[] = {
+    UWORD(4611685941117976577), UWORD(4611685692009873409),
+    UWORD(4611685606110527489), UWORD(4611685318347718657),
+    UWORD(4611685232448372737), UWORD(4611685219563470849),
+    UWORD(4611685125074190337), UWORD(4611685090714451969),
+    UWORD(4611685039174844417), UWORD(4611685021994975233),
+    UWORD(4611684738527133697), UWORD(4611684691282493441),
+    UWORD(4611684674102624257), UWORD(4611684609678114817),
+    UWORD(4611684588203278337), UWORD(4611684274670665729),
+    UWORD(4611684098577006593), UWORD(4611683789339361281),
+    UWORD(4611683647605440513), UWORD(4611683643310473217),
+    UWORD(4611683578885963777), UWORD(4611683557411127297),
+    UWORD(4611683437152043009), UWORD(4611683282533220353),
+    UWORD(4611683157979168769), UWORD(4611682913166032897),
+    UWORD(4611682857331458049), UWORD(4611682702712635393),
+    UWORD(4611682681237798913), UWORD(4611682591043485697),
+    UWORD(4611682483669303297), UWORD(4611682165841723393),
+    UWORD(4611682084237344769), UWORD(4611681955388325889),
+    UWORD(4611681581726171137), UWORD(4611681491531857921),
+    UWORD(4611681341208002561), UWORD(4611681302553296897),
+    UWORD(4611681147934474241), UWORD(4611680937481076737),
+    UWORD(4611680903121338369), UWORD(4611680877351534593),
+    UWORD(4611680731322646529), UWORD(4611680580998791169),
+    UWORD(4611680439264870401), UWORD(4611680374840360961),
+    UWORD(4611680078487617537), UWORD(4611680074192650241),
+    UWORD(4611679996883238913), UWORD(4611679910983892993),
+    UWORD(4611679893804023809), UWORD(4611679807904677889),
+    UWORD(4611679803609710593), UWORD(4611679627516051457),
+    UWORD(4611679550206640129), UWORD(4611679507256967169),
+    UWORD(4611679305393504257), UWORD(4611679262443831297),
+    UWORD(4611679249558929409), UWORD(4611679163659583489),
+    UWORD(4611678944616251393), UWORD(4611678828652134401),
+    UWORD(4611678764227624961), UWORD(4611678734162853889)
+};
+
+/* blocks of at most this length are transformed level by level */
+#define NTT_BASECASE 1024
+
+#define MULTI_MOD_MAX_PRIMES 64
+
+/*
+    Twiddle factors for transforms of length N = 2^depth modulo p: for the
+    butterflies of half-length m, w[m + j] = r^j where r has order 2m, and
+    winv holds the inverses. The _pr arrays hold the Shoup precomputations.
+*/
+typedef struct
+{
+    mp_limb_t p;
+    mp_limb_t pinv;
+    mp_ptr w;
+    mp_ptr w_pr;
+    mp_ptr winv;
+    mp_ptr winv_pr;
+}
+_ntt_struct;
+
+static void
+_ntt_init(_ntt_struct * T, mp_ptr tab, mp_limb_t p, slong depth)
+{
+    slong N = WORD(1) << depth, i, m;
+    mp_limb_t x, g, ginv;
+
+    T->p = p;
+    T->pinv = n_preinvert_limb(p);
+    T->w = tab;
+    T->w_pr = tab + N;
+    T->winv = tab + 2 * N;
+    T->winv_pr = tab + 3 * N;
+
+    if (N == 1)
+        return;
+
+    /* an element of order exactly 2^32, raised to the power 2^(32 - depth) */
+    for (x = 2; ; x++)
+    {
+        g = n_powmod2_ui_preinv(x, p >> 32, p, T->pinv);
+        if (n_powmod2_ui_preinv(g, UWORD(1) << 31, p, T->pinv) == p - 1)
+            break;
+    }
+
+    for (i = depth; i < 32; i++)
+        g = n_mulmod2_preinv(g, g, p, T->pinv);
+
+    ginv = n_invmod(g, p);
+
+    m = N / 2;
+    T->w[m] = T->winv[m] = 1;
+    for (i = 1; i < m; i++)
+    {
+        T->w[m + i] = n_mulmod2_preinv(T->w[m + i - 1], g, p, T->pinv);
+        T->winv[m + i] = n_mulmod2_preinv(T->winv[m + i - 1], ginv, p, T->pinv);
+    }
+
+    for (m = N / 4; m >= 1; m /= 2)
+    {
+        for (i = 0; i < m; i++)
+        {
+            T->w[m + i] = T->w[2 * m + 2 * i];
+            T->winv[m + i] = T->winv[2 * m + 2 * i];
+        }
+    }
+
+    for (i = 1; i < N; i++)
+    {
+        T->w_pr[i] = n_mulmod_precomp_shoup(T->w[i], p);
+        T->winv_pr[i] = n_mulmod_precomp_shoup(T->winv[i], p);
+    }
+}
+
+/*
+    Decimation in frequency transform, taking a in natural order to its
+    transform in bit-reversed order. Values are kept in [0, 2p).
+*/
+static void
+_ntt_dif(mp_ptr a, slong N, const _ntt_struct * T)
+{
+    mp_limb_t p = T->p, p2 = 2 * T->p, u, v;
+    mp_srcptr w = T->w, w_pr = T->w_pr;
+    slong m, s, j;
+
+    if (N > NTT_BASECASE)
+    {
+        m = N / 2;
+
+        for (j = 0; j < m; j++)
+        {
+            u = a[j];
+            v = a[j + m];
+            a[j] = (u + v >= p2) ? u + v - p2 : u + v;
+            a[j + m] = n_mulmod_shoup_lazy(w[m + j],
+                                            u - v + p2, w_pr[m + j], p);
+        }
+
+        _ntt_dif(a, m, T);
+        _ntt_dif(a + m, m, T);
+        return;
+    }
+
+    for (m = N / 2; m >= 1; m /= 2)
+    {
+        for (s = 0; s < N; s += 2 * m)
+        {
+            for (j = 0; j < m; j++)
+            {
+                u = a[s + j];
+                v = a[s + j + m];
+                a[s + j] = (u + v >= p2) ? u + v - p2 : u + v;
+                a[s + j + m] = n_mulmod_shoup_lazy(w[m + j],
+                                                u - v + p2, w_pr[m + j], p);
+            }
+        }
+    }
+}
+
+/*
+    Decimation in time inverse transform without the division by N, taking
+    a in bit-reversed order to natural order. Values are kept in [0, 2p).
+*/
+static void
+_ntt_dit_inv(mp_ptr a, slong N, const _ntt_struct * T)
+{
+    mp_limb_t p = T->p, p2 = 2 * T->p, u, v;
+    mp_srcptr w = T->winv, w_pr = T->winv_pr;
+    slong m, s, j;
+
+    if (N > NTT_BASECASE)
+    {
+        m = N / 2;
+
+        _ntt_dit_inv(a, m, T);
+        _ntt_dit_inv(a + m, m, T);
+
+        for (j = 0; j < m; j++)
+        {
+            u = a[j];
+            v = n_mulmod_shoup_lazy(w[m + j], a[j + m], w_pr[m + j], p);
+            a[j] = (u + v >= p2) ? u + v - p2 : u + v;
+            a[j + m] = (u + p2 - v >= p2) ? u - v : u + p2 - v;
+        }
+
+        return;
+    }
+
+    for (m = 1; m < N; m *= 2)
+    {
+        for (s = 0; s < N; s += 2 * m)
+        {
+            for (j = 0; j < m; j++)
+            {
+                u = a[s + j];
+                v = n_mulmod_shoup_lazy(w[m + j], a[s + j + m], w_pr[m + j], p);
+                a[s + j] = (u + v >= p2) ? u + v - p2 : u + v;
+                a[s + j + m] = (u + p2 - v >= p2) ? u - v : u + p2 - v;
+            }
+        }
+    }
+}
+
+static void
+_fmpz_vec_get_residues(mp_ptr a, const fmpz * poly, slong len, mp_limb_t p)
+{
+    slong i;
+    mp_limb_t r;
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz c = poly[i];
+
+        if (!COEFF_IS_MPZ(c))
+        {
+            r = FLINT_ABS(c) % p;
+            a[i] = (c < 0 && r != 0) ? p - r : r;
+        }
+        else
+        {
+            __mpz_struct * m = COEFF_TO_PTR(c);
+
+            r = mpn_mod_1(m->_mp_d, FLINT_ABS(m->_mp_size), p);
+            a[i] = (m->_mp_size < 0 && r != 0) ? p - r : r;
+        }
+    }
+}
+
+typedef struct
+{
+    const fmpz * poly1;
+    slong len1;
+    const fmpz * poly2;
+    slong len2;
+    slong n;
+    slong depth;
+    mp_ptr res;
+    slong start;
+    slong stop;
+}
+_mul_mod_arg_t;
+
+/*
+    Writes the first n coefficients of the product modulo the primes with
+    index in [start, stop), times the transform length, to res.
+*/
+static void
+_fmpz_poly_mullow_mod_primes(_mul_mod_arg_t * arg)
+{
+    slong N = WORD(1) << arg->depth, i, k;
+    int sqr = (arg->poly1 == arg->poly2 && arg->len1 == arg->len2);
+    mp_ptr a, b, tab;
+    mp_limb_t p, x, y;
+    _ntt_struct T[1];
+
+    a = flint_malloc(sizeof(mp_limb_t) * (sqr ? 5 : 6) * N);
+    b = a + N;
+    tab = sqr ? b : b + N;
+
+    for (k = arg->start; k < arg->stop; k++)
+    {
+        p = _fmpz_poly_multi_mod_primes[k];
+        _ntt_init(T, tab, p, arg->depth);
+
+        _fmpz_vec_get_residues(a, arg->poly1, arg->len1, p);
+        flint_mpn_zero(a + arg->len1, N - arg->len1);
+        _ntt_dif(a, N, T);
+
+        if (!sqr)
+        {
+            _fmpz_vec_get_residues(b, arg->poly2, arg->len2, p);
+            flint_mpn_zero(b + arg->len2, N - arg->len2);
+            _ntt_dif(b, N, T);
+        }
+
+        for (i = 0; i < N; i++)
+        {
+            x = (a[i] >= p) ? a[i] - p : a[i];
+            y = sqr ? x : ((b[i] >= p) ? b[i] - p : b[i]);
+            a[i] = n_mulmod2_preinv(x, y, p, T->pinv);
+        }
+
+        _ntt_dit_inv(a, N, T);
+
+        flint_mpn_copyi(arg->res + k * arg->n, a, arg->n);
+    }
+
+    flint_free(a);
+}
+
+static void *
+_fmpz_poly_mullow_mod_primes_worker(void * arg_ptr)
+{
+    _fmpz_poly_mullow_mod_primes((_mul_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Data for reconstructing c from its residues r_i modulo the primes p_i,
+    whose product is P: with y_i = r_i (P / p_i)^(-1) mod p_i, one has
+    c = sum y_i (P / p_i) - k P where k is sum y_i / p_i rounded, provided
+    that |c| < P / 4. If a modulus is given, the sum is instead taken of
+    y_i ((P / p_i) mod m) and k (m - (P mod m)), which gives c mod m.
+*/
+typedef struct
+{
+    fmpz * out;
+    slong start;
+    slong stop;
+    slong n;
+    slong np;
+    mp_srcptr res;
+    mp_srcptr yinv;
+    mp_srcptr yinv_pr;
+    const double * pinv;
+    mp_srcptr P;
+    mp_srcptr Pdiv;
+    const fmpz_mod_ctx_struct * ctx;
+    mp_srcptr mlimbs;
+}
+_crt_arg_t;
+
+static void
+_fmpz_poly_multi_mod_crt(_crt_arg_t * arg)
+{
+    slong i, j, np = arg->np, L;
+    mp_limb_t y, k, p, cy;
+    mp_ptr acc, q;
+    double s;
+    int neg;
+
+    L = (arg->ctx == NULL) ? np : arg->ctx->limbs;
+    acc = flint_malloc(sizeof(mp_limb_t) * (2 * L + 4));
+    q = acc + L + 2;
+
+    for (j = arg->start; j < arg->stop; j++)
+    {
+        flint_mpn_zero(acc, L + 2);
+        s = 0.0;
+
+        for (i = 0; i < np; i++)
+        {
+            p = _fmpz_poly_multi_mod_primes[i];
+            y = n_mulmod_shoup(arg->yinv[i], arg->res[i * arg->n + j],
+                                                    arg->yinv_pr[i], p);
+            cy = mpn_addmul_1(acc, arg->Pdiv + i * L, L, y);
+            add_ssaaaa(acc[L + 1], acc[L], acc[L + 1], acc[L], 0, cy);
+            s += (double) y * arg->pinv[i];
+        }
+
+        k = (mp_limb_t) (s + 0.5);
+
+        if (arg->ctx == NULL)
+        {
+            cy = mpn_submul_1(acc, arg->P, np, k);
+            acc[np] -= cy;
+
+            neg = ((mp_limb_signed_t) acc[np] < 0);
+            if (neg)
+                mpn_neg(acc, acc, np + 1);
+
+            _fmpz_mod_set_limbs(arg->out + j, acc, np + 1);
+            if (neg)
+                fmpz_neg(arg->out + j, arg->out + j);
+        }
+        else
+        {
+            cy = mpn_addmul_1(acc, arg->P, L, k);
+            add_ssaaaa(acc[L + 1], acc[L], acc[L + 1], acc[L], 0, cy);
+
+            if (_fmpz_mod_is_fixed(arg->ctx))
+                _fmpz_mod_mpn_reduce(acc, acc, L + 2, arg->ctx);
+            else
+                mpn_tdiv_qr(q, acc, 0, acc, L + 2, arg->mlimbs, L);
+
+            _fmpz_mod_set_limbs(arg->out + j, acc, L);
+        }
+    }
+
+    flint_free(acc);
+}
+
+static void *
+_fmpz_poly_multi_mod_crt_worker(void * arg_ptr)
+{
+    _fmpz_poly_multi_mod_crt((_crt_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static slong
+_fmpz_poly_multi_mod_num_primes(slong bits1, slong bits2, slong len1,
+                                                                slong len2)
+{
+    slong bits;
+
+    bits = FLINT_ABS(bits1) + FLINT_ABS(bits2)
+         + FLINT_BIT_COUNT(FLINT_MIN(len1, len2)) + 2;
+
+    /* each prime exceeds 2^61 */
+    return (bits + 60) / 61;
+}
+
+static void
+_fmpz_poly_mullow_multi_mod_ctx(fmpz * res, const fmpz * poly1, slong len1,
+    const fmpz * poly2, slong len2, slong n, const fmpz_mod_ctx_struct * ctx)
+{
+    pthread_t * threads;
+    _mul_mod_arg_t * margs;
+    _crt_arg_t * cargs;
+    slong i, np, depth, num_threads, L;
+    mp_ptr rs, P, Pdiv, yinv, yinv_pr, mlimbs;
+    double * pinv;
+    mp_limb_t p, t;
+    fmpz_t f;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    np = _fmpz_poly_multi_mod_num_primes(_fmpz_vec_max_bits(poly1, len1),
+                                _fmpz_vec_max_bits(poly2, len2), len1, len2);
+    depth = FLINT_CLOG2(len1 + len2 - 1);
+
+    num_threads = flint_get_num_threads();
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    /* products modulo each prime, the primes split between the threads */
+    rs = flint_malloc(sizeof(mp_limb_t) * np * n);
+    margs = flint_malloc(sizeof(_mul_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        margs[i].poly1 = poly1;
+        margs[i].len1 = len1;
+        margs[i].poly2 = poly2;
+        margs[i].len2 = len2;
+        margs[i].n = n;
+        margs[i].depth = depth;
+        margs[i].res = rs;
+        margs[i].start = (i * np) / num_threads;
+        margs[i].stop = ((i + 1) * np) / num_threads;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+                        _fmpz_poly_mullow_mod_primes_worker, &margs[i]);
+
+    _fmpz_poly_mullow_mod_primes(&margs[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(margs);
+
+    /* P and the cofactors P / p_i */
+    L = (ctx == NULL) ? np : ctx->limbs;
+    P = flint_calloc(FLINT_MAX(np + 1, L), sizeof(mp_limb_t));
+    Pdiv = flint_malloc(sizeof(mp_limb_t) * np * (np + L));
+    yinv = flint_malloc(sizeof(mp_limb_t) * 2 * np);
+    yinv_pr = yinv + np;
+    pinv = flint_malloc(sizeof(double) * np);
+    mlimbs = flint_malloc(sizeof(mp_limb_t) * L);
+
+    P[0] = 1;
+    for (i = 0; i < np; i++)
+        P[i + 1] = mpn_mul_1(P, P, i + 1, _fmpz_poly_multi_mod_primes[i]);
+
+    for (i = 0; i < np; i++)
+    {
+        p = _fmpz_poly_multi_mod_primes[i];
+        mpn_divrem_1(Pdiv + i * np, 0, P, np, p);
+
+        /* fold in the division by the transform length */
+        t = n_invmod(mpn_mod_1(Pdiv + i * np, np, p), p);
+        t = n_mulmod2_preinv(t, n_invmod(
+                            n_pow(2, depth) % p, p), p, n_preinvert_limb(p));
+        yinv[i] = t;
+        yinv_pr[i] = n_mulmod_precomp_shoup(t, p);
+        pinv[i] = 1.0 / (double) p;
+    }
+
+    if (ctx != NULL)
+    {
+        /* replace P / p_i by (P / p_i) mod m and P by m - (P mod m) */
+        fmpz_init(f);
+
+        for (i = 0; i < np; i++)
+        {
+            _fmpz_mod_set_limbs(f, Pdiv + i * np, np);
+            fmpz_mod(f, f, fmpz_mod_ctx_modulus(ctx));
+            _fmpz_mod_get_limbs(Pdiv + np * np + i * L, f, L);
+        }
+
+        _fmpz_mod_set_limbs(f, P, np);
+        fmpz_mod(f, f, fmpz_mod_ctx_modulus(ctx));
+        fmpz_sub(f, fmpz_mod_ctx_modulus(ctx), f);
+        _fmpz_mod_get_limbs(P, f, L);
+
+        _fmpz_mod_get_limbs(mlimbs, fmpz_mod_ctx_modulus(ctx), L);
+
+        fmpz_clear(f);
+    }
+
+    /* reconstruction, the coefficients split between the threads */
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, n / 16));
+    cargs = flint_malloc(sizeof(_crt_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        cargs[i].out = res;
+        cargs[i].start = (i * n) / num_threads;
+        cargs[i].stop = ((i + 1) * n) / num_threads;
+        cargs[i].n = n;
+        cargs[i].np = np;
+        cargs[i].res = rs;
+        cargs[i].yinv = yinv;
+        cargs[i].yinv_pr = yinv_pr;
+        cargs[i].pinv = pinv;
+        cargs[i].P = P;
+        cargs[i].Pdiv = (ctx == NULL) ? Pdiv : Pdiv + np * np;
+        cargs[i].ctx = ctx;
+        cargs[i].mlimbs = mlimbs;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+                        _fmpz_poly_multi_mod_crt_worker, &cargs[i]);
+
+    _fmpz_poly_multi_mod_crt(&cargs[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(cargs);
+    flint_free(threads);
+    flint_free(rs);
+    flint_free(P);
+    flint_free(Pdiv);
+    flint_free(yinv);
+    flint_free(pinv);
+    flint_free(mlimbs);
+}
+
+static int
+_fmpz_poly_mullow_multi_mod_fits(const fmpz * poly1, slong len1,
+                                        const fmpz * poly2, slong len2)
+{
+    slong np;
+
+    np = _fmpz_poly_multi_mod_num_primes(_fmpz_vec_max_bits(poly1, len1),
+                                _fmpz_vec_max_bits(poly2, len2), len1, len2);
+
+    return FLINT_CLOG2(len1 + len2 - 1) <= 32 && np <= MULTI_MOD_MAX_PRIMES;
+}
+
+#endif
+
+void
+_fmpz_poly_mullow_multi_mod(fmpz * res, const fmpz * poly1, slong len1,
+                                    const fmpz * poly2, slong len2, slong n)
+{
+#if FLINT64
+    if (_fmpz_poly_mullow_multi_mod_fits(poly1, FLINT_MIN(len1, n),
+                                            poly2, FLINT_MIN(len2, n)))
+    {
+        _fmpz_poly_mullow_multi_mod_ctx(res, poly1, len1, poly2, len2, n, NULL);
+        return;
+    }
+#endif
+
+    _fmpz_poly_mullow_SS(res, poly1, len1, poly2, len2, n);
+}
+
+void
+_fmpz_poly_mullow_multi_mod_reduce(fmpz * res, const fmpz * poly1,
+    slong len1, const fmpz * poly2, slong len2, slong n, const fmpz_t m)
+{
+#if FLINT64
+    if (_fmpz_poly_mullow_multi_mod_fits(poly1, FLINT_MIN(len1, n),
+                                            poly2, FLINT_MIN(len2, n)))
+    {
+        fmpz_mod_ctx_t ctx;
+
+        fmpz_mod_ctx_init(ctx, m);
+        _fmpz_poly_mullow_multi_mod_ctx(res, poly1, len1, poly2, len2, n, ctx);
+        fmpz_mod_ctx_clear(ctx);
+        return;
+    }
+#endif
+
+    _fmpz_poly_mullow_SS(res, poly1, len1, poly2, len2, n);
+    _fmpz_vec_scalar_mod_fmpz(res, res, n, m);
+}
+
+void
+fmpz_poly_mullow_multi_mod(fmpz_poly_t res,
+                    const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = poly2->length;
+
+    if (len1 == 0 || len2 == 0 || n == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    if (len1 <= 2 || len2 <= 2 || n <= 2)
+    {
+        fmpz_poly_mullow_classical(res, poly1, poly2, n);
+        return;
+    }
+
+    n = FLINT_MIN(n, len1 + len2 - 1);
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, n);
+        fmpz_poly_mullow_multi_mod(t, poly1, poly2, n);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+        return;
+    }
+
+    fmpz_poly_fit_length(res, n);
+
+    if (len1 >= len2)
+        _fmpz_poly_mullow_multi_mod(res->coeffs, poly1->coeffs, len1,
+                                                 poly2->coeffs, len2, n);
+    else
+        _fmpz_poly_mullow_multi_mod(res->coeffs, poly2->coeffs, len2,
+                                                 poly1->coeffs, len1, n);
+
+    _fmpz_poly_set_length(res, n);
+    _fmpz_poly_normalise(res);
+}
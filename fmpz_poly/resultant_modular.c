@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2014 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
@@ -16,6 +18,55 @@
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    const fmpz * A;
+    const fmpz * B;
+    slong len1;
+    slong len2;
+    mp_ptr rarr;
+    mp_srcptr parr;
+    slong p0;
+    slong p1;
+}
+resultant_mod_arg_t;
+
+static void
+_fmpz_poly_resultant_mod(resultant_mod_arg_t * arg)
+{
+    mp_ptr a, b;
+    nmod_t mod;
+    slong i;
+
+    a = _nmod_vec_init(arg->len1);
+    b = _nmod_vec_init(arg->len2);
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        nmod_init(&mod, arg->parr[i]);
+
+        /* reduce polynomials modulo p */
+        _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+        _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+        /* compute resultant over Z/pZ */
+        arg->rarr[i] = _nmod_poly_resultant(a, arg->len1,
+                                                b, arg->len2, mod);
+    }
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+}
+
+static void *
+_fmpz_poly_resultant_mod_worker(void * arg_ptr)
+{
+    _fmpz_poly_resultant_mod((resultant_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
 
 void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
@@ -26,9 +77,11 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_comb_temp_t comb_temp;
     fmpz_t ac, bc, l, modulus;
     fmpz * A, * B, * lead_A, * lead_B;
-    mp_ptr a, b, rarr, parr;
+    mp_ptr rarr, parr;
     mp_limb_t p;
-    nmod_t mod;
+    slong num_threads;
+    resultant_mod_arg_t * args;
+    pthread_t * threads;
     
     /* special case, one of the polys is a constant */
     if (len2 == 1) /* if len1 == 1 then so does len2 */
@@ -81,30 +134,47 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_set_ui(modulus, 1);
     fmpz_zero(res);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    
     for (i = 0; curr_bits < bound; )
     {
-        /* get new prime and initialise modulus */
+        /* get new prime */
         p = n_nextprime(p, 0);
         if (fmpz_fdiv_ui(l, p) == 0)
             continue;
         
         curr_bits += pbits;
+        parr[i++] = p;
+    }
 
-        nmod_init(&mod, p);
+    /* compute the resultants modulo the primes in parallel */
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(resultant_mod_arg_t) * num_threads);
 
-        /* compute resultant over Z/pZ */
-        parr[i] = p;
-        rarr[i++] = _nmod_poly_resultant(a, len1, b, len2, mod);
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].A = A;
+        args[i].B = B;
+        args[i].len1 = len1;
+        args[i].len2 = len2;
+        args[i].rarr = rarr;
+        args[i].parr = parr;
+        args[i].p0 = (num_primes * i) / num_threads;
+        args[i].p1 = (num_primes * (i + 1)) / num_threads;
     }
 
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+            _fmpz_poly_resultant_mod_worker, &args[i]);
+
+    _fmpz_poly_resultant_mod(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+
     fmpz_comb_init(comb, parr, num_primes);
     fmpz_comb_temp_init(comb_temp, comb);
     
@@ -114,9 +184,6 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_comb_temp_clear(comb_temp);
     fmpz_comb_clear(comb);
         
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-
     _nmod_vec_clear(parr);
     _nmod_vec_clear(rarr);
     
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -137,6 +138,12 @@ void _fmpz_poly_sqr(fmpz * res, const fmpz * poly, slong len)
 
     limbs = (bits + FLINT_BITS - 1) / FLINT_BITS;
 
+    if (_fmpz_poly_sqr_use_multi_mod(len, limbs))
+    {
+        _fmpz_poly_mul_multi_mod(res, poly, len, poly, len);
+        return;
+    }
+
     if (len < 16 && limbs > 12)
         _fmpz_poly_sqr_karatsuba(res, poly, len);
     else if (limbs <= 4)
@@ -2,6 +2,7 @@
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010, 2011 Sebastian Pancratz
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -146,6 +147,12 @@ void _fmpz_poly_sqrlow(fmpz * res, const fmpz * poly, slong len, slong n)
 
     limbs = (bits + FLINT_BITS - 1) / FLINT_BITS;
 
+    if (_fmpz_poly_sqr_use_multi_mod(len, limbs))
+    {
+        _fmpz_poly_mullow_multi_mod(res, poly, len, poly, len, n);
+        return;
+    }
+
     if (n < 16 && limbs > 12)
     {
         int i;
@@ -45,6 +45,8 @@ main(void)
     {
         fmpz_poly_t a, b, c;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(a);
         fmpz_poly_init(b);
         fmpz_poly_init(c);
@@ -54,6 +56,8 @@ main(void)
         fmpz_poly_gcd_modular(a, b, c);
         fmpz_poly_gcd_modular(b, b, c);
 
+        flint_set_num_threads(1);
+
         result = (fmpz_poly_equal(a, b) && _t_gcd_is_canonical(a));
         if (!result)
         {
@@ -73,6 +77,8 @@ main(void)
     {
         fmpz_poly_t a, b, c;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(a);
         fmpz_poly_init(b);
         fmpz_poly_init(c);
@@ -82,6 +88,8 @@ main(void)
         fmpz_poly_gcd_modular(a, b, c);
         fmpz_poly_gcd_modular(c, b, c);
 
+        flint_set_num_threads(1);
+
         result = (fmpz_poly_equal(a, c) && _t_gcd_is_canonical(a));
         if (!result)
         {
@@ -101,6 +109,8 @@ main(void)
     {
         fmpz_poly_t a, d, f, g, q, r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(a);
         fmpz_poly_init(d);
         fmpz_poly_init(f);
@@ -115,6 +125,8 @@ main(void)
         fmpz_poly_mul(g, a, g);
         fmpz_poly_gcd_modular(d, f, g);
 
+        flint_set_num_threads(1);
+
         fmpz_poly_divrem_divconquer(q, r, d, a);
 
         result = fmpz_poly_is_zero(r) && _t_gcd_is_canonical(d);
@@ -141,6 +153,8 @@ main(void)
     {
         fmpz_poly_t a, d, f, g, q, r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(a);
         fmpz_poly_init(d);
         fmpz_poly_init(f);
@@ -158,6 +172,8 @@ main(void)
         fmpz_poly_mul(g, a, g);
         fmpz_poly_gcd_modular(d, f, g);
 
+        flint_set_num_threads(1);
+
         if (!_t_gcd_is_canonical(a)) fmpz_poly_neg(a, a);
 
         result = fmpz_poly_equal(d, a) && _t_gcd_is_canonical(d);
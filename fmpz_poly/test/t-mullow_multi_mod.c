@@ -0,0 +1,171 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mullow_multi_mod....");
+    fflush(stdout);
+
+    /* Check aliasing of a and b */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+        slong len, trunc;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 200);
+        fmpz_poly_randtest(c, state, n_randint(state, 50), 200);
+
+        len = b->length + c->length - 1;
+        trunc = (len <= 0) ? 0 : n_randint(state, b->length + c->length);
+
+        fmpz_poly_mullow_multi_mod(a, b, c, trunc);
+        fmpz_poly_mullow_multi_mod(b, b, c, trunc);
+
+        result = (fmpz_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    /* Compare with mul_KS, also squaring, with several threads */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        slong len, trunc;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+        fmpz_poly_randtest(b, state, n_randint(state, 300),
+                                        1 + n_randint(state, 2000));
+
+        if (n_randint(state, 4) == 0)
+            fmpz_poly_set(c, b);
+        else
+            fmpz_poly_randtest(c, state, n_randint(state, 300),
+                                        1 + n_randint(state, 2000));
+
+        len = b->length + c->length - 1;
+        trunc = (len <= 0) ? 0 : n_randint(state, b->length + c->length - 1);
+
+        fmpz_poly_mul_KS(a, b, c);
+        fmpz_poly_truncate(a, trunc);
+
+        if (fmpz_poly_equal(b, c))
+            fmpz_poly_mullow_multi_mod(d, b, b, trunc);
+        else
+            fmpz_poly_mullow_multi_mod(d, b, c, trunc);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    /* Check the product reduced modulo m */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        fmpz_t m;
+        slong len, trunc;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_init(m);
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+
+        fmpz_randtest_not_zero(m, state, 1 + n_randint(state, 400));
+        fmpz_abs(m, m);
+        if (n_randint(state, 4) == 0)
+        {
+            fmpz_one(m);
+            fmpz_mul_2exp(m, m, 64 * (1 + n_randint(state, 5)));
+            fmpz_sub_ui(m, m, n_randint(state, 2));
+        }
+
+        fmpz_poly_randtest_not_zero(b, state, 1 + n_randint(state, 200),
+                                        1 + n_randint(state, 500));
+        fmpz_poly_randtest_not_zero(c, state, 1 + n_randint(state, 200),
+                                        1 + n_randint(state, 500));
+
+        len = b->length + c->length - 1;
+        trunc = 1 + n_randint(state, len);
+
+        fmpz_poly_mullow(a, b, c, trunc);
+        fmpz_poly_scalar_mod_fmpz(a, a, m);
+
+        fmpz_poly_fit_length(d, trunc);
+        _fmpz_poly_mullow_multi_mod_reduce(d->coeffs, b->coeffs, b->length,
+                                    c->coeffs, c->length, trunc, m);
+        _fmpz_poly_set_length(d, trunc);
+        _fmpz_poly_normalise(d);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (reduce):\n");
+            fmpz_print(m), flint_printf("\n\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_clear(m);
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -64,6 +64,8 @@ main(void)
         fmpz_t a, b, c, d;
         fmpz_poly_t f, g, h, p;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_init(a);
         fmpz_init(b);
         fmpz_init(c);
@@ -82,6 +84,8 @@ main(void)
         fmpz_poly_mul(p, f, g);
         fmpz_poly_resultant_modular(d, p, h);
 
+        flint_set_num_threads(1);
+
         result = (fmpz_equal(c, d));
         if (!result)
         {
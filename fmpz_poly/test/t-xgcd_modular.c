@@ -35,6 +35,8 @@ main(void)
         fmpz_poly_t d, f, g, s, t;
         fmpz_t r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(d);
         fmpz_poly_init(f);
         fmpz_poly_init(g);
@@ -55,6 +57,8 @@ main(void)
         fmpz_poly_mul(t, t, g);
         fmpz_poly_add(s, s, t);
 
+        flint_set_num_threads(1);
+
         result = fmpz_poly_equal_fmpz(s, r);
         if (!result)
         {
@@ -82,6 +86,8 @@ main(void)
         fmpz_poly_t d, f, g, s, t;
         fmpz_t r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(d);
         fmpz_poly_init(f);
         fmpz_poly_init(g);
@@ -102,6 +108,8 @@ main(void)
         fmpz_poly_mul(t, t, g);
         fmpz_poly_add(s, s, t);
 
+        flint_set_num_threads(1);
+
         result = fmpz_poly_equal_fmpz(s, r);
         if (!result)
         {
@@ -129,6 +137,8 @@ main(void)
         fmpz_poly_t d, f, g, s, t;
         fmpz_t r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(d);
         fmpz_poly_init(f);
         fmpz_poly_init(g);
@@ -146,6 +156,8 @@ main(void)
         
         fmpz_poly_xgcd_modular(r, s, t, f, g);
         fmpz_poly_xgcd_modular(r, f, t, f, g);
+
+        flint_set_num_threads(1);
         
         result = (fmpz_poly_equal(s, f) || fmpz_is_zero(r));
         if (!result)
@@ -170,6 +182,8 @@ main(void)
         fmpz_poly_t d, f, g, s, t;
         fmpz_t r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(d);
         fmpz_poly_init(f);
         fmpz_poly_init(g);
@@ -187,6 +201,8 @@ main(void)
         
         fmpz_poly_xgcd_modular(r, s, t, f, g);
         fmpz_poly_xgcd_modular(r, g, t, f, g);
+
+        flint_set_num_threads(1);
         
         result = (fmpz_poly_equal(s, g) || fmpz_is_zero(r));
         if (!result)
@@ -211,6 +227,8 @@ main(void)
         fmpz_poly_t d, f, g, s, t;
         fmpz_t r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(d);
         fmpz_poly_init(f);
         fmpz_poly_init(g);
@@ -228,6 +246,8 @@ main(void)
         
         fmpz_poly_xgcd_modular(r, s, t, f, g);
         fmpz_poly_xgcd_modular(r, s, f, f, g);
+
+        flint_set_num_threads(1);
         
         result = (fmpz_poly_equal(t, f) || fmpz_is_zero(r));
         if (!result)
@@ -252,6 +272,8 @@ main(void)
         fmpz_poly_t d, f, g, s, t;
         fmpz_t r;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         fmpz_poly_init(d);
         fmpz_poly_init(f);
         fmpz_poly_init(g);
@@ -269,6 +291,8 @@ main(void)
         
         fmpz_poly_xgcd_modular(r, s, t, f, g);
         fmpz_poly_xgcd_modular(r, s, g, f, g);
+
+        flint_set_num_threads(1);
         
         result = (fmpz_poly_equal(t, g) || fmpz_is_zero(r));
         if (!result)
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 William Hart
     Copyright (C) 2011 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -10,6 +11,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
@@ -17,15 +19,110 @@
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    const fmpz * poly1;
+    const fmpz * poly2;
+    const fmpz * s;
+    const fmpz * t;
+    slong len1;
+    slong len2;
+    int verify;
+    mp_ptr * S;
+    mp_ptr * T;
+    mp_srcptr R;
+    int * ok;
+    mp_srcptr primes;
+    slong p0;
+    slong p1;
+}
+xgcd_mod_arg_t;
+
+/*
+    For each prime, either computes the cofactors S, T with A S + B T = R
+    modulo p, or, if arg->verify is set, checks whether the current lifts
+    s, t satisfy this modulo p.
+*/
+static void
+_fmpz_poly_xgcd_mod(xgcd_mod_arg_t * arg)
+{
+    const slong len1 = arg->len1, len2 = arg->len2;
+    mp_ptr G, A, B, T1, T2;
+    slong i, tlen;
+    nmod_t mod;
+
+    G = _nmod_vec_init(len2 + len1 + len2 + 2 * (len1 + len2 - 1));
+    A = G + len2;
+    B = A + len1;
+    T1 = B + len2;
+    T2 = T1 + (len1 + len2 - 1);
+
+    for (i = arg->p0; i < arg->p1; i++)
+    {
+        mp_ptr S = arg->S[i], T = arg->T[i];
+
+        nmod_init(&mod, arg->primes[i]);
+
+        /* Reduce polynomials modulo p */
+        _fmpz_vec_get_nmod_vec(A, arg->poly1, len1, mod);
+        _fmpz_vec_get_nmod_vec(B, arg->poly2, len2, mod);
+
+        if (arg->verify)
+        {
+            /* Multiply out A*S + B*T to see if it is R mod p */
+            _fmpz_vec_get_nmod_vec(S, arg->s, len2, mod);
+            _fmpz_vec_get_nmod_vec(T, arg->t, len1, mod);
+
+            _nmod_poly_mul(T1, A, len1, S, len2, mod); 
+            _nmod_poly_mul(T2, T, len1, B, len2, mod);
+            _nmod_vec_add(T1, T1, T2, len1 + len2 - 1, mod);
+            tlen = len1 + len2 - 1;
+            FMPZ_VEC_NORM(T1, tlen);
+
+            arg->ok[i] = (tlen == 1 && T1[0] == arg->R[i]);
+        }
+        else
+        {
+            mp_limb_t RGinv;
+
+            /* Compute xgcd mod p, which need not fill all of S and T */
+            _nmod_vec_zero(S, len2);
+            _nmod_vec_zero(T, len1);
+            _nmod_poly_xgcd(G, S, T, A, len1, B, len2, mod);
+            RGinv = n_invmod(G[0], mod.n);
+            RGinv = n_mulmod2_preinv(RGinv, arg->R[i], mod.n, mod.ninv);
+
+            /* Scale appropriately */
+            _nmod_vec_scalar_mul_nmod(S, S, len2, RGinv, mod);
+            _nmod_vec_scalar_mul_nmod(T, T, len1, RGinv, mod);
+        }
+    }
+
+    _nmod_vec_clear(G);
+}
+
+static void *
+_fmpz_poly_xgcd_mod_worker(void * arg_ptr)
+{
+    _fmpz_poly_xgcd_mod((xgcd_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t, 
                              const fmpz * poly1, slong len1, 
                              const fmpz * poly2, slong len2)
 {
-    mp_ptr G, S, T, A, B, T1, T2;
+    xgcd_mod_arg_t * args;
+    pthread_t * threads;
+    mp_ptr primes, R, * S, * T;
+    int * ok;
     fmpz_t prod;
     int stabilised = 0, first;
     mp_limb_t p;
     mp_bitcnt_t s_bits = 0, t_bits = 0;
+    slong k, num, num_threads;
 
     /* Compute resultant of input polys */
     _fmpz_poly_resultant(r, poly1, len1, poly2, len2);
@@ -41,98 +138,121 @@ void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t,
 
     p = (UWORD(1) << (FLINT_BITS - 1));
 
-    G = _nmod_vec_init(4 * len1 + 5 * len2 - 2);
-    S = G + len2;
-    T = S + len2;
-    A = T + len1;
-    B = A + len1;
-    T1 = B + len2;
-    T2 = T1 + (len1 + len2 - 1);
+    /* primes are handled in batches of one per thread */
+    num_threads = flint_get_num_threads();
 
-    _nmod_vec_zero(S, len2 + len1); /* S = T = 0 */
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(xgcd_mod_arg_t) * num_threads);
+    primes = flint_malloc(sizeof(mp_limb_t) * num_threads);
+    R = flint_malloc(sizeof(mp_limb_t) * num_threads);
+    ok = flint_malloc(sizeof(int) * num_threads);
+    S = flint_malloc(sizeof(mp_ptr) * num_threads);
+    T = flint_malloc(sizeof(mp_ptr) * num_threads);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        S[k] = _nmod_vec_init(len2 + len1);
+        T[k] = S[k] + len2;
+
+        args[k].poly1 = poly1;
+        args[k].poly2 = poly2;
+        args[k].s = s;
+        args[k].t = t;
+        args[k].len1 = len1;
+        args[k].len2 = len2;
+        args[k].S = S;
+        args[k].T = T;
+        args[k].R = R;
+        args[k].ok = ok;
+        args[k].primes = primes;
+    }
 
     first = 1;
 
     for (;;) 
     {
-        mp_limb_t R;
-        nmod_t mod;
-
-        /* Get next prime */
-        p = n_nextprime(p, 0);
-
-        /* Resultant mod p */
-        R = fmpz_fdiv_ui(r, p);
-
-        /* If p divides resultant or either leading coeff, discard p */
-        if ((fmpz_fdiv_ui(poly1 + len1 - 1, p) == WORD(0)) || 
-            (fmpz_fdiv_ui(poly2 + len2 - 1, p) == WORD(0)) || (R == 0))
-            continue;
-
-        nmod_init(&mod, p);
-
-        /* Reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(A, poly1, len1, mod);
-        _fmpz_vec_get_nmod_vec(B, poly2, len2, mod);
-
-        if (stabilised) /* CRT has stabilised, probably don't need more xgcds */
+        /* Get a batch of primes */
+        for (num = 0; num < num_threads; )
         {
-            slong tlen;
+            p = n_nextprime(p, 0);
 
-            /* Multiply out A*S + B*T to see if it is R mod p */
-            _fmpz_vec_get_nmod_vec(S, s, len2, mod);
-            _fmpz_vec_get_nmod_vec(T, t, len1, mod);
+            /* Resultant mod p */
+            R[num] = fmpz_fdiv_ui(r, p);
 
-            _nmod_poly_mul(T1, A, len1, S, len2, mod); 
-            _nmod_poly_mul(T2, T, len1, B, len2, mod);
-            _nmod_vec_add(T1, T1, T2, len1 + len2 - 1, mod);
-            tlen = len1 + len2 - 1;
-            FMPZ_VEC_NORM(T1, tlen);
+            /* If p divides resultant or either leading coeff, discard p */
+            if ((fmpz_fdiv_ui(poly1 + len1 - 1, p) == WORD(0)) || 
+                (fmpz_fdiv_ui(poly2 + len2 - 1, p) == WORD(0)) || (R[num] == 0))
+                continue;
 
-            if (tlen == 1 && T1[0] == R) /* It is, so this prime is good */
-                fmpz_mul_ui(prod, prod, p);
-            else
-                stabilised = 0; /* It's not, keep going with xgcds */   
+            primes[num++] = p;
         }
 
-        if (!stabilised) /* Need to keep computing xgcds mod p */
+        /*
+            Once the CRT has stabilised we probably don't need more xgcds,
+            so the batch only checks the current lifts modulo the new primes.
+        */
+        for (k = 0; k < num_threads; k++)
         {
-            mp_limb_t RGinv;
+            args[k].verify = stabilised;
+            args[k].p0 = k;
+            args[k].p1 = k + 1;
+        }
 
-            /* Compute xgcd mod p */
-            _nmod_poly_xgcd(G, S, T, A, len1, B, len2, mod);
-            RGinv = n_invmod(G[0], mod.n);
-            RGinv = n_mulmod2_preinv(RGinv, R, mod.n, mod.ninv);
+        for (k = 0; k < num_threads - 1; k++)
+            pthread_create(&threads[k], NULL,
+                _fmpz_poly_xgcd_mod_worker, &args[k]);
 
-            /* Scale appropriately */
-            _nmod_vec_scalar_mul_nmod(S, S, len2, RGinv, mod);
-            _nmod_vec_scalar_mul_nmod(T, T, len1, RGinv, mod);
+        _fmpz_poly_xgcd_mod(&args[num_threads - 1]);
 
-            if (first) /* First time around set s and t to S and T */
-            {
-                _fmpz_vec_set_nmod_vec(s, S, len2, mod);
-                _fmpz_vec_set_nmod_vec(t, T, len1, mod);
-                fmpz_set_ui(prod, p);
+        for (k = 0; k < num_threads - 1; k++)
+            pthread_join(threads[k], NULL);
 
-                stabilised = 1; /* Optimise the case where one prime is enough */
-                first = 0;
+        if (stabilised)
+        {
+            for (k = 0; k < num; k++)
+            {
+                if (ok[k]) /* It is, so this prime is good */
+                    fmpz_mul_ui(prod, prod, primes[k]);
+                else
+                    stabilised = 0; /* It's not, keep going with xgcds */
             }
-            else /* Otherwise do CRT */
+        }
+        else
+        {
+            for (k = 0; k < num; k++)
             {
-                mp_bitcnt_t new_s_bits, new_t_bits;
-
-                _fmpz_poly_CRT_ui(s, s, len2, prod, S, len2, mod.n, mod.ninv, 1);
-                _fmpz_poly_CRT_ui(t, t, len1, prod, T, len1, mod.n, mod.ninv, 1);
-                fmpz_mul_ui(prod, prod, p);
-
-                /* Check to see if CRT has stabilised */
-                new_s_bits = FLINT_ABS(_fmpz_vec_max_bits(s, len2));
-                new_t_bits = FLINT_ABS(_fmpz_vec_max_bits(t, len1));
-
-                stabilised = (s_bits == new_s_bits && t_bits == new_t_bits);
-
-                s_bits = new_s_bits;
-                t_bits = new_t_bits;
+                nmod_t mod;
+
+                nmod_init(&mod, primes[k]);
+
+                if (first) /* First time around set s and t to S and T */
+                {
+                    _fmpz_vec_set_nmod_vec(s, S[k], len2, mod);
+                    _fmpz_vec_set_nmod_vec(t, T[k], len1, mod);
+                    fmpz_set_ui(prod, primes[k]);
+
+                    stabilised = 1; /* Optimise the case where one prime is enough */
+                    first = 0;
+                }
+                else /* Otherwise do CRT */
+                {
+                    mp_bitcnt_t new_s_bits, new_t_bits;
+
+                    _fmpz_poly_CRT_ui(s, s, len2, prod, S[k], len2,
+                                                    mod.n, mod.ninv, 1);
+                    _fmpz_poly_CRT_ui(t, t, len1, prod, T[k], len1,
+                                                    mod.n, mod.ninv, 1);
+                    fmpz_mul_ui(prod, prod, primes[k]);
+
+                    /* Check to see if CRT has stabilised */
+                    new_s_bits = FLINT_ABS(_fmpz_vec_max_bits(s, len2));
+                    new_t_bits = FLINT_ABS(_fmpz_vec_max_bits(t, len1));
+
+                    stabilised = (s_bits == new_s_bits && t_bits == new_t_bits);
+
+                    s_bits = new_s_bits;
+                    t_bits = new_t_bits;
+                }
             }
         }
 
@@ -154,7 +274,16 @@ void _fmpz_poly_xgcd_modular(fmpz_t r, fmpz * s, fmpz * t,
         }
     }
 
-    _nmod_vec_clear(G);
+    for (k = 0; k < num_threads; k++)
+        _nmod_vec_clear(S[k]);
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(primes);
+    flint_free(R);
+    flint_free(ok);
+    flint_free(S);
+    flint_free(T);
     fmpz_clear(prod);
 }
 
@@ -0,0 +1,134 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FMPZ_SPARSE_MAT_H
+#define FMPZ_SPARSE_MAT_H
+
+#ifdef FMPZ_SPARSE_MAT_INLINES_C
+#define FMPZ_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define FMPZ_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "nmod_sparse_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Compressed sparse row layout, as for nmod_sparse_mat: the nonzero
+    entries of row i are entries[k] in column cols[k] for
+    row_start[i] <= k < row_start[i + 1], with increasing column indices.
+*/
+typedef struct
+{
+    fmpz * entries;
+    slong * cols;
+    slong * row_start;
+    slong r;
+    slong c;
+    slong alloc;
+}
+fmpz_sparse_mat_struct;
+
+typedef fmpz_sparse_mat_struct fmpz_sparse_mat_t[1];
+
+/* Memory management  ********************************************************/
+
+FLINT_DLL void fmpz_sparse_mat_init(fmpz_sparse_mat_t M,
+                                                    slong rows, slong cols);
+
+FLINT_DLL void fmpz_sparse_mat_clear(fmpz_sparse_mat_t M);
+
+FLINT_DLL void fmpz_sparse_mat_fit_nnz(fmpz_sparse_mat_t M, slong nnz);
+
+FLINT_DLL void fmpz_sparse_mat_swap(fmpz_sparse_mat_t M1, fmpz_sparse_mat_t M2);
+
+FLINT_DLL void fmpz_sparse_mat_set(fmpz_sparse_mat_t M1,
+                                                const fmpz_sparse_mat_t M2);
+
+FLINT_DLL void fmpz_sparse_mat_zero(fmpz_sparse_mat_t M);
+
+/* Basic properties **********************************************************/
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_nrows(const fmpz_sparse_mat_t M)
+{
+    return M->r;
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_ncols(const fmpz_sparse_mat_t M)
+{
+    return M->c;
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_nnz(const fmpz_sparse_mat_t M)
+{
+    return M->row_start[M->r];
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_row_length(const fmpz_sparse_mat_t M, slong i)
+{
+    return M->row_start[i + 1] - M->row_start[i];
+}
+
+FLINT_DLL int fmpz_sparse_mat_equal(const fmpz_sparse_mat_t M1,
+                                                const fmpz_sparse_mat_t M2);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void fmpz_sparse_mat_set_triplets(fmpz_sparse_mat_t M,
+    const slong * rows, const slong * cols, const fmpz * vals, slong len);
+
+FLINT_DLL void fmpz_sparse_mat_set_fmpz_mat(fmpz_sparse_mat_t M,
+                                                        const fmpz_mat_t A);
+
+FLINT_DLL void fmpz_sparse_mat_get_fmpz_mat(fmpz_mat_t A,
+                                                const fmpz_sparse_mat_t M);
+
+FLINT_DLL void fmpz_sparse_mat_get_nmod_sparse_mat(nmod_sparse_mat_t Amod,
+                                                const fmpz_sparse_mat_t A);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void fmpz_sparse_mat_randtest(fmpz_sparse_mat_t M,
+                    flint_rand_t state, slong row_nnz, mp_bitcnt_t bits);
+
+FLINT_DLL void fmpz_sparse_mat_randtest_square(fmpz_sparse_mat_t M,
+                                    flint_rand_t state, mp_bitcnt_t bits);
+
+/* Transpose and matrix-vector multiplication ********************************/
+
+FLINT_DLL void fmpz_sparse_mat_transpose(fmpz_sparse_mat_t B,
+                                                const fmpz_sparse_mat_t A);
+
+FLINT_DLL void fmpz_sparse_mat_mul_vec(fmpz * y,
+                                const fmpz_sparse_mat_t A, const fmpz * x);
+
+/* Solving *******************************************************************/
+
+FLINT_DLL int fmpz_sparse_mat_solve_wiedemann(fmpz * x, fmpz_t den,
+                            const fmpz_sparse_mat_t A, const fmpz * b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
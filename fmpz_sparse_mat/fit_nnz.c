@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_fit_nnz(fmpz_sparse_mat_t M, slong nnz)
+{
+    if (nnz > M->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2 * M->alloc);
+
+        M->entries = flint_realloc(M->entries, nnz * sizeof(fmpz));
+        M->cols = flint_realloc(M->cols, nnz * sizeof(slong));
+        flint_mpn_zero((mp_ptr) (M->entries + M->alloc), nnz - M->alloc);
+        M->alloc = nnz;
+    }
+}
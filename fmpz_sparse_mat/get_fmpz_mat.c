@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_fmpz_mat(fmpz_mat_t A, const fmpz_sparse_mat_t M)
+{
+    slong i, k;
+
+    fmpz_mat_zero(A);
+
+    for (i = 0; i < M->r; i++)
+        for (k = M->row_start[i]; k < M->row_start[i + 1]; k++)
+            fmpz_set(fmpz_mat_entry(A, i, M->cols[k]), M->entries + k);
+}
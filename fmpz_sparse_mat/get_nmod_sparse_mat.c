@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_nmod_sparse_mat(nmod_sparse_mat_t Amod,
+                                                const fmpz_sparse_mat_t A)
+{
+    slong i, k, nnz;
+    mp_limb_t v;
+
+    nmod_sparse_mat_fit_nnz(Amod, fmpz_sparse_mat_nnz(A));
+
+    /* entries divisible by the modulus are dropped */
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        Amod->row_start[i] = nnz;
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            v = fmpz_fdiv_ui(A->entries + k, Amod->mod.n);
+
+            if (v != 0)
+            {
+                Amod->cols[nnz] = A->cols[k];
+                Amod->entries[nnz] = v;
+                nnz++;
+            }
+        }
+    }
+
+    Amod->row_start[A->r] = nnz;
+}
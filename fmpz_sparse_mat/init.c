@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_init(fmpz_sparse_mat_t M, slong rows, slong cols)
+{
+    M->entries = NULL;
+    M->cols = NULL;
+    M->row_start = flint_calloc(rows + 1, sizeof(slong));
+    M->r = rows;
+    M->c = cols;
+    M->alloc = 0;
+}
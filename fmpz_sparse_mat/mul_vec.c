@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_mul_vec(fmpz * y, const fmpz_sparse_mat_t A, const fmpz * x)
+{
+    slong i, k;
+
+    for (i = 0; i < A->r; i++)
+    {
+        fmpz_zero(y + i);
+
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+            fmpz_addmul(y + i, A->entries + k, x + A->cols[k]);
+    }
+}
@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_randtest(fmpz_sparse_mat_t M, flint_rand_t state,
+                                        slong row_nnz, mp_bitcnt_t bits)
+{
+    slong * rows, * cols;
+    fmpz * vals;
+    slong i, j, k, len;
+
+    if (M->c == 0)
+    {
+        fmpz_sparse_mat_zero(M);
+        return;
+    }
+
+    len = M->r * row_nnz;
+    rows = flint_malloc(len * sizeof(slong));
+    cols = flint_malloc(len * sizeof(slong));
+    vals = _fmpz_vec_init(len);
+
+    /* repeated columns are merged, so rows may be shorter than row_nnz */
+    for (i = k = 0; i < M->r; i++)
+    {
+        for (j = 0; j < row_nnz; j++, k++)
+        {
+            rows[k] = i;
+            cols[k] = n_randint(state, M->c);
+            fmpz_randtest(vals + k, state, bits);
+        }
+    }
+
+    fmpz_sparse_mat_set_triplets(M, rows, cols, vals, len);
+
+    flint_free(rows);
+    flint_free(cols);
+    _fmpz_vec_clear(vals, len);
+}
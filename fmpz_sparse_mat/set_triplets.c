@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+static int
+_slong_cmp(const void * a, const void * b)
+{
+    slong c1 = *((const slong *) a);
+    slong c2 = *((const slong *) b);
+
+    return (c1 > c2) - (c1 < c2);
+}
+
+void
+fmpz_sparse_mat_set_triplets(fmpz_sparse_mat_t M, const slong * rows,
+                        const slong * cols, const fmpz * vals, slong len)
+{
+    slong * pos, * T;
+    slong i, j, k, nnz;
+    fmpz_t v;
+
+    /* bucket the triplet indices by row */
+    pos = flint_calloc(M->r + 1, sizeof(slong));
+
+    for (k = 0; k < len; k++)
+        pos[rows[k] + 1]++;
+    for (i = 0; i < M->r; i++)
+        pos[i + 1] += pos[i];
+
+    /* pairs (column, triplet index), compared by column first */
+    T = flint_malloc(2 * len * sizeof(slong));
+
+    for (k = 0; k < len; k++)
+    {
+        j = pos[rows[k]]++;
+        T[2 * j] = cols[k];
+        T[2 * j + 1] = k;
+    }
+
+    /* pos[i] is now the end of row i, sort each row and merge duplicates */
+    fmpz_sparse_mat_fit_nnz(M, len);
+    fmpz_init(v);
+
+    nnz = 0;
+    for (i = 0, j = 0; i < M->r; i++)
+    {
+        M->row_start[i] = nnz;
+
+        qsort(T + 2 * j, pos[i] - j, 2 * sizeof(slong), _slong_cmp);
+
+        while (j < pos[i])
+        {
+            fmpz_set(v, vals + T[2 * j + 1]);
+
+            for (k = j + 1; k < pos[i] && T[2 * k] == T[2 * j]; k++)
+                fmpz_add(v, v, vals + T[2 * k + 1]);
+
+            if (!fmpz_is_zero(v))
+            {
+                M->cols[nnz] = T[2 * j];
+                fmpz_swap(M->entries + nnz, v);
+                nnz++;
+            }
+
+            j = k;
+        }
+    }
+
+    M->row_start[M->r] = nnz;
+
+    fmpz_clear(v);
+    flint_free(T);
+    flint_free(pos);
+}
@@ -0,0 +1,305 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpq.h"
+#include "nmod_vec.h"
+#include "fmpz_sparse_mat.h"
+
+/* number of primes modulo which A must be singular before giving up */
+#define DIXON_MAX_PRIMES 4
+
+/* number of minimal polynomials tried modulo each prime */
+#define DIXON_MAX_MINPOLYS 4
+
+/* sets t to the symmetric remainder of d x modulo M */
+static void
+_fmpz_mul_smod(fmpz_t t, const fmpz_t d, const fmpz_t x,
+                                    const fmpz_t M, const fmpz_t halfM)
+{
+    fmpz_mul(t, d, x);
+    fmpz_fdiv_r(t, t, M);
+    if (fmpz_cmp(t, halfM) > 0)
+        fmpz_sub(t, t, M);
+}
+
+/*
+    Reconstructs the common denominator d of the entries of X modulo M and
+    sets N to the numerators. Since d x mod M is the numerator of x once d
+    is correct, few entries need actual rational reconstruction.
+    Returns 0 if the modulus is too small.
+*/
+static int
+_fmpz_vec_reconstruct(fmpz * N, fmpz_t d, const fmpz * X, slong len,
+                                                            const fmpz_t M)
+{
+    fmpz_t halfM, t, num, den;
+    slong i;
+    int success = 1;
+
+    fmpz_init(halfM);
+    fmpz_init(t);
+    fmpz_init(num);
+    fmpz_init(den);
+
+    fmpz_fdiv_q_2exp(halfM, M, 1);
+    fmpz_one(d);
+
+    for (i = 0; i < len && success; i++)
+    {
+        _fmpz_mul_smod(t, d, X + i, M, halfM);
+
+        /* the numerator and denominator must fit in half the modulus */
+        if (2 * (fmpz_bits(t) + fmpz_bits(d)) + 2 <= fmpz_bits(M))
+            continue;
+
+        fmpz_mod(t, t, M);
+        success = _fmpq_reconstruct_fmpz(num, den, t, M);
+
+        if (success)
+            fmpz_mul(d, d, den);
+    }
+
+    for (i = 0; i < len && success; i++)
+        _fmpz_mul_smod(N + i, d, X + i, M, halfM);
+
+    fmpz_clear(halfM);
+    fmpz_clear(t);
+    fmpz_clear(num);
+    fmpz_clear(den);
+
+    return success;
+}
+
+/*
+    Returns the number of bits of H = prod_i (||A_i||_2 + |b_i|), which by
+    Hadamard's inequality bounds det(A) as well as the determinants of the
+    matrices obtained by replacing a column of A by b.
+*/
+static slong
+_fmpz_sparse_mat_solve_bound(const fmpz_sparse_mat_t A, const fmpz * b)
+{
+    fmpz_t s;
+    slong i, k, bits, total = 0;
+
+    fmpz_init(s);
+
+    for (i = 0; i < A->r; i++)
+    {
+        fmpz_zero(s);
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+            fmpz_addmul(s, A->entries + k, A->entries + k);
+
+        bits = (fmpz_bits(s) + 1) / 2;
+        bits = FLINT_MAX(bits, fmpz_bits(b + i)) + 1;
+        total += bits;
+    }
+
+    fmpz_clear(s);
+
+    return total;
+}
+
+/* checks that A N = d b */
+static int
+_fmpz_sparse_mat_check_solution(const fmpz_sparse_mat_t A, const fmpz * N,
+                                            const fmpz_t d, const fmpz * b)
+{
+    fmpz * t;
+    slong i, n = A->r;
+    int result = 1;
+
+    t = _fmpz_vec_init(n);
+    fmpz_sparse_mat_mul_vec(t, A, N);
+
+    for (i = 0; i < n && result; i++)
+    {
+        fmpz_submul(t + i, d, b + i);
+        result = fmpz_is_zero(t + i);
+    }
+
+    _fmpz_vec_clear(t, n);
+
+    return result;
+}
+
+/*
+    p-adic lifting for A x = b modulo the prime of Amod, given the minimal
+    polynomial f of A modulo p. Returns 1 on success, 0 if f does not
+    annihilate a residual (it is then only a proper divisor of the minimal
+    polynomial) and -1 if the lifting reached the bound without a
+    solution, which cannot happen for a correct f.
+*/
+static int
+_fmpz_sparse_mat_dixon(fmpz * x, fmpz_t den, const fmpz_sparse_mat_t A,
+        const fmpz * b, const nmod_sparse_mat_t Amod, const nmod_poly_t f,
+        slong bound)
+{
+    slong i, k, n, next;
+    fmpz * d, * t, * X;
+    mp_ptr dmod, y, ymod;
+    fmpz_t M;
+    int result = -1;
+
+    n = A->r;
+
+    d = _fmpz_vec_init(n);
+    t = _fmpz_vec_init(n);
+    X = _fmpz_vec_init(n);
+    dmod = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+    ymod = _nmod_vec_init(n);
+    fmpz_init_set_ui(M, 1);
+
+    _fmpz_vec_set(d, b, n);
+    next = 1;
+
+    /*
+        With d_0 = b, each step solves A y = d_k mod p and sets
+        d_{k+1} = (d_k - A y) / p, so that A X = b mod p^(k+1) for
+        X = sum_k y_k p^k. The rational solution is reconstructed at
+        exponentially spaced steps and checked exactly.
+    */
+    for (k = 1; ; k++)
+    {
+        _fmpz_vec_get_nmod_vec(dmod, d, n, Amod->mod);
+
+        nmod_sparse_mat_solve_minpoly(y, Amod, f, dmod);
+        nmod_sparse_mat_mul_vec(ymod, Amod, y);
+
+        if (!_nmod_vec_equal(ymod, dmod, n))
+        {
+            result = 0;
+            break;
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            fmpz_set_ui(t + i, y[i]);
+            fmpz_addmul_ui(X + i, M, y[i]);
+        }
+
+        fmpz_mul_ui(M, M, Amod->mod.n);
+
+        fmpz_sparse_mat_mul_vec(x, A, t);
+        _fmpz_vec_sub(d, d, x, n);
+        _fmpz_vec_scalar_divexact_ui(d, d, n, Amod->mod.n);
+
+        if (k == next || fmpz_bits(M) > 2 * bound + 2)
+        {
+            if (_fmpz_vec_reconstruct(x, den, X, n, M) &&
+                _fmpz_sparse_mat_check_solution(A, x, den, b))
+            {
+                result = 1;
+                break;
+            }
+
+            if (fmpz_bits(M) > 2 * bound + 2)
+                break;
+
+            next = 2 * k;
+        }
+    }
+
+    _fmpz_vec_clear(d, n);
+    _fmpz_vec_clear(t, n);
+    _fmpz_vec_clear(X, n);
+    _nmod_vec_clear(dmod);
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(ymod);
+    fmpz_clear(M);
+
+    return result;
+}
+
+int
+fmpz_sparse_mat_solve_wiedemann(fmpz * x, fmpz_t den,
+                            const fmpz_sparse_mat_t A, const fmpz * b)
+{
+    nmod_sparse_mat_t Amod;
+    nmod_poly_t f;
+    mp_ptr u, v;
+    mp_limb_t p;
+    flint_rand_t state;
+    slong i, n, bound, num_primes, num_minpolys;
+    int result = 0;
+
+    n = A->r;
+
+    if (n == 0)
+    {
+        fmpz_one(den);
+        return 1;
+    }
+
+    bound = _fmpz_sparse_mat_solve_bound(A, b);
+
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    flint_randinit(state);
+
+    p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
+
+    for (num_primes = 0; num_primes < DIXON_MAX_PRIMES && result != 1;
+                                                                num_primes++)
+    {
+        p = n_nextprime(p, 0);
+
+        nmod_sparse_mat_init(Amod, n, n, p);
+        nmod_poly_init(f, p);
+        fmpz_sparse_mat_get_nmod_sparse_mat(Amod, A);
+
+        /*
+            For random u and v, the minimal polynomial of the projected
+            Krylov sequence is that of A with high probability, and it can
+            then be reused to solve modulo p at every lifting step. If it
+            is only a proper divisor, some lifting step fails modulo p.
+        */
+        for (num_minpolys = 0; num_minpolys < DIXON_MAX_MINPOLYS;
+                                                            num_minpolys++)
+        {
+            for (i = 0; i < n; i++)
+            {
+                u[i] = n_randint(state, p);
+                v[i] = n_randint(state, p);
+            }
+
+            nmod_sparse_mat_minpoly_projection(f, Amod, u, v);
+
+            /* u is orthogonal to the Krylov space of v, so try again */
+            if (f->length < 2)
+                continue;
+
+            /* a root at zero proves that A is singular modulo p */
+            if (f->coeffs[0] == 0)
+                break;
+
+            result = _fmpz_sparse_mat_dixon(x, den, A, b, Amod, f, bound);
+
+            if (result != 0)
+                break;
+        }
+
+        nmod_sparse_mat_clear(Amod);
+        nmod_poly_clear(f);
+    }
+
+    result = (result == 1);
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    flint_randclear(state);
+
+    return result;
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_swap(fmpz_sparse_mat_t M1, fmpz_sparse_mat_t M2)
+{
+    if (M1 != M2)
+    {
+        fmpz_sparse_mat_struct t = *M1;
+        *M1 = *M2;
+        *M2 = t;
+    }
+}
@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("get_nmod_sparse_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A;
+        nmod_mat_t Amod, B;
+        fmpz_sparse_mat_t M;
+        nmod_sparse_mat_t Mmod;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        mod = n_randtest_not_zero(state);
+
+        fmpz_mat_init(A, m, n);
+        nmod_mat_init(Amod, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        fmpz_sparse_mat_init(M, m, n);
+        nmod_sparse_mat_init(Mmod, m, n, mod);
+
+        fmpz_sparse_mat_randtest(M, state, n_randint(state, 10),
+                                                1 + n_randint(state, 200));
+        fmpz_sparse_mat_get_fmpz_mat(A, M);
+        fmpz_mat_get_nmod_mat(Amod, A);
+
+        fmpz_sparse_mat_get_nmod_sparse_mat(Mmod, M);
+        nmod_sparse_mat_get_nmod_mat(B, Mmod);
+
+        if (!nmod_mat_equal(Amod, B))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(Amod);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        nmod_mat_clear(Amod);
+        nmod_mat_clear(B);
+        fmpz_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(Mmod);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, x, y;
+        fmpz_sparse_mat_t M;
+        fmpz * z;
+        slong m, n;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(x, n, 1);
+        fmpz_mat_init(y, m, 1);
+        fmpz_sparse_mat_init(M, m, n);
+        z = _fmpz_vec_init(m);
+
+        fmpz_sparse_mat_randtest(M, state, n_randint(state, n + 1),
+                                                1 + n_randint(state, 200));
+        fmpz_sparse_mat_get_fmpz_mat(A, M);
+        fmpz_mat_randtest(x, state, 1 + n_randint(state, 200));
+
+        fmpz_mat_mul(y, A, x);
+
+        if (n != 0)
+            fmpz_sparse_mat_mul_vec(z, M, x->entries);
+
+        if (m != 0 && !_fmpz_vec_equal(y->entries, z, m))
+        {
+            flint_printf("FAIL:\n");
+            fmpz_mat_print_pretty(A);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(x);
+        fmpz_mat_clear(y);
+        fmpz_sparse_mat_clear(M);
+        _fmpz_vec_clear(z, m);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_fmpz_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, B;
+        fmpz_sparse_mat_t M, N;
+        slong m, n;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_sparse_mat_init(M, m, n);
+        fmpz_sparse_mat_init(N, m, n);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 200));
+        fmpz_sparse_mat_set_fmpz_mat(M, A);
+        fmpz_sparse_mat_get_fmpz_mat(B, M);
+
+        if (!fmpz_mat_equal(A, B))
+        {
+            flint_printf("FAIL: dense -> sparse -> dense\n");
+            fmpz_mat_print_pretty(A);
+            fmpz_mat_print_pretty(B);
+            abort();
+        }
+
+        fmpz_sparse_mat_randtest(M, state, n_randint(state, 10),
+                                                1 + n_randint(state, 200));
+        fmpz_sparse_mat_get_fmpz_mat(A, M);
+        fmpz_sparse_mat_set_fmpz_mat(N, A);
+
+        if (!fmpz_sparse_mat_equal(M, N))
+        {
+            flint_printf("FAIL: sparse -> dense -> sparse\n");
+            fmpz_mat_print_pretty(A);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_sparse_mat_clear(M);
+        fmpz_sparse_mat_clear(N);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
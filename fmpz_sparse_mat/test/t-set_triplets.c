@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_triplets....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, B;
+        fmpz_sparse_mat_t M;
+        slong m, n, len, k, * rows, * cols;
+        fmpz * vals;
+
+        m = 1 + n_randint(state, 20);
+        n = 1 + n_randint(state, 20);
+        len = n_randint(state, 3 * m * n);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_sparse_mat_init(M, m, n);
+
+        rows = flint_malloc(len * sizeof(slong));
+        cols = flint_malloc(len * sizeof(slong));
+        vals = _fmpz_vec_init(len);
+
+        /* repeated positions are summed, and may cancel */
+        for (k = 0; k < len; k++)
+        {
+            rows[k] = n_randint(state, m);
+            cols[k] = n_randint(state, n);
+            fmpz_randtest(vals + k, state, 1 + n_randint(state, 3));
+
+            fmpz_add(fmpz_mat_entry(A, rows[k], cols[k]),
+                     fmpz_mat_entry(A, rows[k], cols[k]), vals + k);
+        }
+
+        fmpz_sparse_mat_set_triplets(M, rows, cols, vals, len);
+        fmpz_sparse_mat_get_fmpz_mat(B, M);
+
+        if (!fmpz_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            fmpz_mat_print_pretty(A);
+            fmpz_mat_print_pretty(B);
+            abort();
+        }
+
+        for (k = 0; k < fmpz_sparse_mat_nnz(M); k++)
+        {
+            if (fmpz_is_zero(M->entries + k))
+            {
+                flint_printf("FAIL: zero entry stored\n");
+                abort();
+            }
+        }
+
+        flint_free(rows);
+        flint_free(cols);
+        _fmpz_vec_clear(vals, len);
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_sparse_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 300 * flint_test_multiplier(); iter++)
+    {
+        fmpz_sparse_mat_t M;
+        fmpz_mat_t A;
+        fmpz * x, * b, * y;
+        fmpz_t den, g;
+        slong i, n, rank;
+        int result;
+
+        n = 1 + n_randint(state, 40);
+
+        fmpz_sparse_mat_init(M, n, n);
+        fmpz_mat_init(A, n, n);
+        x = _fmpz_vec_init(n);
+        b = _fmpz_vec_init(n);
+        y = _fmpz_vec_init(n);
+        fmpz_init(den);
+        fmpz_init(g);
+
+        fmpz_sparse_mat_randtest_square(M, state, 1 + n_randint(state, 100));
+        fmpz_sparse_mat_get_fmpz_mat(A, M);
+        rank = fmpz_mat_rank(A);
+
+        _fmpz_vec_randtest(b, state, n, 1 + n_randint(state, 100));
+
+        result = fmpz_sparse_mat_solve_wiedemann(x, den, M, b);
+
+        /* a singular system may still be solved if it is consistent */
+        if (!result && rank == n)
+        {
+            flint_printf("FAIL: result = %d, rank = %wd, n = %wd\n",
+                                                            result, rank, n);
+            fmpz_mat_print_pretty(A);
+            abort();
+        }
+
+        if (result)
+        {
+            /* A x = den b with x / den in lowest terms */
+            fmpz_sparse_mat_mul_vec(y, M, x);
+            _fmpz_vec_scalar_submul_fmpz(y, b, n, den);
+
+            fmpz_set(g, den);
+            for (i = 0; i < n; i++)
+                fmpz_gcd(g, g, x + i);
+
+            if (!_fmpz_vec_is_zero(y, n) || fmpz_sgn(den) <= 0 ||
+                                                            !fmpz_is_one(g))
+            {
+                flint_printf("FAIL: wrong solution\n");
+                fmpz_mat_print_pretty(A);
+                _fmpz_vec_print(x, n), flint_printf("\n");
+                fmpz_print(den), flint_printf("\n");
+                abort();
+            }
+        }
+
+        fmpz_sparse_mat_clear(M);
+        fmpz_mat_clear(A);
+        _fmpz_vec_clear(x, n);
+        _fmpz_vec_clear(b, n);
+        _fmpz_vec_clear(y, n);
+        fmpz_clear(den);
+        fmpz_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_transpose(fmpz_sparse_mat_t B, const fmpz_sparse_mat_t A)
+{
+    slong i, j, k, nnz;
+
+    if (B == A)
+    {
+        fmpz_sparse_mat_t t;
+        fmpz_sparse_mat_init(t, A->c, A->r);
+        fmpz_sparse_mat_transpose(t, A);
+        fmpz_sparse_mat_swap(B, t);
+        fmpz_sparse_mat_clear(t);
+        return;
+    }
+
+    nnz = fmpz_sparse_mat_nnz(A);
+    fmpz_sparse_mat_fit_nnz(B, nnz);
+
+    /* count the entries in each column, then place them row by row */
+    for (j = 0; j <= A->c; j++)
+        B->row_start[j] = 0;
+
+    for (k = 0; k < nnz; k++)
+        B->row_start[A->cols[k] + 1]++;
+
+    for (j = 0; j < A->c; j++)
+        B->row_start[j + 1] += B->row_start[j];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_start[i]; k < A->row_start[i + 1]; k++)
+        {
+            j = B->row_start[A->cols[k]]++;
+            B->cols[j] = i;
+            fmpz_set(B->entries + j, A->entries + k);
+        }
+    }
+
+    for (j = A->c; j > 0; j--)
+        B->row_start[j] = B->row_start[j - 1];
+    B->row_start[0] = 0;
+}
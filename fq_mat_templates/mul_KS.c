@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -45,7 +46,7 @@ TEMPLATE(T, mat_mul_KS) (TEMPLATE(T, mat_t) C,
     fmpz_set(beta, TEMPLATE(T, ctx_prime) (ctx));
     fmpz_sub_ui(beta, beta, 1);
     fmpz_mul(beta, beta, beta);
-    fmpz_mul_si(beta, beta, A->r);
+    fmpz_mul_si(beta, beta, A->c);
     fmpz_mul_si(beta, beta, TEMPLATE(T, ctx_degree) (ctx));
     bits = fmpz_bits(beta) + 1;
 
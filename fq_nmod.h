@@ -2,6 +2,7 @@
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2012 Andres Goens
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -405,6 +406,208 @@ FLINT_DLL void fq_nmod_bit_pack(fmpz_t f, const fq_nmod_t op, mp_bitcnt_t bit_si
 FLINT_DLL void fq_nmod_bit_unpack(fq_nmod_t rop, const fmpz_t f, mp_bitcnt_t bit_size,
                    const fq_nmod_ctx_t ctx);
 
+/* Small degree elements ****************************************************/
+
+/*
+    Elements of fields of degree at most FQ_NMOD_SMALL_DEGREE can be held
+    in a fixed-size array of coefficients reduced modulo p, padded with
+    zeros, which lives on the stack or inline in a vector or matrix.
+*/
+#define FQ_NMOD_SMALL_DEGREE 8
+
+typedef struct
+{
+    mp_limb_t coeffs[FQ_NMOD_SMALL_DEGREE];
+}
+fq_nmod_small_struct;
+
+typedef fq_nmod_small_struct fq_nmod_small_t[1];
+
+FQ_NMOD_INLINE int fq_nmod_ctx_is_small(const fq_nmod_ctx_t ctx)
+{
+    return fq_nmod_ctx_degree(ctx) <= FQ_NMOD_SMALL_DEGREE;
+}
+
+/*
+    Number of limbs per accumulator needed for a sum of the given number
+    of products of residues, together with the terms added by
+    _fq_nmod_reduce_small.
+*/
+FQ_NMOD_INLINE int _fq_nmod_small_nlimbs(slong terms, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong bits;
+
+    terms += (d - 1) * (ctx->len - 1);
+    bits = 2 * (FLINT_BITS - ctx->mod.norm) + FLINT_BIT_COUNT(terms);
+
+    return bits <= FLINT_BITS ? 1 : (bits <= 2 * FLINT_BITS ? 2 : 3);
+}
+
+/*
+    Adds the product of (op1, len1) and (op2, len2) to the len1 + len2 - 1
+    accumulators of nlimbs limbs each at R, without reduction.
+*/
+FQ_NMOD_INLINE void _fq_nmod_mul_small_acc(mp_ptr R, mp_srcptr op1,
+                        slong len1, mp_srcptr op2, slong len2, int nlimbs)
+{
+    mp_limb_t c, hi, lo;
+    slong i, k;
+
+    for (i = 0; i < len1; i++)
+    {
+        c = op1[i];
+
+        if (c == 0)
+            continue;
+
+        if (nlimbs == 1)
+        {
+            for (k = 0; k < len2; k++)
+                R[i + k] += c * op2[k];
+        }
+        else if (nlimbs == 2)
+        {
+            for (k = 0; k < len2; k++)
+            {
+                umul_ppmm(hi, lo, c, op2[k]);
+                add_ssaaaa(R[2 * (i + k) + 1], R[2 * (i + k)],
+                           R[2 * (i + k) + 1], R[2 * (i + k)], hi, lo);
+            }
+        }
+        else
+        {
+            for (k = 0; k < len2; k++)
+            {
+                umul_ppmm(hi, lo, c, op2[k]);
+                add_sssaaaaaa(R[3 * (i + k) + 2], R[3 * (i + k) + 1],
+                    R[3 * (i + k)], R[3 * (i + k) + 2], R[3 * (i + k) + 1],
+                    R[3 * (i + k)], 0, hi, lo);
+            }
+        }
+    }
+}
+
+FLINT_DLL void _fq_nmod_reduce_small(mp_ptr rop, mp_ptr R, slong lenR,
+                                        int nlimbs, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_mul_small(mp_ptr rop, mp_srcptr op1, slong len1,
+                    mp_srcptr op2, slong len2, const fq_nmod_ctx_t ctx);
+
+FQ_NMOD_INLINE void fq_nmod_small_zero(fq_nmod_small_t rop,
+                                                const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < FQ_NMOD_SMALL_DEGREE; i++)
+        rop->coeffs[i] = 0;
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_one(fq_nmod_small_t rop,
+                                                const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_small_zero(rop, ctx);
+    rop->coeffs[0] = 1;
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_set(fq_nmod_small_t rop,
+                        const fq_nmod_small_t op, const fq_nmod_ctx_t ctx)
+{
+    *rop = *op;
+}
+
+FQ_NMOD_INLINE int fq_nmod_small_equal(const fq_nmod_small_t op1,
+                        const fq_nmod_small_t op2, const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < fq_nmod_ctx_degree(ctx); i++)
+        if (op1->coeffs[i] != op2->coeffs[i])
+            return 0;
+
+    return 1;
+}
+
+FQ_NMOD_INLINE int fq_nmod_small_is_zero(const fq_nmod_small_t op,
+                                                const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < fq_nmod_ctx_degree(ctx); i++)
+        if (op->coeffs[i] != 0)
+            return 0;
+
+    return 1;
+}
+
+FQ_NMOD_INLINE void fq_nmod_get_small(fq_nmod_small_t rop,
+                                const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < op->length; i++)
+        rop->coeffs[i] = op->coeffs[i];
+    for ( ; i < FQ_NMOD_SMALL_DEGREE; i++)
+        rop->coeffs[i] = 0;
+}
+
+FQ_NMOD_INLINE void fq_nmod_set_small(fq_nmod_t rop,
+                        const fq_nmod_small_t op, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    nmod_poly_fit_length(rop, d);
+    _nmod_vec_set(rop->coeffs, op->coeffs, d);
+    _nmod_poly_set_length(rop, d);
+    _nmod_poly_normalise(rop);
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_add(fq_nmod_small_t rop,
+    const fq_nmod_small_t op1, const fq_nmod_small_t op2,
+    const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < fq_nmod_ctx_degree(ctx); i++)
+        rop->coeffs[i] = n_addmod(op1->coeffs[i], op2->coeffs[i], ctx->mod.n);
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_sub(fq_nmod_small_t rop,
+    const fq_nmod_small_t op1, const fq_nmod_small_t op2,
+    const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < fq_nmod_ctx_degree(ctx); i++)
+        rop->coeffs[i] = n_submod(op1->coeffs[i], op2->coeffs[i], ctx->mod.n);
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_neg(fq_nmod_small_t rop,
+                        const fq_nmod_small_t op, const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < fq_nmod_ctx_degree(ctx); i++)
+        rop->coeffs[i] = nmod_neg(op->coeffs[i], ctx->mod);
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_mul(fq_nmod_small_t rop,
+    const fq_nmod_small_t op1, const fq_nmod_small_t op2,
+    const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    _fq_nmod_mul_small(rop->coeffs, op1->coeffs, d, op2->coeffs, d, ctx);
+}
+
+FQ_NMOD_INLINE void fq_nmod_small_sqr(fq_nmod_small_t rop,
+                        const fq_nmod_small_t op, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+
+    _fq_nmod_mul_small(rop->coeffs, op->coeffs, d, op->coeffs, d, ctx);
+}
+
 #ifdef T
 #undef T
 #endif
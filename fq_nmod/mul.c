@@ -2,6 +2,7 @@
     Copyright (C) 2011, 2012 Sebastian Pancratz 
     Copyright (C) 2012 Andres Goens
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -15,6 +16,20 @@
 
 void fq_nmod_mul(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_t op2, const fq_nmod_ctx_t ctx)
 {
+    if (fq_nmod_ctx_is_small(ctx) &&
+        op1->length <= fq_nmod_ctx_degree(ctx) &&
+        op2->length <= fq_nmod_ctx_degree(ctx))
+    {
+        const slong d = fq_nmod_ctx_degree(ctx);
+
+        nmod_poly_fit_length(rop, d);
+        _fq_nmod_mul_small(rop->coeffs, op1->coeffs, op1->length,
+                                        op2->coeffs, op2->length, ctx);
+        _nmod_poly_set_length(rop, d);
+        _nmod_poly_normalise(rop);
+        return;
+    }
+
     nmod_poly_mul(rop, op1, op2);
 
     fq_nmod_reduce(rop, ctx);
@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod.h"
+
+void _fq_nmod_mul_small(mp_ptr rop, mp_srcptr op1, slong len1,
+                    mp_srcptr op2, slong len2, const fq_nmod_ctx_t ctx)
+{
+    mp_limb_t R[3 * (2 * FQ_NMOD_SMALL_DEGREE - 1)];
+    slong i;
+    int nlimbs;
+
+    NMOD_VEC_NORM(op1, len1);
+    NMOD_VEC_NORM(op2, len2);
+
+    if (len1 == 0 || len2 == 0)
+    {
+        for (i = 0; i < fq_nmod_ctx_degree(ctx); i++)
+            rop[i] = 0;
+        return;
+    }
+
+    nlimbs = _fq_nmod_small_nlimbs(FLINT_MIN(len1, len2), ctx);
+
+    flint_mpn_zero(R, nlimbs * (len1 + len2 - 1));
+    _fq_nmod_mul_small_acc(R, op1, len1, op2, len2, nlimbs);
+    _fq_nmod_reduce_small(rop, R, len1 + len2 - 1, nlimbs, ctx);
+}
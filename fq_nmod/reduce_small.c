@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod.h"
+
+void _fq_nmod_reduce_small(mp_ptr rop, mp_ptr R, slong lenR,
+                                        int nlimbs, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong * j = ctx->j;
+    const nmod_t mod = ctx->mod;
+    mp_limb_t na[FQ_NMOD_SMALL_DEGREE + 1];
+    mp_limb_t c, hi, lo;
+    slong i, k, m;
+
+    /* X^d = sum na[k] X^j[k] over the nonzero lower terms of the modulus */
+    for (k = 0; k < ctx->len - 1; k++)
+        na[k] = nmod_neg(ctx->a[k], mod);
+
+    if (nlimbs == 1)
+    {
+        for (i = lenR - 1; i >= d; i--)
+        {
+            NMOD_RED(c, R[i], mod);
+            for (k = 0; k < ctx->len - 1; k++)
+                R[j[k] + i - d] += c * na[k];
+        }
+
+        for (i = 0; i < FLINT_MIN(lenR, d); i++)
+            NMOD_RED(rop[i], R[i], mod);
+    }
+    else if (nlimbs == 2)
+    {
+        for (i = lenR - 1; i >= d; i--)
+        {
+            NMOD2_RED2(c, R[2 * i + 1], R[2 * i], mod);
+            for (k = 0; k < ctx->len - 1; k++)
+            {
+                m = 2 * (j[k] + i - d);
+                umul_ppmm(hi, lo, c, na[k]);
+                add_ssaaaa(R[m + 1], R[m], R[m + 1], R[m], hi, lo);
+            }
+        }
+
+        for (i = 0; i < FLINT_MIN(lenR, d); i++)
+            NMOD2_RED2(rop[i], R[2 * i + 1], R[2 * i], mod);
+    }
+    else
+    {
+        for (i = lenR - 1; i >= d; i--)
+        {
+            NMOD_RED(c, R[3 * i + 2], mod);
+            NMOD_RED3(c, c, R[3 * i + 1], R[3 * i], mod);
+            for (k = 0; k < ctx->len - 1; k++)
+            {
+                m = 3 * (j[k] + i - d);
+                umul_ppmm(hi, lo, c, na[k]);
+                add_sssaaaaaa(R[m + 2], R[m + 1], R[m],
+                              R[m + 2], R[m + 1], R[m], 0, hi, lo);
+            }
+        }
+
+        for (i = 0; i < FLINT_MIN(lenR, d); i++)
+        {
+            NMOD_RED(c, R[3 * i + 2], mod);
+            NMOD_RED3(rop[i], c, R[3 * i + 1], R[3 * i], mod);
+        }
+    }
+
+    for (i = lenR; i < d; i++)
+        rop[i] = 0;
+}
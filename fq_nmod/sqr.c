@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,6 +14,18 @@
 
 void fq_nmod_sqr(fq_nmod_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx)
 {
+    if (fq_nmod_ctx_is_small(ctx) && op->length <= fq_nmod_ctx_degree(ctx))
+    {
+        const slong d = fq_nmod_ctx_degree(ctx);
+
+        nmod_poly_fit_length(rop, d);
+        _fq_nmod_mul_small(rop->coeffs, op->coeffs, op->length,
+                                        op->coeffs, op->length, ctx);
+        _nmod_poly_set_length(rop, d);
+        _nmod_poly_normalise(rop);
+        return;
+    }
+
     nmod_poly_mul(rop, op, op);
 
     fq_nmod_reduce(rop, ctx);
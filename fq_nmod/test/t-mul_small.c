@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod.h"
+
+/* fields of degree at most FQ_NMOD_SMALL_DEGREE over primes of all sizes */
+static void
+_fq_nmod_ctx_randtest_small(fq_nmod_ctx_t ctx, flint_rand_t state)
+{
+    mp_limb_t p = n_randtest_prime(state, 0);
+    slong d = n_randint(state, FQ_NMOD_SMALL_DEGREE) + 1;
+
+    if (n_randint(state, 2))
+    {
+        fmpz_t P;
+
+        /* sparse modulus */
+        fmpz_init_set_ui(P, p);
+        fq_nmod_ctx_init(ctx, P, d, "a");
+        fmpz_clear(P);
+    }
+    else
+    {
+        nmod_poly_t modulus;
+
+        /* dense modulus */
+        nmod_poly_init(modulus, p);
+        nmod_poly_randtest_monic_irreducible(modulus, state, d + 1);
+        fq_nmod_ctx_init_modulus(ctx, modulus, "a");
+        nmod_poly_clear(modulus);
+    }
+}
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_small....");
+    fflush(stdout);
+
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_t a, b, c, d;
+        fq_nmod_small_t as, bs, cs;
+
+        _fq_nmod_ctx_randtest_small(ctx, state);
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+        fq_nmod_init(c, ctx);
+        fq_nmod_init(d, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        if (n_randint(state, 4) == 0)
+            fq_nmod_set(b, a, ctx);
+        else
+            fq_nmod_randtest(b, state, ctx);
+
+        /* reference product */
+        nmod_poly_mul(d, a, b);
+        fq_nmod_reduce(d, ctx);
+
+        fq_nmod_mul(c, a, b, ctx);
+
+        fq_nmod_get_small(as, a, ctx);
+        fq_nmod_get_small(bs, b, ctx);
+        fq_nmod_small_mul(cs, as, bs, ctx);
+        fq_nmod_small_mul(as, as, bs, ctx);
+
+        if (!fq_nmod_equal(c, d, ctx) || !fq_nmod_small_equal(cs, as, ctx))
+        {
+            flint_printf("FAIL (mul):\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("a = "), fq_nmod_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), fq_nmod_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), fq_nmod_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("d = "), fq_nmod_print_pretty(d, ctx), flint_printf("\n");
+            abort();
+        }
+
+        fq_nmod_set_small(c, cs, ctx);
+
+        if (!fq_nmod_equal(c, d, ctx))
+        {
+            flint_printf("FAIL (small_mul):\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("a = "), fq_nmod_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), fq_nmod_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), fq_nmod_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("d = "), fq_nmod_print_pretty(d, ctx), flint_printf("\n");
+            abort();
+        }
+
+        /* squaring */
+        nmod_poly_mul(d, a, a);
+        fq_nmod_reduce(d, ctx);
+
+        fq_nmod_get_small(as, a, ctx);
+        fq_nmod_small_sqr(cs, as, ctx);
+        fq_nmod_set_small(c, cs, ctx);
+
+        if (!fq_nmod_equal(c, d, ctx))
+        {
+            flint_printf("FAIL (small_sqr):\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("a = "), fq_nmod_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("c = "), fq_nmod_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("d = "), fq_nmod_print_pretty(d, ctx), flint_printf("\n");
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+        fq_nmod_clear(c, ctx);
+        fq_nmod_clear(d, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
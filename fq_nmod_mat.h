@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -39,10 +40,31 @@ int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
         return 0;
 }
 
+/*
+    Cutoff on the smallest dimension above which fq_nmod_mat_mul_lift is
+    used; Karatsuba over the degree, needed for small p, wins later.
+*/
+FQ_NMOD_MAT_INLINE
+int FQ_NMOD_MAT_MUL_LIFT_CUTOFF(slong n, const fq_nmod_ctx_t ctx)
+{
+    slong d = fq_nmod_ctx_degree(ctx);
+
+    if (ctx->mod.n >= 2 * d - 1)
+        return n >= 16;
+    else
+        return n >= 16 + d;
+}
+
 #define T fq_nmod
 #define CAP_T FQ_NMOD
 #include "fq_mat_templates.h"
 #undef CAP_T
 #undef T
 
+FLINT_DLL void fq_nmod_mat_mul_small(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mat_mul_lift(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx);
+
 #endif
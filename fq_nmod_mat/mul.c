@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -11,12 +12,17 @@
 
 #include "fq_nmod_mat.h"
 
-#ifdef T
-#undef T
-#endif
+void fq_nmod_mat_mul(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    slong n = FLINT_MIN(FLINT_MIN(A->r, A->c), B->c);
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_mat_templates/mul.c"
-#undef CAP_T
-#undef T
+    if (FQ_NMOD_MAT_MUL_LIFT_CUTOFF(n, ctx))
+        fq_nmod_mat_mul_lift(C, A, B, ctx);
+    else if (fq_nmod_ctx_is_small(ctx))
+        fq_nmod_mat_mul_small(C, A, B, ctx);
+    else if (FQ_NMOD_MAT_MUL_KS_CUTOFF(A->r, B->c, ctx))
+        fq_nmod_mat_mul_KS(C, A, B, ctx);
+    else
+        fq_nmod_mat_mul_classical(C, A, B, ctx);
+}
@@ -0,0 +1,267 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_mat.h"
+#include "nmod_mat.h"
+
+/*
+    The coefficient matrices are stored stacked: row k of a stacked
+    matrix holds the coefficients of X^k of all entries, row by row, and
+    is viewed as an r by c matrix by the following. The view is cleared
+    with nmod_mat_window_clear.
+*/
+static void
+_nmod_mat_row_view(nmod_mat_t V, const nmod_mat_t S, slong k,
+                                                    slong r, slong c)
+{
+    slong i;
+
+    V->entries = NULL;
+
+    if (r > 0)
+        V->rows = flint_malloc(r * sizeof(mp_limb_t *));
+
+    for (i = 0; i < r; i++)
+        V->rows[i] = S->rows[k] + i * c;
+
+    V->r = r;
+    V->c = c;
+    V->mod = S->mod;
+}
+
+static nmod_mat_struct *
+_nmod_mat_vec_init_view(const nmod_mat_t S, slong len, slong r, slong c)
+{
+    nmod_mat_struct * vec = flint_malloc(sizeof(nmod_mat_struct) * len);
+    slong i;
+
+    for (i = 0; i < len; i++)
+        _nmod_mat_row_view(vec + i, S, i, r, c);
+
+    return vec;
+}
+
+static nmod_mat_struct *
+_nmod_mat_vec_init(slong len, slong r, slong c, mp_limb_t n)
+{
+    nmod_mat_struct * vec = flint_malloc(sizeof(nmod_mat_struct) * len);
+    slong i;
+
+    for (i = 0; i < len; i++)
+        nmod_mat_init(vec + i, r, c, n);
+
+    return vec;
+}
+
+static void
+_nmod_mat_vec_clear(nmod_mat_struct * vec, slong len, int view)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+    {
+        if (view)
+            nmod_mat_window_clear(vec + i);
+        else
+            nmod_mat_clear(vec + i);
+    }
+
+    flint_free(vec);
+}
+
+/*
+    Sets (C, 2 len - 1) to the product of the polynomials (A, len) and
+    (B, len) with matrix coefficients, using Karatsuba multiplication
+    down to single products by nmod_mat_mul.
+*/
+static void
+_nmod_mat_poly_mul_karatsuba(nmod_mat_struct * C, const nmod_mat_struct * A,
+                                        const nmod_mat_struct * B, slong len)
+{
+    nmod_mat_struct * SA, * SB, * M;
+    slong i, h, l;
+    mp_limb_t n = A->mod.n;
+
+    if (len == 1)
+    {
+        nmod_mat_mul(C, A, B);
+        return;
+    }
+
+    h = (len + 1) / 2;
+    l = len - h;
+
+    /* low and high products A0 B0 and A1 B1 */
+    _nmod_mat_poly_mul_karatsuba(C, A, B, h);
+    _nmod_mat_poly_mul_karatsuba(C + 2 * h, A + h, B + h, l);
+    nmod_mat_zero(C + 2 * h - 1);
+
+    /* middle product (A0 + A1)(B0 + B1) - A0 B0 - A1 B1 */
+    SA = _nmod_mat_vec_init(h, A->r, A->c, n);
+    SB = _nmod_mat_vec_init(h, B->r, B->c, n);
+    M = _nmod_mat_vec_init(2 * h - 1, C->r, C->c, n);
+
+    for (i = 0; i < l; i++)
+    {
+        nmod_mat_add(SA + i, A + i, A + h + i);
+        nmod_mat_add(SB + i, B + i, B + h + i);
+    }
+    for ( ; i < h; i++)
+    {
+        nmod_mat_set(SA + i, A + i);
+        nmod_mat_set(SB + i, B + i);
+    }
+
+    _nmod_mat_poly_mul_karatsuba(M, SA, SB, h);
+
+    for (i = 0; i < 2 * h - 1; i++)
+        nmod_mat_sub(M + i, M + i, C + i);
+    for (i = 0; i < 2 * l - 1; i++)
+        nmod_mat_sub(M + i, M + i, C + 2 * h + i);
+    for (i = 0; i < 2 * h - 1; i++)
+        nmod_mat_add(C + h + i, C + h + i, M + i);
+
+    _nmod_mat_vec_clear(SA, h, 0);
+    _nmod_mat_vec_clear(SB, h, 0);
+    _nmod_mat_vec_clear(M, 2 * h - 1, 0);
+}
+
+void fq_nmod_mat_mul_lift(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong m = 2 * d - 1;
+    const nmod_t mod = ctx->mod;
+    nmod_mat_t As, Bs, Cs;
+    nmod_mat_struct * Av, * Bv, * Cv;
+    slong ar, br, bc, i, j, k, l;
+    fq_nmod_struct * e;
+
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (br == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    if (ar == 0 || bc == 0)
+        return;
+
+    /* A = sum A_k X^k and B = sum B_k X^k over the prime field */
+    nmod_mat_init(As, d, ar * br, mod.n);
+    nmod_mat_init(Bs, d, br * bc, mod.n);
+    nmod_mat_init(Cs, m, ar * bc, mod.n);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < br; j++)
+        {
+            e = fq_nmod_mat_entry(A, i, j);
+            for (k = 0; k < e->length; k++)
+                nmod_mat_entry(As, k, i * br + j) = e->coeffs[k];
+        }
+    }
+
+    for (i = 0; i < br; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            e = fq_nmod_mat_entry(B, i, j);
+            for (k = 0; k < e->length; k++)
+                nmod_mat_entry(Bs, k, i * bc + j) = e->coeffs[k];
+        }
+    }
+
+    if (d > 1 && mod.n >= m)
+    {
+        nmod_mat_t V, Vd, W, Ae, Be;
+
+        /*
+            Evaluate at 0, 1, ..., 2 d - 2, multiply pointwise and
+            interpolate. With stacked coefficients, evaluation and
+            interpolation are products with Vandermonde matrices.
+        */
+        nmod_mat_init(V, m, m, mod.n);
+        nmod_mat_init(W, m, m, mod.n);
+        for (i = 0; i < m; i++)
+        {
+            nmod_mat_entry(V, i, 0) = 1;
+            for (k = 1; k < m; k++)
+                nmod_mat_entry(V, i, k) =
+                    nmod_mul(nmod_mat_entry(V, i, k - 1), i, mod);
+        }
+        nmod_mat_inv(W, V);
+
+        nmod_mat_init(Ae, m, ar * br, mod.n);
+        nmod_mat_init(Be, m, br * bc, mod.n);
+        nmod_mat_window_init(Vd, V, 0, 0, m, d);
+        nmod_mat_mul(Ae, Vd, As);
+        nmod_mat_mul(Be, Vd, Bs);
+        nmod_mat_window_clear(Vd);
+
+        Av = _nmod_mat_vec_init_view(Ae, m, ar, br);
+        Bv = _nmod_mat_vec_init_view(Be, m, br, bc);
+        nmod_mat_clear(As);
+        nmod_mat_init(As, m, ar * bc, mod.n);
+        Cv = _nmod_mat_vec_init_view(As, m, ar, bc);
+
+        for (i = 0; i < m; i++)
+            nmod_mat_mul(Cv + i, Av + i, Bv + i);
+
+        nmod_mat_mul(Cs, W, As);
+
+        _nmod_mat_vec_clear(Av, m, 1);
+        _nmod_mat_vec_clear(Bv, m, 1);
+        _nmod_mat_vec_clear(Cv, m, 1);
+        nmod_mat_clear(Ae);
+        nmod_mat_clear(Be);
+        nmod_mat_clear(V);
+        nmod_mat_clear(W);
+    }
+    else
+    {
+        Av = _nmod_mat_vec_init_view(As, d, ar, br);
+        Bv = _nmod_mat_vec_init_view(Bs, d, br, bc);
+        Cv = _nmod_mat_vec_init_view(Cs, m, ar, bc);
+
+        _nmod_mat_poly_mul_karatsuba(Cv, Av, Bv, d);
+
+        _nmod_mat_vec_clear(Av, d, 1);
+        _nmod_mat_vec_clear(Bv, d, 1);
+        _nmod_mat_vec_clear(Cv, m, 1);
+    }
+
+    /* reduce once, using X^d = -sum a[l] X^j[l] */
+    for (k = m - 1; k >= d; k--)
+        for (l = 0; l < ctx->len - 1; l++)
+            _nmod_vec_scalar_addmul_nmod(Cs->rows[ctx->j[l] + k - d],
+                Cs->rows[k], ar * bc, nmod_neg(ctx->a[l], mod), mod);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            e = fq_nmod_mat_entry(C, i, j);
+            nmod_poly_fit_length(e, d);
+            for (k = 0; k < d; k++)
+                e->coeffs[k] = nmod_mat_entry(Cs, k, i * bc + j);
+            _nmod_poly_set_length(e, d);
+            _nmod_poly_normalise(e);
+        }
+    }
+
+    nmod_mat_clear(As);
+    nmod_mat_clear(Bs);
+    nmod_mat_clear(Cs);
+}
@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_mat.h"
+
+void fq_nmod_mat_mul_small(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                            const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_small_struct * As, * Bt, * t;
+    slong ar, br, bc, i, j;
+
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (br == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    /* rows of A and columns of B as contiguous arrays of small elements */
+    As = flint_malloc(sizeof(fq_nmod_small_struct) * ar * br);
+    Bt = flint_malloc(sizeof(fq_nmod_small_struct) * br * bc);
+    t = flint_malloc(sizeof(fq_nmod_small_struct) * bc);
+
+    for (i = 0; i < ar; i++)
+        _fq_nmod_vec_get_small(As + i * br, A->rows[i], br, ctx);
+
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            fq_nmod_get_small(Bt + j * br + i,
+                                    fq_nmod_mat_entry(B, i, j), ctx);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+            _fq_nmod_vec_dot_small(t + j, As + i * br, Bt + j * br, br, ctx);
+
+        _fq_nmod_vec_set_small(C->rows[i], t, bc, ctx);
+    }
+
+    flint_free(As);
+    flint_free(Bt);
+    flint_free(t);
+}
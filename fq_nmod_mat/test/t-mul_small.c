@@ -0,0 +1,112 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_mat.h"
+
+/* fields of degree at most FQ_NMOD_SMALL_DEGREE over primes of all sizes */
+static void
+_fq_nmod_ctx_randtest_small(fq_nmod_ctx_t ctx, flint_rand_t state)
+{
+    mp_limb_t p = n_randtest_prime(state, 0);
+    slong d = n_randint(state, FQ_NMOD_SMALL_DEGREE) + 1;
+
+    if (n_randint(state, 2))
+    {
+        fmpz_t P;
+
+        /* sparse modulus */
+        fmpz_init_set_ui(P, p);
+        fq_nmod_ctx_init(ctx, P, d, "a");
+        fmpz_clear(P);
+    }
+    else
+    {
+        nmod_poly_t modulus;
+
+        /* dense modulus */
+        nmod_poly_init(modulus, p);
+        nmod_poly_randtest_monic_irreducible(modulus, state, d + 1);
+        fq_nmod_ctx_init_modulus(ctx, modulus, "a");
+        nmod_poly_clear(modulus);
+    }
+}
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_small....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_mat_t A, B, C, D;
+        slong m, n, k;
+
+        _fq_nmod_ctx_randtest_small(ctx, state);
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        k = n_randint(state, 30);
+
+        fq_nmod_mat_init(A, m, k, ctx);
+        fq_nmod_mat_init(B, k, n, ctx);
+        fq_nmod_mat_init(C, m, n, ctx);
+        fq_nmod_mat_init(D, m, n, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+        fq_nmod_mat_randtest(C, state, ctx);  /* noise in output */
+
+        fq_nmod_mat_mul_small(C, A, B, ctx);
+        fq_nmod_mat_mul_classical(D, A, B, ctx);
+
+        if (!fq_nmod_mat_equal(C, D, ctx))
+        {
+            flint_printf("FAIL:\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("A:\n"), fq_nmod_mat_print(A, ctx);
+            flint_printf("B:\n"), fq_nmod_mat_print(B, ctx);
+            flint_printf("C:\n"), fq_nmod_mat_print(C, ctx);
+            flint_printf("D:\n"), fq_nmod_mat_print(D, ctx);
+            abort();
+        }
+
+        /* aliasing of C and A */
+        if (k == n)
+        {
+            fq_nmod_mat_mul_small(A, A, B, ctx);
+
+            if (!fq_nmod_mat_equal(A, D, ctx))
+            {
+                flint_printf("FAIL (aliasing):\n\n");
+                abort();
+            }
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2012 Andres Goens
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -32,6 +33,14 @@
 #define FQ_NMOD_SQR_CLASSICAL_CUTOFF 6
 #define FQ_NMOD_MULLOW_CLASSICAL_CUTOFF 6
 
+/* Extension degree below which products go through a single nmod_poly
+   product rather than Kronecker substitution over the integers */
+#define FQ_NMOD_MUL_UNIVARIATE_CUTOFF 24
+
+/* Number of products above which a dense modulus is reduced by one
+   matrix product in _fq_nmod_poly_reduce_univariate */
+#define FQ_NMOD_POLY_REDUCE_UNIVARIATE_CUTOFF 4
+
 #define FQ_NMOD_POLY_HGCD_CUTOFF 25
 #define FQ_NMOD_POLY_SMALL_GCD_CUTOFF 110
 #define FQ_NMOD_POLY_GCD_CUTOFF 120
@@ -47,6 +56,27 @@
 #undef CAP_T
 #undef T
 
+FLINT_DLL void _fq_nmod_poly_reduce_univariate(fq_nmod_struct * rop,
+                            mp_ptr P, slong len, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_poly_mul_univariate(fq_nmod_struct * rop,
+                            const fq_nmod_struct * op1, slong len1,
+                            const fq_nmod_struct * op2, slong len2,
+                            const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_poly_mul_univariate(fq_nmod_poly_t rop,
+                            const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+                            const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_poly_mullow_univariate(fq_nmod_struct * rop,
+                            const fq_nmod_struct * op1, slong len1,
+                            const fq_nmod_struct * op2, slong len2,
+                            slong n, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_poly_mullow_univariate(fq_nmod_poly_t rop,
+                            const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+                            slong n, const fq_nmod_ctx_t ctx);
+
 #include "fq_nmod_poly_factor.h"
 
 #endif
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -15,8 +16,10 @@
 #undef T
 #endif
 
+#define USE_MUL_UNIVARIATE 1
 #define T fq_nmod
 #define CAP_T FQ_NMOD
 #include "fq_poly_templates/mul.c"
 #undef CAP_T
 #undef T
+#undef USE_MUL_UNIVARIATE
@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_poly.h"
+
+void
+_fq_nmod_poly_mul_univariate(fq_nmod_struct * rop,
+                             const fq_nmod_struct * op1, slong len1,
+                             const fq_nmod_struct * op2, slong len2,
+                             const fq_nmod_ctx_t ctx)
+{
+    const slong in1_len = len1, in2_len = len2;
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong pfactor = 2 * d - 1;
+    slong i, lenA, lenB, rlen;
+    mp_ptr A, B, P;
+    int squaring;
+
+    FQ_NMOD_VEC_NORM(op1, len1, ctx);
+    FQ_NMOD_VEC_NORM(op2, len2, ctx);
+
+    if (!len1 | !len2)
+    {
+        if (in1_len + in2_len - 1 > 0)
+            _fq_nmod_poly_zero(rop, in1_len + in2_len - 1, ctx);
+        return;
+    }
+
+    squaring = (op1 == op2 && len1 == len2);
+    rlen = len1 + len2 - 1;
+
+    /*
+        Substitute y = x^(2d - 1) for the generator of F_q over F_p, so
+        that the coefficients of the products of the elements do not
+        overlap, and multiply the resulting polynomials over F_p
+    */
+    lenA = (len1 - 1) * pfactor + (op1 + len1 - 1)->length;
+    lenB = (len2 - 1) * pfactor + (op2 + len2 - 1)->length;
+
+    A = _nmod_vec_init(lenA + (squaring ? 0 : lenB) + rlen * pfactor);
+    B = squaring ? A : A + lenA;
+    P = B + (squaring ? lenA : lenB);
+
+    _nmod_vec_zero(A, lenA + (squaring ? 0 : lenB));
+    for (i = 0; i < len1; i++)
+        _nmod_vec_set(A + i * pfactor, (op1 + i)->coeffs, (op1 + i)->length);
+    if (!squaring)
+        for (i = 0; i < len2; i++)
+            _nmod_vec_set(B + i * pfactor, (op2 + i)->coeffs,
+                          (op2 + i)->length);
+
+    if (lenA >= lenB)
+        _nmod_poly_mul(P, A, lenA, B, lenB, ctx->mod);
+    else
+        _nmod_poly_mul(P, B, lenB, A, lenA, ctx->mod);
+
+    _nmod_vec_zero(P + lenA + lenB - 1, rlen * pfactor - (lenA + lenB - 1));
+
+    _fq_nmod_poly_reduce_univariate(rop, P, rlen, ctx);
+
+    _fq_nmod_poly_zero(rop + rlen, (in1_len - len1) + (in2_len - len2), ctx);
+
+    _nmod_vec_clear(A);
+}
+
+void
+fq_nmod_poly_mul_univariate(fq_nmod_poly_t rop, const fq_nmod_poly_t op1,
+                            const fq_nmod_poly_t op2, const fq_nmod_ctx_t ctx)
+{
+    const slong len1 = op1->length;
+    const slong len2 = op2->length;
+    const slong rlen = len1 + len2 - 1;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op1 || rop == op2)
+    {
+        fq_nmod_poly_t t;
+
+        fq_nmod_poly_init2(t, rlen, ctx);
+        _fq_nmod_poly_mul_univariate(t->coeffs, op1->coeffs, len1,
+                                     op2->coeffs, len2, ctx);
+        fq_nmod_poly_swap(rop, t, ctx);
+        fq_nmod_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, rlen, ctx);
+        _fq_nmod_poly_mul_univariate(rop->coeffs, op1->coeffs, len1,
+                                     op2->coeffs, len2, ctx);
+    }
+
+    _fq_nmod_poly_set_length(rop, rlen, ctx);
+}
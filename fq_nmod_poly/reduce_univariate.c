@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_poly.h"
+#include "nmod_mat.h"
+
+/*
+    Sets the rows of M to x^(d + i) modulo the modulus f of degree d
+    for 0 <= i < d - 1, so that the high coefficients of an unreduced
+    product map to its reduction under a single matrix product.
+*/
+static void
+_fq_nmod_ctx_reduction_matrix(nmod_mat_t M, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    mp_srcptr f = ctx->modulus->coeffs;
+    mp_limb_t c, inv;
+    slong i, k;
+
+    inv = nmod_neg(n_invmod(f[d], ctx->mod.n), ctx->mod);
+    for (k = 0; k < d; k++)
+        nmod_mat_entry(M, 0, k) = nmod_mul(f[k], inv, ctx->mod);
+
+    for (i = 1; i < d - 1; i++)
+    {
+        c = nmod_mat_entry(M, i - 1, d - 1);
+        nmod_mat_entry(M, i, 0) = nmod_mul(c, nmod_mat_entry(M, 0, 0),
+                                           ctx->mod);
+        for (k = 1; k < d; k++)
+            nmod_mat_entry(M, i, k) = nmod_add(nmod_mat_entry(M, i - 1, k - 1),
+                nmod_mul(c, nmod_mat_entry(M, 0, k), ctx->mod), ctx->mod);
+    }
+}
+
+void
+_fq_nmod_poly_reduce_univariate(fq_nmod_struct * rop, mp_ptr P, slong len,
+                                const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong pfactor = 2 * d - 1;
+    slong i;
+
+    if (!ctx->sparse_modulus && d > 1
+                        && len >= FQ_NMOD_POLY_REDUCE_UNIVARIATE_CUTOFF)
+    {
+        nmod_mat_t H, L, M;
+
+        nmod_mat_init(H, len, d - 1, ctx->mod.n);
+        nmod_mat_init(L, len, d, ctx->mod.n);
+        nmod_mat_init(M, d - 1, d, ctx->mod.n);
+
+        for (i = 0; i < len; i++)
+            _nmod_vec_set(H->rows[i], P + i * pfactor + d, d - 1);
+
+        _fq_nmod_ctx_reduction_matrix(M, ctx);
+        nmod_mat_mul(L, H, M);
+
+        for (i = 0; i < len; i++)
+        {
+            nmod_poly_fit_length(rop + i, d);
+            _nmod_vec_add((rop + i)->coeffs, L->rows[i], P + i * pfactor, d,
+                          ctx->mod);
+            (rop + i)->length = d;
+            _nmod_poly_normalise(rop + i);
+        }
+
+        nmod_mat_clear(H);
+        nmod_mat_clear(L);
+        nmod_mat_clear(M);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+        {
+            _fq_nmod_reduce(P + i * pfactor, pfactor, ctx);
+
+            nmod_poly_fit_length(rop + i, d);
+            _nmod_vec_set((rop + i)->coeffs, P + i * pfactor, d);
+            (rop + i)->length = d;
+            _nmod_poly_normalise(rop + i);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_univariate... ");
+    fflush(stdout);
+
+    /* Compare with Kronecker substitution, over fields and over rings */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_poly_t a, b, c, d;
+
+        if (n_randint(state, 2))
+            fq_nmod_ctx_randtest(ctx, state);
+        else
+            fq_nmod_ctx_randtest_reducible(ctx, state);
+
+        fq_nmod_poly_init(a, ctx);
+        fq_nmod_poly_init(b, ctx);
+        fq_nmod_poly_init(c, ctx);
+        fq_nmod_poly_init(d, ctx);
+
+        fq_nmod_poly_randtest(a, state, n_randint(state, 60), ctx);
+        fq_nmod_poly_randtest(b, state, n_randint(state, 60), ctx);
+
+        fq_nmod_poly_mul_univariate(c, a, b, ctx);
+        fq_nmod_poly_mul_KS(d, a, b, ctx);
+
+        result = (fq_nmod_poly_equal(c, d, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("a = "), fq_nmod_poly_print_pretty(a, "X", ctx),
+                flint_printf("\n");
+            flint_printf("b = "), fq_nmod_poly_print_pretty(b, "X", ctx),
+                flint_printf("\n");
+            flint_printf("c = "), fq_nmod_poly_print_pretty(c, "X", ctx),
+                flint_printf("\n");
+            flint_printf("d = "), fq_nmod_poly_print_pretty(d, "X", ctx),
+                flint_printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(a, ctx);
+        fq_nmod_poly_clear(b, ctx);
+        fq_nmod_poly_clear(c, ctx);
+        fq_nmod_poly_clear(d, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check aliasing and squaring */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_poly_t a, b, c;
+
+        fq_nmod_ctx_randtest(ctx, state);
+
+        fq_nmod_poly_init(a, ctx);
+        fq_nmod_poly_init(b, ctx);
+        fq_nmod_poly_init(c, ctx);
+
+        fq_nmod_poly_randtest(a, state, n_randint(state, 60), ctx);
+        fq_nmod_poly_set(b, a, ctx);
+
+        fq_nmod_poly_sqr_KS(c, a, ctx);
+        fq_nmod_poly_mul_univariate(a, a, a, ctx);
+
+        result = (fq_nmod_poly_equal(a, c, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n\n");
+            flint_printf("b = "), fq_nmod_poly_print_pretty(b, "X", ctx),
+                flint_printf("\n");
+            flint_printf("a = "), fq_nmod_poly_print_pretty(a, "X", ctx),
+                flint_printf("\n");
+            flint_printf("c = "), fq_nmod_poly_print_pretty(c, "X", ctx),
+                flint_printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(a, ctx);
+        fq_nmod_poly_clear(b, ctx);
+        fq_nmod_poly_clear(c, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
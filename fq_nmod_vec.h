@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -42,6 +43,30 @@ do {                                          \
 } while (0);
 
 
+/*  Small degree elements  ***************************************************/
+
+FQ_NMOD_VEC_INLINE void _fq_nmod_vec_get_small(fq_nmod_small_struct * rop,
+        const fq_nmod_struct * op, slong len, const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        fq_nmod_get_small(rop + i, op + i, ctx);
+}
+
+FQ_NMOD_VEC_INLINE void _fq_nmod_vec_set_small(fq_nmod_struct * rop,
+        const fq_nmod_small_struct * op, slong len, const fq_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        fq_nmod_set_small(rop + i, op + i, ctx);
+}
+
+FLINT_DLL void _fq_nmod_vec_dot_small(fq_nmod_small_t res,
+    const fq_nmod_small_struct * vec1, const fq_nmod_small_struct * vec2,
+    slong len, const fq_nmod_ctx_t ctx);
+
 #define T fq_nmod
 #define CAP_T FQ_NMOD
 #include "fq_vec_templates.h"
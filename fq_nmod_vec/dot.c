@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -11,12 +12,44 @@
 
 #include "fq_nmod_vec.h"
 
-#ifdef T
-#undef T
-#endif
+void _fq_nmod_vec_dot(fq_nmod_t res, const fq_nmod_struct * vec1,
+            const fq_nmod_struct * vec2, slong len2, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_vec_templates/dot.c"
-#undef CAP_T
-#undef T
+    if (fq_nmod_ctx_is_small(ctx))
+    {
+        /* accumulate all products unreduced and reduce once at the end */
+        mp_limb_t R[3 * (2 * FQ_NMOD_SMALL_DEGREE - 1)];
+        int nlimbs = _fq_nmod_small_nlimbs(len2 * d, ctx);
+
+        flint_mpn_zero(R, nlimbs * (2 * d - 1));
+        for (i = 0; i < len2; i++)
+        {
+            if (vec1[i].length != 0 && vec2[i].length != 0)
+                _fq_nmod_mul_small_acc(R, vec1[i].coeffs, vec1[i].length,
+                                 vec2[i].coeffs, vec2[i].length, nlimbs);
+        }
+
+        nmod_poly_fit_length(res, d);
+        _fq_nmod_reduce_small(res->coeffs, R, 2 * d - 1, nlimbs, ctx);
+        _nmod_poly_set_length(res, d);
+        _nmod_poly_normalise(res);
+    }
+    else
+    {
+        fq_nmod_t x;
+
+        fq_nmod_init(x, ctx);
+        fq_nmod_zero(res, ctx);
+
+        for (i = 0; i < len2; i++)
+        {
+            fq_nmod_mul(x, vec1 + i, vec2 + i, ctx);
+            fq_nmod_add(res, res, x, ctx);
+        }
+
+        fq_nmod_clear(x, ctx);
+    }
+}
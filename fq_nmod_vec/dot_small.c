@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_vec.h"
+
+void _fq_nmod_vec_dot_small(fq_nmod_small_t res,
+    const fq_nmod_small_struct * vec1, const fq_nmod_small_struct * vec2,
+    slong len, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    mp_limb_t R[3 * (2 * FQ_NMOD_SMALL_DEGREE - 1)];
+    slong i;
+    int nlimbs;
+
+    /* the products are only reduced once, at the end */
+    nlimbs = _fq_nmod_small_nlimbs(len * d, ctx);
+
+    flint_mpn_zero(R, nlimbs * (2 * d - 1));
+    for (i = 0; i < len; i++)
+        _fq_nmod_mul_small_acc(R, vec1[i].coeffs, d,
+                                  vec2[i].coeffs, d, nlimbs);
+
+    _fq_nmod_reduce_small(res->coeffs, R, 2 * d - 1, nlimbs, ctx);
+}
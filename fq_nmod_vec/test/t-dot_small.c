@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_vec.h"
+
+/* fields of degree at most FQ_NMOD_SMALL_DEGREE over primes of all sizes */
+static void
+_fq_nmod_ctx_randtest_small(fq_nmod_ctx_t ctx, flint_rand_t state)
+{
+    mp_limb_t p = n_randtest_prime(state, 0);
+    slong d = n_randint(state, FQ_NMOD_SMALL_DEGREE) + 1;
+
+    if (n_randint(state, 2))
+    {
+        fmpz_t P;
+
+        /* sparse modulus */
+        fmpz_init_set_ui(P, p);
+        fq_nmod_ctx_init(ctx, P, d, "a");
+        fmpz_clear(P);
+    }
+    else
+    {
+        nmod_poly_t modulus;
+
+        /* dense modulus */
+        nmod_poly_init(modulus, p);
+        nmod_poly_randtest_monic_irreducible(modulus, state, d + 1);
+        fq_nmod_ctx_init_modulus(ctx, modulus, "a");
+        nmod_poly_clear(modulus);
+    }
+}
+
+int
+main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("dot_small....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_struct * a, * b;
+        fq_nmod_small_struct * as, * bs;
+        fq_nmod_t r, s, t;
+        fq_nmod_small_t rs;
+        slong len;
+
+        _fq_nmod_ctx_randtest_small(ctx, state);
+
+        len = n_randint(state, 100);
+
+        a = _fq_nmod_vec_init(len, ctx);
+        b = _fq_nmod_vec_init(len, ctx);
+        as = flint_malloc(sizeof(fq_nmod_small_struct) * (len + 1));
+        bs = flint_malloc(sizeof(fq_nmod_small_struct) * (len + 1));
+        fq_nmod_init(r, ctx);
+        fq_nmod_init(s, ctx);
+        fq_nmod_init(t, ctx);
+
+        _fq_nmod_vec_randtest(a, state, len, ctx);
+        _fq_nmod_vec_randtest(b, state, len, ctx);
+
+        /* reference dot product */
+        fq_nmod_zero(s, ctx);
+        for (j = 0; j < len; j++)
+        {
+            nmod_poly_mul(t, a + j, b + j);
+            fq_nmod_reduce(t, ctx);
+            fq_nmod_add(s, s, t, ctx);
+        }
+
+        _fq_nmod_vec_dot(r, a, b, len, ctx);
+
+        if (!fq_nmod_equal(r, s, ctx))
+        {
+            flint_printf("FAIL (dot):\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("r = "), fq_nmod_print_pretty(r, ctx), flint_printf("\n");
+            flint_printf("s = "), fq_nmod_print_pretty(s, ctx), flint_printf("\n");
+            abort();
+        }
+
+        _fq_nmod_vec_get_small(as, a, len, ctx);
+        _fq_nmod_vec_get_small(bs, b, len, ctx);
+        _fq_nmod_vec_dot_small(rs, as, bs, len, ctx);
+        fq_nmod_set_small(r, rs, ctx);
+
+        if (!fq_nmod_equal(r, s, ctx))
+        {
+            flint_printf("FAIL (dot_small):\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("r = "), fq_nmod_print_pretty(r, ctx), flint_printf("\n");
+            flint_printf("s = "), fq_nmod_print_pretty(s, ctx), flint_printf("\n");
+            abort();
+        }
+
+        /* conversions round trip */
+        _fq_nmod_vec_set_small(b, as, len, ctx);
+
+        if (!_fq_nmod_vec_equal(a, b, len, ctx))
+        {
+            flint_printf("FAIL (set_small):\n\n");
+            abort();
+        }
+
+        _fq_nmod_vec_clear(a, len, ctx);
+        _fq_nmod_vec_clear(b, len, ctx);
+        flint_free(as);
+        flint_free(bs);
+        fq_nmod_clear(r, ctx);
+        fq_nmod_clear(s, ctx);
+        fq_nmod_clear(t, ctx);
+
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2012 Andres Goens
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -29,6 +30,23 @@ typedef struct
 
 typedef TEMPLATE(T, poly_factor_struct) TEMPLATE(T, poly_factor_t)[1];
 
+/*
+    Table of the iterated Frobenius images x^{q^i} modulo a fixed monic
+    polynomial, for 0 <= i < length. The table grows on demand and can be
+    shared by all computations modulo the same polynomial.
+*/
+typedef struct
+{
+    TEMPLATE(T, poly_struct) * pows;
+    slong length;
+    slong alloc;
+    TEMPLATE(T, poly_t) modulus;
+    TEMPLATE(T, poly_t) modinv;
+} TEMPLATE(T, poly_frobenius_table_struct);
+
+typedef TEMPLATE(T, poly_frobenius_table_struct)
+                                     TEMPLATE(T, poly_frobenius_table_t)[1];
+
 
 FLINT_DLL void TEMPLATE(T, poly_factor_init)(TEMPLATE(T, poly_factor_t) fac,
                               const TEMPLATE(T, ctx_t) ctx);
@@ -133,12 +151,40 @@ FLINT_DLL void TEMPLATE(T, poly_factor)(TEMPLATE(T, poly_factor_t) result,
                          const TEMPLATE(T, ctx_t) ctx);
 
 
+FLINT_DLL void _TEMPLATE(T, poly_iterated_frobenius_preinv)(
+                                            TEMPLATE(T, poly_struct) * rop,
+                                            slong k, slong n,
+                                            const TEMPLATE(T, poly_t) v,
+                                            const TEMPLATE(T, poly_t) vinv,
+                                            const TEMPLATE(T, ctx_t) ctx);
+
 FLINT_DLL void TEMPLATE(T, poly_iterated_frobenius_preinv)(TEMPLATE(T, poly_t)* rop,
                                             slong n,
                                             const TEMPLATE(T, poly_t) v,
                                             const TEMPLATE(T, poly_t) vinv,
                                             const TEMPLATE(T, ctx_t) ctx);
 
+/*  Frobenius tables  ********************************************************/
+
+FLINT_DLL void TEMPLATE(T, poly_frobenius_table_init)(
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                const TEMPLATE(T, poly_t) f,
+                                const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_frobenius_table_clear)(
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_frobenius_table_fit_length)(
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                slong len, const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_frobenius_table_compose)(
+                                TEMPLATE(T, poly_t) res,
+                                const TEMPLATE(T, poly_t) g, slong i,
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                const TEMPLATE(T, ctx_t) ctx);
+
 #ifdef __cplusplus
 }
 #endif
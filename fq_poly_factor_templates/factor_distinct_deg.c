@@ -2,6 +2,7 @@
     Copyright (C) 2012 Lina Kulakova
     Copyright (C) 2013 Martin Lee
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,9 +14,79 @@
 
 #ifdef T
 
+#include <math.h>
+#include <pthread.h>
+
 #include "templates.h"
 
-#include <math.h>
+#include "ulong_extras.h"
+
+typedef struct
+{
+    TEMPLATE(T, poly_struct) * res;
+    const TEMPLATE(T, poly_struct) * H;
+    const TEMPLATE(T, poly_struct) * baby;
+    const TEMPLATE(T, poly_struct) * s;
+    const TEMPLATE(T, poly_struct) * sinv;
+    const TEMPLATE(T, ctx_struct) * ctx;
+    slong l;
+    slong num;
+}
+TEMPLATE(T, poly_interval_poly_arg_t);
+
+/* res = prod (H - baby[i]) modulo s for l - num <= i < l */
+static void
+TEMPLATE(T, poly_interval_poly) (TEMPLATE(T, poly_interval_poly_arg_t) * arg)
+{
+    TEMPLATE(T, poly_t) tmp;
+    slong i;
+
+    TEMPLATE(T, poly_init) (tmp, arg->ctx);
+    TEMPLATE(T, poly_one) (arg->res, arg->ctx);
+
+    for (i = arg->l - 1; i >= arg->l - arg->num; i--)
+    {
+        TEMPLATE(T, poly_sub) (tmp, arg->H, arg->baby + i, arg->ctx);
+        TEMPLATE(T, poly_mulmod_preinv) (arg->res, tmp, arg->res, arg->s,
+                                         arg->sinv, arg->ctx);
+    }
+
+    TEMPLATE(T, poly_clear) (tmp, arg->ctx);
+}
+
+static void *
+TEMPLATE(T, poly_interval_poly_worker) (void * arg_ptr)
+{
+    TEMPLATE(T, poly_interval_poly)
+        ((TEMPLATE(T, poly_interval_poly_arg_t) *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* reduces the rows of A modulo s, which has degree less than A->c */
+static void
+TEMPLATE(T, poly_reduce_rows) (TEMPLATE(T, mat_t) A,
+                               const TEMPLATE(T, poly_t) s,
+                               const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, mat_t) B;
+    TEMPLATE(T, t) inv;
+    slong i;
+
+    TEMPLATE(T, mat_init) (B, A->r, s->length - 1, ctx);
+    TEMPLATE(T, init) (inv, ctx);
+    TEMPLATE(T, inv) (inv, s->coeffs + s->length - 1, ctx);
+
+    for (i = 0; i < A->r; i++)
+        _TEMPLATE(T, poly_rem) (B->rows[i], A->rows[i], A->c,
+                                s->coeffs, s->length, inv, ctx);
+
+    TEMPLATE(T, mat_swap) (A, B, ctx);
+
+    TEMPLATE(T, clear) (inv, ctx);
+    TEMPLATE(T, mat_clear) (B, ctx);
+}
 
 void
 TEMPLATE(T, poly_factor_distinct_deg) (TEMPLATE(T, poly_factor_t) res,
@@ -23,22 +94,21 @@ TEMPLATE(T, poly_factor_distinct_deg) (TEMPLATE(T, poly_factor_t) res,
                                        slong * const *degs,
                                        const TEMPLATE(T, ctx_t) ctx)
 {
-    TEMPLATE(T, poly_t) f, g, s, reducedH0, v, vinv, tmp;
-    TEMPLATE(T, poly_t) * h, *H, *I;
-    fmpz_t q;
-    slong i, j, l, m, n, index, d;
+    TEMPLATE(T, poly_frobenius_table_t) tab;
+    TEMPLATE(T, poly_t) f, g, s, sinv, II, tmp;
+    TEMPLATE(T, poly_struct) * h, * hs, * H, * I, * R;
+    TEMPLATE(T, poly_interval_poly_arg_t) * args;
+    TEMPLATE(T, mat_t) A;
+    pthread_t * threads;
+    slong i, j, k, l, m, n, c, cj, num, index, d;
+    int done;
     double beta;
-    TEMPLATE(T, mat_t) HH, HHH;
-
-    TEMPLATE(T, poly_init) (v, ctx);
-    TEMPLATE(T, poly_make_monic) (v, poly, ctx);
 
     n = TEMPLATE(T, poly_degree) (poly, ctx);
     if (n == 1)
     {
         TEMPLATE(T, poly_factor_insert) (res, poly, 1, ctx);
         (*degs)[0] = 1;
-        TEMPLATE(T, poly_clear) (v, ctx);
         return;
     }
 
@@ -46,98 +116,160 @@ TEMPLATE(T, poly_factor_distinct_deg) (TEMPLATE(T, poly_factor_t) res,
     l = ceil(pow(n, beta));
     m = ceil(0.5 * n / l);
 
-    fmpz_init(q);
-    TEMPLATE(T, ctx_order) (q, ctx);
+    /* giant steps are computed, and interval polynomials multiplied out,
+       in batches of c, one per thread */
+    c = FLINT_MIN(flint_get_num_threads(), m);
 
     TEMPLATE(T, poly_init) (f, ctx);
     TEMPLATE(T, poly_init) (g, ctx);
     TEMPLATE(T, poly_init) (s, ctx);
-    TEMPLATE(T, poly_init) (reducedH0, ctx);
-    TEMPLATE(T, poly_init) (vinv, ctx);
+    TEMPLATE(T, poly_init) (sinv, ctx);
+    TEMPLATE(T, poly_init) (II, ctx);
     TEMPLATE(T, poly_init) (tmp, ctx);
 
-    if (!
-        (h = flint_malloc((2 * m + l + 1) * sizeof(TEMPLATE(T, poly_struct)))))
-    {
-        TEMPLATE_PRINTF("Exception (%s_poly_factor_distinct_deg):\n", T);
-        flint_printf("Not enough memory.\n");
-        flint_abort();
-    }
-    H = h + (l + 1);
+    hs = flint_malloc((l + 2 * m + c) * sizeof(TEMPLATE(T, poly_struct)));
+    H = hs + l;
     I = H + m;
-    for (i = 0; i < l + 1; i++)
-        TEMPLATE(T, poly_init) (h[i], ctx);
-    for (i = 0; i < m; i++)
-    {
-        TEMPLATE(T, poly_init) (H[i], ctx);
-        TEMPLATE(T, poly_init) (I[i], ctx);
-    }
+    R = I + m;
+    for (i = 0; i < l + 2 * m + c; i++)
+        TEMPLATE(T, poly_init) (hs + i, ctx);
 
-    TEMPLATE(T, poly_make_monic) (v, poly, ctx);
-
-    TEMPLATE(T, poly_reverse) (vinv, v, v->length, ctx);
-    TEMPLATE(T, poly_inv_series_newton) (vinv, vinv, v->length, ctx);
+    threads = flint_malloc(sizeof(pthread_t) * c);
+    args = flint_malloc(sizeof(TEMPLATE(T, poly_interval_poly_arg_t)) * c);
 
     /* compute baby steps: h[i]=x^{q^i}mod v */
-    /*     h[0] = x */
+    TEMPLATE(T, poly_frobenius_table_init) (tab, poly, ctx);
+    TEMPLATE(T, poly_frobenius_table_fit_length) (tab, l + 1, ctx);
+    h = tab->pows;
+
+    TEMPLATE(T, poly_set) (s, tab->modulus, ctx);
+    TEMPLATE(T, poly_set) (sinv, tab->modinv, ctx);
+    for (i = 0; i < l; i++)
+        TEMPLATE(T, poly_set) (hs + i, h + i, ctx);
 
-    TEMPLATE(T, poly_iterated_frobenius_preinv) (h, l + 1, v, vinv, ctx);
+    /* compute the first batch of giant steps H[j]=x^{q^(l(j+1))}mod v
+       by doubling, H[k + i] = H[i](H[k - 1]) */
+    TEMPLATE(T, poly_set) (H + 0, h + l, ctx);
+    for (k = 1; k < c; k += cj)
+    {
+        cj = FLINT_MIN(k, c - k);
+        TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (H + k, H, cj,
+                                                  H + k - 1, s, sinv, ctx);
+    }
+
+    /* later batches are obtained by composing with H[c - 1] */
+    TEMPLATE(T, mat_init) (A, FLINT_MIN(n, n_sqrt(n * c) + 1), n, ctx);
+    if (c < m)
+    {
+        TEMPLATE(T, poly_set) (tmp, H + c - 1, ctx);
+        TEMPLATE(T, poly_fit_length) (tmp, n, ctx);
+        _TEMPLATE(T, vec_zero) (tmp->coeffs + tmp->length, n - tmp->length,
+                                ctx);
+        _TEMPLATE(T, poly_precompute_matrix) (A, tmp->coeffs, s->coeffs,
+                                 s->length, sinv->coeffs, sinv->length, ctx);
+    }
 
     /* compute coarse distinct-degree factorisation */
     index = 0;
-    TEMPLATE(T, poly_set) (s, v, ctx);
-    TEMPLATE(T, poly_set) (H[0], h[l], ctx);
-    TEMPLATE(T, poly_set) (reducedH0, H[0], ctx);
-    TEMPLATE(T, mat_init) (HH, n_sqrt(v->length - 1) + 1, v->length - 1, ctx);
-    TEMPLATE(T, poly_precompute_matrix) (HH, reducedH0, s, vinv, ctx);
-
-    d = 1;
-    for (j = 0; j < m; j++)
+    done = 0;
+    for (j = 0; j < m && !done; j += c)
     {
-        /* compute giant steps: H[j]=x^{q^(lj)}mod s */
+        cj = FLINT_MIN(c, m - j);
+
         if (j > 0)
         {
-            if (I[j - 1]->length > 1)
+            if (A->c != s->length - 1)
+                TEMPLATE(T, poly_reduce_rows) (A, s, ctx);
+
+            for (i = 0; i < cj; i++)
             {
-                _TEMPLATE(T, poly_reduce_matrix_mod_poly) (HHH, HH, s, ctx);
-                TEMPLATE(T, mat_clear) (HH, ctx);
-                TEMPLATE(T, mat_init_set) (HH, HHH, ctx);
-                TEMPLATE(T, mat_clear) (HHH, ctx);
-                TEMPLATE(T, poly_rem) (reducedH0, reducedH0, s, ctx);
-                TEMPLATE(T, poly_rem) (tmp, H[j - 1], s, ctx);
-                TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)
-                    (H[j], tmp, HH, s, vinv, ctx);
+                TEMPLATE(T, poly_rem) (R + i, H + j - c + i, s, ctx);
+                TEMPLATE(T, poly_fit_length) (H + j + i, s->length - 1, ctx);
             }
-            else
-            {
-                TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)
-                    (H[j], H[j - 1], HH, s, vinv, ctx);
 
+            _TEMPLATE(T, poly_compose_mod_brent_kung_vec_precomp_preinv) (
+                      H + j, R, cj, A, s->coeffs, s->length,
+                      sinv->coeffs, sinv->length, ctx);
+
+            for (i = 0; i < cj; i++)
+            {
+                _TEMPLATE(T, poly_set_length) (H + j + i, s->length - 1, ctx);
+                _TEMPLATE(T, poly_normalise) (H + j + i, ctx);
             }
         }
 
-        /* compute interval polynomials */
-        TEMPLATE(T, poly_one) (I[j], ctx);
-        for (i = l - 1; (i >= 0) && (2 * d <= s->length - 1); i--, d++)
+        /* compute interval polynomials, using the baby steps of degree
+           at most half that of s */
+        for (i = 0; i < cj; i++)
         {
-            TEMPLATE(T, poly_rem) (tmp, h[i], s, ctx);
-            TEMPLATE(T, poly_sub) (tmp, H[j], tmp, ctx);
-            TEMPLATE(T, poly_mulmod_preinv) (I[j], tmp, I[j], s, vinv, ctx);
+            num = (s->length - 1) / 2 - (j + i) * l;
+            num = FLINT_MAX(0, FLINT_MIN(num, l));
+            if (num < l)
+                done = 1;
+
+            args[i].res  = I + j + i;
+            args[i].H    = H + j + i;
+            args[i].baby = hs;
+            args[i].s    = s;
+            args[i].sinv = sinv;
+            args[i].ctx  = ctx;
+            args[i].l    = l;
+            args[i].num  = num;
         }
 
-        /* compute F_j=f^{[j*l+1]} * ... * f^{[j*l+l]} */
-        /* F_j is stored on the place of I_j */
-        TEMPLATE(T, poly_gcd) (I[j], s, I[j], ctx);
-        if (I[j]->length > 1)
+        for (i = 0; i < cj - 1; i++)
+            pthread_create(&threads[i], NULL,
+                           TEMPLATE(T, poly_interval_poly_worker), &args[i]);
+
+        TEMPLATE(T, poly_interval_poly) (&args[cj - 1]);
+
+        for (i = 0; i < cj - 1; i++)
+            pthread_join(threads[i], NULL);
+
+        /* compute F_j=f^{[j*l+1]} * ... * f^{[j*l+l]} for each interval
+           of the batch, stored on the place of I_j */
+        if (cj == 1)
         {
-            TEMPLATE(T, poly_remove) (s, I[j], ctx);
-            TEMPLATE(T, poly_reverse) (vinv, s, s->length, ctx);
-            TEMPLATE(T, poly_inv_series_newton) (vinv, vinv, s->length, ctx);
+            TEMPLATE(T, poly_gcd) (I + j, s, I + j, ctx);
+            TEMPLATE(T, poly_set) (II, I + j, ctx);
         }
-        if (s->length - 1 < 2 * d)
+        else
         {
-            break;
+            TEMPLATE(T, poly_one) (II, ctx);
+            for (i = 0; i < cj; i++)
+                TEMPLATE(T, poly_mulmod_preinv) (II, II, I + j + i, s, sinv,
+                                                 ctx);
+            TEMPLATE(T, poly_gcd) (II, s, II, ctx);
         }
+
+        if (II->length > 1)
+        {
+            TEMPLATE(T, poly_remove) (s, II, ctx);
+            TEMPLATE(T, poly_reverse) (sinv, s, s->length, ctx);
+            TEMPLATE(T, poly_inv_series_newton) (sinv, sinv, s->length, ctx);
+            for (i = 0; i < l; i++)
+                TEMPLATE(T, poly_rem) (hs + i, hs + i, s, ctx);
+
+            /* factors of lower degree are split off first */
+            if (cj > 1)
+            {
+                for (i = 0; i < cj; i++)
+                {
+                    TEMPLATE(T, poly_gcd) (I + j + i, I + j + i, II, ctx);
+                    if (I[j + i].length > 1)
+                        TEMPLATE(T, poly_remove) (II, I + j + i, ctx);
+                }
+            }
+        }
+        else if (cj > 1)
+        {
+            for (i = 0; i < cj; i++)
+                TEMPLATE(T, poly_one) (I + j + i, ctx);
+        }
+
+        d = (j + cj) * l + 1;
+        if (s->length - 1 < 2 * d)
+            done = 1;
     }
     if (s->length > 1)
     {
@@ -145,17 +277,16 @@ TEMPLATE(T, poly_factor_distinct_deg) (TEMPLATE(T, poly_factor_t) res,
         (*degs)[index++] = s->length - 1;
     }
 
-
     /* compute fine distinct-degree factorisation */
     for (j = 0; j < m; j++)
     {
-        if (I[j]->length - 1 > (j + 1) * l || j == 0)
+        if (I[j].length - 1 > (j + 1) * l || j == 0)
         {
-            TEMPLATE(T, poly_set) (g, I[j], ctx);
+            TEMPLATE(T, poly_set) (g, I + j, ctx);
             for (i = l - 1; i >= 0 && (g->length > 1); i--)
             {
                 /* compute f^{[l*(j+1)-i]} */
-                TEMPLATE(T, poly_sub) (tmp, H[j], h[i], ctx);
+                TEMPLATE(T, poly_sub) (tmp, H + j, h + i, ctx);
                 TEMPLATE(T, poly_gcd) (f, g, tmp, ctx);
                 if (f->length > 1)
                 {
@@ -168,34 +299,31 @@ TEMPLATE(T, poly_factor_distinct_deg) (TEMPLATE(T, poly_factor_t) res,
                 }
             }
         }
-        else if (I[j]->length > 1)
+        else if (I[j].length > 1)
         {
-            TEMPLATE(T, poly_make_monic) (I[j], I[j], ctx);
-            TEMPLATE(T, poly_factor_insert) (res, I[j], 1, ctx);
-            (*degs)[index++] = I[j]->length - 1;
+            TEMPLATE(T, poly_make_monic) (I + j, I + j, ctx);
+            TEMPLATE(T, poly_factor_insert) (res, I + j, 1, ctx);
+            (*degs)[index++] = I[j].length - 1;
         }
     }
 
     /* cleanup */
-    fmpz_clear(q);
     TEMPLATE(T, poly_clear) (f, ctx);
     TEMPLATE(T, poly_clear) (g, ctx);
     TEMPLATE(T, poly_clear) (s, ctx);
-    TEMPLATE(T, poly_clear) (reducedH0, ctx);
-    TEMPLATE(T, poly_clear) (v, ctx);
-    TEMPLATE(T, poly_clear) (vinv, ctx);
+    TEMPLATE(T, poly_clear) (sinv, ctx);
+    TEMPLATE(T, poly_clear) (II, ctx);
     TEMPLATE(T, poly_clear) (tmp, ctx);
-    TEMPLATE(T, mat_clear) (HH, ctx);
+    TEMPLATE(T, mat_clear) (A, ctx);
 
-    for (i = 0; i < l + 1; i++)
-        TEMPLATE(T, poly_clear) (h[i], ctx);
-    for (i = 0; i < m; i++)
-    {
-        TEMPLATE(T, poly_clear) (H[i], ctx);
-        TEMPLATE(T, poly_clear) (I[i], ctx);
-    }
-    flint_free(h);
-}
+    for (i = 0; i < l + 2 * m + c; i++)
+        TEMPLATE(T, poly_clear) (hs + i, ctx);
+    flint_free(hs);
 
+    flint_free(threads);
+    flint_free(args);
+
+    TEMPLATE(T, poly_frobenius_table_clear) (tab, ctx);
+}
 
 #endif
@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+void
+TEMPLATE(T, poly_frobenius_table_clear) (
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                const TEMPLATE(T, ctx_t) ctx)
+{
+    slong i;
+
+    for (i = 0; i < tab->alloc; i++)
+        TEMPLATE(T, poly_clear) (tab->pows + i, ctx);
+
+    flint_free(tab->pows);
+
+    TEMPLATE(T, poly_clear) (tab->modulus, ctx);
+    TEMPLATE(T, poly_clear) (tab->modinv, ctx);
+}
+
+#endif
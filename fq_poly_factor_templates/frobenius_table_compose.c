@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+void
+TEMPLATE(T, poly_frobenius_table_compose) (TEMPLATE(T, poly_t) res,
+                                const TEMPLATE(T, poly_t) g, slong i,
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_frobenius_table_fit_length) (tab, i + 1, ctx);
+
+    /* g^{q^i} = g(x^{q^i}) since the coefficients of g are fixed by the
+       Frobenius of F_q */
+    if (g->length >= tab->modulus->length)
+    {
+        TEMPLATE(T, poly_t) r;
+
+        TEMPLATE(T, poly_init) (r, ctx);
+        TEMPLATE(T, poly_rem) (r, g, tab->modulus, ctx);
+        TEMPLATE(T, poly_compose_mod_brent_kung_preinv) (res, r,
+                           tab->pows + i, tab->modulus, tab->modinv, ctx);
+        TEMPLATE(T, poly_clear) (r, ctx);
+    }
+    else
+        TEMPLATE(T, poly_compose_mod_brent_kung_preinv) (res, g,
+                           tab->pows + i, tab->modulus, tab->modinv, ctx);
+}
+
+#endif
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+void
+TEMPLATE(T, poly_frobenius_table_fit_length) (
+                                TEMPLATE(T, poly_frobenius_table_t) tab,
+                                slong len, const TEMPLATE(T, ctx_t) ctx)
+{
+    slong i;
+
+    if (len <= tab->length)
+        return;
+
+    if (len > tab->alloc)
+    {
+        slong alloc = FLINT_MAX(len, 2 * tab->alloc);
+
+        tab->pows = flint_realloc(tab->pows,
+                               alloc * sizeof(TEMPLATE(T, poly_struct)));
+        for (i = tab->alloc; i < alloc; i++)
+            TEMPLATE(T, poly_init) (tab->pows + i, ctx);
+
+        tab->alloc = alloc;
+    }
+
+    _TEMPLATE(T, poly_iterated_frobenius_preinv) (tab->pows, tab->length,
+                                     len, tab->modulus, tab->modinv, ctx);
+
+    tab->length = len;
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+void
+TEMPLATE(T, poly_frobenius_table_init) (TEMPLATE(T, poly_frobenius_table_t) tab,
+                                        const TEMPLATE(T, poly_t) f,
+                                        const TEMPLATE(T, ctx_t) ctx)
+{
+    fmpz_t q;
+
+    if (f->length <= 1)
+    {
+        TEMPLATE_PRINTF("Exception (%s_poly_frobenius_table_init): \n", T);
+        flint_printf("Modulus is constant.\n");
+        flint_abort();
+    }
+
+    TEMPLATE(T, poly_init) (tab->modulus, ctx);
+    TEMPLATE(T, poly_init) (tab->modinv, ctx);
+
+    TEMPLATE(T, poly_make_monic) (tab->modulus, f, ctx);
+    TEMPLATE(T, poly_reverse) (tab->modinv, tab->modulus,
+                               tab->modulus->length, ctx);
+    TEMPLATE(T, poly_inv_series_newton) (tab->modinv, tab->modinv,
+                                         tab->modulus->length, ctx);
+
+    tab->alloc = 2;
+    tab->length = 2;
+    tab->pows = flint_malloc(2 * sizeof(TEMPLATE(T, poly_struct)));
+    TEMPLATE(T, poly_init) (tab->pows + 0, ctx);
+    TEMPLATE(T, poly_init) (tab->pows + 1, ctx);
+
+    /* pows[0] = x and pows[1] = x^q, reduced modulo f */
+    TEMPLATE(T, poly_gen) (tab->pows + 0, ctx);
+    TEMPLATE(T, poly_rem) (tab->pows + 0, tab->pows + 0, tab->modulus, ctx);
+
+    fmpz_init(q);
+    TEMPLATE(T, ctx_order) (q, ctx);
+    TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (tab->pows + 1,
+                   tab->pows + 0, q, 0, tab->modulus, tab->modinv, ctx);
+    fmpz_clear(q);
+}
+
+#endif
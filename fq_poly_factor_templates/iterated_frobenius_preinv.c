@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,6 +14,46 @@
 
 #include "templates.h"
 
+void
+_TEMPLATE(T, poly_iterated_frobenius_preinv) (TEMPLATE(T, poly_struct) * rop,
+                                              slong k, slong n,
+                                              const TEMPLATE(T, poly_t) v,
+                                              const TEMPLATE(T, poly_t) vinv,
+                                              const TEMPLATE(T, ctx_t) ctx)
+{
+    slong i, c;
+
+    if (TEMPLATE(CAP_T, POLY_ITERATED_FROBENIUS_CUTOFF) (ctx, v->length))
+    {
+        /*
+            x^{q^{k - 1 + i}} = x^{q^i}(x^{q^{k - 1}}) for 1 <= i < k, so
+            the number of known powers almost doubles with each batch of
+            compositions sharing the same argument
+        */
+        while (k < n)
+        {
+            c = FLINT_MIN(k - 1, n - k);
+            TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (rop + k,
+                                          rop + 1, c, rop + k - 1, v, vinv,
+                                          ctx);
+            k += c;
+        }
+    }
+    else
+    {
+        fmpz_t q;
+
+        fmpz_init(q);
+        TEMPLATE(T, ctx_order) (q, ctx);
+
+        for (i = k; i < n; i++)
+            TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (rop + i,
+                                           rop + i - 1, q, 0, v, vinv, ctx);
+
+        fmpz_clear(q);
+    }
+}
+
 void
 TEMPLATE(T, poly_iterated_frobenius_preinv) (TEMPLATE(T, poly_t) * rop,
                                              slong n,
@@ -20,40 +61,26 @@ TEMPLATE(T, poly_iterated_frobenius_preinv) (TEMPLATE(T, poly_t) * rop,
                                              const TEMPLATE(T, poly_t) vinv,
                                              const TEMPLATE(T, ctx_t) ctx)
 {
-    slong i;
     fmpz_t q;
-    TEMPLATE(T, mat_t) HH;
 
-    fmpz_init(q);
+    if (n <= 0)
+        return;
 
-    TEMPLATE(T, ctx_order) (q, ctx);
     TEMPLATE(T, poly_gen) (rop[0], ctx);
 
-    if (TEMPLATE(CAP_T, POLY_ITERATED_FROBENIUS_CUTOFF) (ctx, v->length))
-    {
-        TEMPLATE(T, mat_init) (HH, n_sqrt(v->length - 1) + 1, v->length - 1,
-                               ctx);
-        TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (rop[1], rop[0], q, 0, v,
-                                                      vinv, ctx);
-        TEMPLATE(T, poly_precompute_matrix) (HH, rop[1], v, vinv, ctx);
-        for (i = 2; i < n; i++)
-        {
-            TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)
-                (rop[i], rop[i - 1], HH, v, vinv, ctx);
+    if (n == 1)
+        return;
 
-        }
-        TEMPLATE(T, mat_clear) (HH, ctx);
-    }
-    else
-    {
-        for (i = 1; i < n; i++)
-            TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (rop[i], rop[i - 1],
-                                                          q, 0, v, vinv, ctx);
+    fmpz_init(q);
+    TEMPLATE(T, ctx_order) (q, ctx);
 
-    }
+    TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (rop[1], rop[0], q, 0, v,
+                                                  vinv, ctx);
 
-    fmpz_clear(q);
+    _TEMPLATE(T, poly_iterated_frobenius_preinv) (
+                  (TEMPLATE(T, poly_struct) *) rop, 2, n, v, vinv, ctx);
 
+    fmpz_clear(q);
 }
 
 #endif
@@ -5,6 +5,7 @@
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2012 Lina Kulakova
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -39,6 +40,8 @@ main(void)
 
         TEMPLATE(T, ctx_randtest) (ctx, state);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         TEMPLATE(T, poly_init) (poly1, ctx);
         TEMPLATE(T, poly_init) (poly, ctx);
         TEMPLATE(T, poly_init) (q, ctx);
@@ -88,6 +91,8 @@ main(void)
         TEMPLATE(T, poly_factor_init) (res, ctx);
         TEMPLATE(T, poly_factor_distinct_deg) (res, poly1, &degs, ctx);
 
+        flint_set_num_threads(1);
+
         TEMPLATE(T, poly_init) (product, ctx);
         TEMPLATE(T, poly_one) (product, ctx);
         for (i = 0; i < res->num; i++)
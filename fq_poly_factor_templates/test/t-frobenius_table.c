@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("frobenius_table....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_frobenius_table_t) tab;
+        TEMPLATE(T, poly_t) f, finv, g, a, b;
+        fmpz_t q;
+        slong j, k, len;
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_init(q);
+        TEMPLATE(T, ctx_order) (q, ctx);
+
+        TEMPLATE(T, poly_init) (f, ctx);
+        TEMPLATE(T, poly_init) (finv, ctx);
+        TEMPLATE(T, poly_init) (g, ctx);
+        TEMPLATE(T, poly_init) (a, ctx);
+        TEMPLATE(T, poly_init) (b, ctx);
+
+        TEMPLATE(T, poly_randtest_not_zero) (f, state,
+                                             n_randint(state, 30) + 2, ctx);
+        while (f->length < 2)
+            TEMPLATE(T, poly_randtest_not_zero) (f, state,
+                                             n_randint(state, 30) + 2, ctx);
+
+        TEMPLATE(T, poly_frobenius_table_init) (tab, f, ctx);
+
+        TEMPLATE(T, poly_make_monic) (f, f, ctx);
+        TEMPLATE(T, poly_reverse) (finv, f, f->length, ctx);
+        TEMPLATE(T, poly_inv_series_newton) (finv, finv, f->length, ctx);
+
+        /* the table grows in steps of random size */
+        for (k = 0; k < 3; k++)
+        {
+            len = tab->length + n_randint(state, 12);
+            TEMPLATE(T, poly_frobenius_table_fit_length) (tab, len, ctx);
+
+            TEMPLATE(T, poly_gen) (a, ctx);
+            TEMPLATE(T, poly_rem) (a, a, f, ctx);
+            for (j = 0; j < len; j++)
+            {
+                if (!TEMPLATE(T, poly_equal) (a, tab->pows + j, ctx))
+                {
+                    flint_printf("FAIL (table):\n");
+                    flint_printf("j = %wd, len = %wd\n", j, len);
+                    TEMPLATE(T, poly_print) (f, ctx);
+                    flint_printf("\n");
+                    abort();
+                }
+                TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (a, a, q, 0,
+                                                           f, finv, ctx);
+            }
+        }
+
+        /* g^{q^j} mod f */
+        TEMPLATE(T, poly_randtest) (g, state, n_randint(state, 50), ctx);
+        j = n_randint(state, 2 * tab->length + 1);
+        TEMPLATE(T, poly_frobenius_table_compose) (b, g, j, tab, ctx);
+
+        flint_set_num_threads(1);
+
+        TEMPLATE(T, poly_rem) (a, g, f, ctx);
+        for (k = 0; k < j; k++)
+            TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (a, a, q, 0,
+                                                          f, finv, ctx);
+
+        if (!TEMPLATE(T, poly_equal) (a, b, ctx))
+        {
+            flint_printf("FAIL (compose):\n");
+            flint_printf("j = %wd\n", j);
+            flint_printf("f:\n");
+            TEMPLATE(T, poly_print) (f, ctx);
+            flint_printf("\ng:\n");
+            TEMPLATE(T, poly_print) (g, ctx);
+            flint_printf("\na:\n");
+            TEMPLATE(T, poly_print) (a, ctx);
+            flint_printf("\nb:\n");
+            TEMPLATE(T, poly_print) (b, ctx);
+            flint_printf("\n");
+            abort();
+        }
+
+        TEMPLATE(T, poly_frobenius_table_clear) (tab, ctx);
+
+        TEMPLATE(T, poly_clear) (f, ctx);
+        TEMPLATE(T, poly_clear) (finv, ctx);
+        TEMPLATE(T, poly_clear) (g, ctx);
+        TEMPLATE(T, poly_clear) (a, ctx);
+        TEMPLATE(T, poly_clear) (b, ctx);
+        fmpz_clear(q);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -45,7 +46,7 @@ main(void)
         TEMPLATE(T, poly_reverse) (vinv, v, v->length, ctx);
         TEMPLATE(T, poly_inv_series_newton) (vinv, vinv, v->length, ctx);
 
-        n = n_randint(state, 5) + 2;
+        n = n_randint(state, 20) + 2;
         if (!(h1 = flint_malloc((2 * n) * sizeof(TEMPLATE(T, poly_struct)))))
         {
             flint_printf("Exception (t-fq_poly_iterated_frobenius_preinv):\n");
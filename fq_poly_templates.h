@@ -2,6 +2,7 @@
     Copyright (C) 2012 Andres Goens
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -1129,6 +1130,30 @@ FLINT_DLL void TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)(
     const TEMPLATE(T, poly_t) poly3inv,
     const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL void _TEMPLATE(T, poly_compose_mod_brent_kung_vec_precomp_preinv)(
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1,
+    const TEMPLATE(T, mat_t) A,
+    const TEMPLATE(T, struct) * poly3, slong len3,
+    const TEMPLATE(T, struct) * poly3inv, slong len3inv,
+    const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv)(
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1,
+    const TEMPLATE(T, struct) * g,
+    const TEMPLATE(T, struct) * poly3, slong len3,
+    const TEMPLATE(T, struct) * poly3inv, slong len3inv,
+    const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv)(
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1,
+    const TEMPLATE(T, poly_t) g,
+    const TEMPLATE(T, poly_t) poly3,
+    const TEMPLATE(T, poly_t) poly3inv,
+    const TEMPLATE(T, ctx_t) ctx);
+
 /*  Input and output  ********************************************************/
 
 FLINT_DLL int _TEMPLATE(T, poly_fprint_pretty)(FILE *file,
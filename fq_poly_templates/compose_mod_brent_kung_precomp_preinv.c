@@ -2,6 +2,7 @@
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2013 Martin Lee
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -53,7 +54,7 @@ _TEMPLATE(T, poly_precompute_matrix) (
 
     n = len2 - 1;
 
-    m = n_sqrt(n) + 1;
+    m = A->r;
 
     TEMPLATE(T, one) (TEMPLATE(T, mat_entry) (A, 0, 0), ctx);
     _TEMPLATE(T, vec_set) (A->rows[1], poly1, n, ctx);
@@ -0,0 +1,311 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include <pthread.h>
+
+#include "templates.h"
+
+#include "ulong_extras.h"
+
+typedef struct
+{
+    TEMPLATE(T, poly_struct) * res;
+    const TEMPLATE(T, mat_struct) * C;
+    const TEMPLATE(T, struct) * h;
+    const TEMPLATE(T, struct) * poly3;
+    const TEMPLATE(T, struct) * poly3inv;
+    const TEMPLATE(T, ctx_struct) * ctx;
+    slong start;
+    slong stop;
+    slong k;
+    slong len3;
+    slong len3inv;
+}
+TEMPLATE(T, poly_compose_vec_arg_t);
+
+/* Horner steps for the polynomials start, ..., stop - 1 */
+static void
+TEMPLATE(T, poly_compose_vec_horner)(TEMPLATE(T, poly_compose_vec_arg_t) * arg)
+{
+    const TEMPLATE(T, mat_struct) * C = arg->C;
+    slong i, j, k = arg->k, n = arg->len3 - 1;
+    TEMPLATE(T, struct) * t, * r;
+
+    t = _TEMPLATE(T, vec_init) (n, arg->ctx);
+
+    for (j = arg->start; j < arg->stop; j++)
+    {
+        r = (arg->res + j)->coeffs;
+
+        _TEMPLATE(T, vec_set) (r, C->rows[(j + 1) * k - 1], n, arg->ctx);
+        for (i = 2; i <= k; i++)
+        {
+            _TEMPLATE(T, poly_mulmod_preinv) (t, r, n, arg->h, n,
+                                      arg->poly3, arg->len3,
+                                      arg->poly3inv, arg->len3inv, arg->ctx);
+            _TEMPLATE(T, poly_add) (r, t, n, C->rows[(j + 1) * k - i], n,
+                                    arg->ctx);
+        }
+    }
+
+    _TEMPLATE(T, vec_clear) (t, n, arg->ctx);
+}
+
+static void *
+TEMPLATE(T, poly_compose_vec_worker)(void * arg_ptr)
+{
+    TEMPLATE(T, poly_compose_vec_horner)
+        ((TEMPLATE(T, poly_compose_vec_arg_t) *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_TEMPLATE(T, poly_compose_mod_brent_kung_vec_precomp_preinv) (
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1,
+    const TEMPLATE(T, mat_t) A,
+    const TEMPLATE(T, struct) * poly3, slong len3,
+    const TEMPLATE(T, struct) * poly3inv, slong len3inv,
+    const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, mat_t) B, C;
+    TEMPLATE(T, struct) * h;
+    TEMPLATE(T, poly_compose_vec_arg_t) * args;
+    pthread_t * threads;
+    slong i, j, k, m, n, len, num_threads, chunk;
+
+    n = len3 - 1;
+    m = A->r;
+    k = n / m + 1;
+
+    TEMPLATE(T, mat_init) (B, k * len1, m, ctx);
+    TEMPLATE(T, mat_init) (C, k * len1, n, ctx);
+
+    h = _TEMPLATE(T, vec_init) (n, ctx);
+
+    /*
+        All polynomials are cut into segments of the same length, so that
+        they are multiplied by the powers of g in a single matrix product
+    */
+    for (j = 0; j < len1; j++)
+    {
+        len = (polys + j)->length;
+        for (i = 0; i < len / m; i++)
+            _TEMPLATE(T, vec_set) (B->rows[i + j * k],
+                                   (polys + j)->coeffs + i * m, m, ctx);
+        _TEMPLATE(T, vec_set) (B->rows[i + j * k],
+                               (polys + j)->coeffs + i * m, len % m, ctx);
+    }
+
+    TEMPLATE(T, mat_mul) (C, B, A, ctx);
+
+    /* h = g^m is the step of the block Horner scheme */
+    _TEMPLATE(T, poly_mulmod_preinv) (h, A->rows[m - 1], n, A->rows[1], n,
+                                      poly3, len3, poly3inv, len3inv, ctx);
+
+    /* The Horner steps of different polynomials are independent */
+    num_threads = FLINT_MIN(flint_get_num_threads(), len1);
+    chunk = (len1 + num_threads - 1) / num_threads;
+    num_threads = (len1 + chunk - 1) / chunk;
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(TEMPLATE(T, poly_compose_vec_arg_t))
+                                                              * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res      = res;
+        args[i].C        = C;
+        args[i].h        = h;
+        args[i].poly3    = poly3;
+        args[i].poly3inv = poly3inv;
+        args[i].ctx      = ctx;
+        args[i].start    = i * chunk;
+        args[i].stop     = FLINT_MIN((i + 1) * chunk, len1);
+        args[i].k        = k;
+        args[i].len3     = len3;
+        args[i].len3inv  = len3inv;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+                       TEMPLATE(T, poly_compose_vec_worker), &args[i]);
+
+    TEMPLATE(T, poly_compose_vec_horner) (&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+
+    _TEMPLATE(T, vec_clear) (h, n, ctx);
+
+    TEMPLATE(T, mat_clear) (B, ctx);
+    TEMPLATE(T, mat_clear) (C, ctx);
+}
+
+void
+_TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1,
+    const TEMPLATE(T, struct) * g,
+    const TEMPLATE(T, struct) * poly3, slong len3,
+    const TEMPLATE(T, struct) * poly3inv, slong len3inv,
+    const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, mat_t) A;
+    slong n = len3 - 1;
+
+    /* the block size balances the powers of g against the Horner steps */
+    TEMPLATE(T, mat_init) (A, FLINT_MIN(n, n_sqrt(n * len1) + 1), n, ctx);
+
+    _TEMPLATE(T, poly_precompute_matrix) (A, g, poly3, len3,
+                                          poly3inv, len3inv, ctx);
+
+    _TEMPLATE(T, poly_compose_mod_brent_kung_vec_precomp_preinv) (res,
+                  polys, len1, A, poly3, len3, poly3inv, len3inv, ctx);
+
+    TEMPLATE(T, mat_clear) (A, ctx);
+}
+
+void
+TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (
+    TEMPLATE(T, poly_struct) * res,
+    const TEMPLATE(T, poly_struct) * polys, slong len1,
+    const TEMPLATE(T, poly_t) g,
+    const TEMPLATE(T, poly_t) poly3,
+    const TEMPLATE(T, poly_t) poly3inv,
+    const TEMPLATE(T, ctx_t) ctx)
+{
+    slong len3 = poly3->length;
+    slong i, n = len3 - 1;
+    TEMPLATE(T, struct) * ptr;
+
+    if (len3 == 0)
+    {
+        TEMPLATE_PRINTF
+            ("Exception (%s_poly_compose_mod_brent_kung_vec_preinv). "
+             "Division by zero.\n", T);
+        flint_abort();
+    }
+
+    for (i = 0; i < len1; i++)
+    {
+        if ((polys + i)->length >= len3)
+        {
+            TEMPLATE_PRINTF
+                ("Exception (%s_poly_compose_mod_brent_kung_vec_preinv). "
+                 "The degree of\n", T);
+            flint_printf
+                ("the polynomials must be smaller than that of the modulus.\n");
+            flint_abort();
+        }
+    }
+
+    if (len1 == 0)
+        return;
+
+    if (len3 <= 2 || g->length <= 1)
+    {
+        TEMPLATE(T, t) c;
+
+        /* the composition only depends on the constant g mod poly3 */
+        TEMPLATE(T, init) (c, ctx);
+        if (len3 == 2)
+        {
+            TEMPLATE(T, poly_t) r;
+            TEMPLATE(T, poly_init) (r, ctx);
+            TEMPLATE(T, poly_rem) (r, g, poly3, ctx);
+            TEMPLATE(T, poly_get_coeff) (c, r, 0, ctx);
+            TEMPLATE(T, poly_clear) (r, ctx);
+        }
+        else if (g->length == 1)
+            TEMPLATE(T, set) (c, g->coeffs, ctx);
+
+        for (i = 0; i < len1; i++)
+        {
+            if (len3 == 1)
+                TEMPLATE(T, poly_zero) (res + i, ctx);
+            else
+            {
+                TEMPLATE(T, t) e;
+                TEMPLATE(T, init) (e, ctx);
+                TEMPLATE3(T, poly_evaluate, T) (e, polys + i, c, ctx);
+                TEMPLATE3(T, poly_set, T) (res + i, e, ctx);
+                TEMPLATE(T, clear) (e, ctx);
+            }
+        }
+
+        TEMPLATE(T, clear) (c, ctx);
+        return;
+    }
+
+    for (i = 0; i < len1; i++)
+    {
+        if (res + i == poly3 || res + i == poly3inv || res + i == g
+                                        || res + i == polys + i)
+        {
+            TEMPLATE(T, poly_struct) * tmp;
+            slong j;
+
+            tmp = flint_malloc(sizeof(TEMPLATE(T, poly_struct)) * len1);
+            for (j = 0; j < len1; j++)
+                TEMPLATE(T, poly_init) (tmp + j, ctx);
+
+            TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (tmp, polys,
+                                            len1, g, poly3, poly3inv, ctx);
+
+            for (j = 0; j < len1; j++)
+            {
+                TEMPLATE(T, poly_swap) (res + j, tmp + j, ctx);
+                TEMPLATE(T, poly_clear) (tmp + j, ctx);
+            }
+            flint_free(tmp);
+            return;
+        }
+    }
+
+    ptr = _TEMPLATE(T, vec_init) (n, ctx);
+
+    if (g->length <= n)
+        _TEMPLATE(T, vec_set) (ptr, g->coeffs, g->length, ctx);
+    else
+    {
+        TEMPLATE(T, t) inv3;
+        TEMPLATE(T, init) (inv3, ctx);
+        TEMPLATE(T, inv) (inv3, poly3->coeffs + len3 - 1, ctx);
+        _TEMPLATE(T, poly_rem) (ptr, g->coeffs, g->length,
+                                poly3->coeffs, len3, inv3, ctx);
+        TEMPLATE(T, clear) (inv3, ctx);
+    }
+
+    for (i = 0; i < len1; i++)
+        TEMPLATE(T, poly_fit_length) (res + i, n, ctx);
+
+    _TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (res, polys, len1,
+                                ptr, poly3->coeffs, len3, poly3inv->coeffs,
+                                poly3inv->length, ctx);
+
+    for (i = 0; i < len1; i++)
+    {
+        _TEMPLATE(T, poly_set_length) (res + i, n, ctx);
+        _TEMPLATE(T, poly_normalise) (res + i, ctx);
+    }
+
+    _TEMPLATE(T, vec_clear) (ptr, n, ctx);
+}
+
+#endif
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -24,6 +25,12 @@ _TEMPLATE(T, poly_mul) (TEMPLATE(T, struct) * rop,
     {
         _TEMPLATE(T, poly_mul_classical) (rop, op1, len1, op2, len2, ctx);
     }
+#ifdef USE_MUL_UNIVARIATE
+    else if (TEMPLATE(T, ctx_degree) (ctx) < TEMPLATE(CAP_T, MUL_UNIVARIATE_CUTOFF))
+    {
+        _TEMPLATE(T, poly_mul_univariate) (rop, op1, len1, op2, len2, ctx);
+    }
+#endif
 #ifdef USE_MUL_REORDER
     else if (TEMPLATE(T, ctx_degree) (ctx) < 4)
     {
@@ -2,6 +2,7 @@
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2010, 2012 Sebastian Pancratz
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -27,6 +28,13 @@ _TEMPLATE(T, poly_mullow) (TEMPLATE(T, struct) * rop,
         _TEMPLATE(T, poly_mullow_classical) (rop, op1, len1, op2, len2, n,
                                              ctx);
     }
+#ifdef USE_MULLOW_UNIVARIATE
+    else if (TEMPLATE(T, ctx_degree) (ctx) < TEMPLATE(CAP_T, MUL_UNIVARIATE_CUTOFF))
+    {
+        _TEMPLATE(T, poly_mullow_univariate) (rop, op1, len1, op2, len2, n,
+                                              ctx);
+    }
+#endif
     else
     {
         _TEMPLATE(T, poly_mullow_KS) (rop, op1, len1, op2, len2, n, ctx);
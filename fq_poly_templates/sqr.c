@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -23,6 +24,12 @@ _TEMPLATE(T, poly_sqr) (TEMPLATE(T, struct) * rop,
     {
         _TEMPLATE(T, poly_sqr_classical) (rop, op, len, ctx);
     }
+#ifdef USE_SQR_UNIVARIATE
+    else if (TEMPLATE(T, ctx_degree) (ctx) < TEMPLATE(CAP_T, MUL_UNIVARIATE_CUTOFF))
+    {
+        _TEMPLATE(T, poly_mul_univariate) (rop, op, len, op, len, ctx);
+    }
+#endif
 #ifdef USE_SQR_REORDER
     else if (TEMPLATE(T, ctx_degree) (ctx) < 4)
     {
@@ -0,0 +1,126 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("compose_mod_brent_kung_vec_preinv....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) b, c, cinv, e;
+        TEMPLATE(T, poly_struct) * a, * d;
+        slong j, len1;
+        int aliasing;
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+        len1 = n_randint(state, 12) + 1;
+        aliasing = n_randint(state, 2);
+
+        a = flint_malloc(sizeof(TEMPLATE(T, poly_struct)) * len1);
+        d = flint_malloc(sizeof(TEMPLATE(T, poly_struct)) * len1);
+
+        TEMPLATE(T, poly_init) (b, ctx);
+        TEMPLATE(T, poly_init) (c, ctx);
+        TEMPLATE(T, poly_init) (cinv, ctx);
+        TEMPLATE(T, poly_init) (e, ctx);
+
+        TEMPLATE(T, poly_randtest) (b, state, n_randint(state, 30) + 1, ctx);
+        TEMPLATE(T, poly_randtest_not_zero) (c, state,
+                                             n_randint(state, 30) + 1, ctx);
+
+        TEMPLATE(T, poly_reverse) (cinv, c, c->length, ctx);
+        TEMPLATE(T, poly_inv_series_newton) (cinv, cinv, c->length, ctx);
+
+        for (j = 0; j < len1; j++)
+        {
+            TEMPLATE(T, poly_init) (a + j, ctx);
+            TEMPLATE(T, poly_init) (d + j, ctx);
+            TEMPLATE(T, poly_randtest) (a + j, state,
+                                        n_randint(state, 30) + 1, ctx);
+            TEMPLATE(T, poly_rem) (a + j, a + j, c, ctx);
+        }
+
+        if (aliasing)
+        {
+            for (j = 0; j < len1; j++)
+                TEMPLATE(T, poly_set) (d + j, a + j, ctx);
+            TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (d, d, len1,
+                                                          b, c, cinv, ctx);
+        }
+        else
+            TEMPLATE(T, poly_compose_mod_brent_kung_vec_preinv) (d, a, len1,
+                                                          b, c, cinv, ctx);
+
+        flint_set_num_threads(1);
+
+        for (j = 0; j < len1; j++)
+        {
+            TEMPLATE(T, poly_compose) (e, a + j, b, ctx);
+            TEMPLATE(T, poly_rem) (e, e, c, ctx);
+
+            if (!TEMPLATE(T, poly_equal) (d + j, e, ctx))
+            {
+                flint_printf("FAIL (composition):\n");
+                flint_printf("aliasing = %d, j = %wd, len1 = %wd\n",
+                             aliasing, j, len1);
+                flint_printf("a:\n");
+                TEMPLATE(T, poly_print) (a + j, ctx);
+                flint_printf("\n");
+                flint_printf("b:\n");
+                TEMPLATE(T, poly_print) (b, ctx);
+                flint_printf("\n");
+                flint_printf("c:\n");
+                TEMPLATE(T, poly_print) (c, ctx);
+                flint_printf("\n");
+                flint_printf("d:\n");
+                TEMPLATE(T, poly_print) (d + j, ctx);
+                flint_printf("\n");
+                flint_printf("e:\n");
+                TEMPLATE(T, poly_print) (e, ctx);
+                flint_printf("\n");
+                abort();
+            }
+        }
+
+        for (j = 0; j < len1; j++)
+        {
+            TEMPLATE(T, poly_clear) (a + j, ctx);
+            TEMPLATE(T, poly_clear) (d + j, ctx);
+        }
+        flint_free(a);
+        flint_free(d);
+
+        TEMPLATE(T, poly_clear) (b, ctx);
+        TEMPLATE(T, poly_clear) (c, ctx);
+        TEMPLATE(T, poly_clear) (cinv, ctx);
+        TEMPLATE(T, poly_clear) (e, ctx);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -45,6 +46,7 @@ typedef struct
     mp_limb_t *zech_log_table;
     mp_limb_t *prime_field_table;
     mp_limb_t *eval_table;
+    void *tables;               /* shared mapping holding the tables, or NULL */
 
     fq_nmod_ctx_struct *fq_nmod_ctx;
     int owns_fq_nmod_ctx;
@@ -65,6 +67,20 @@ FLINT_DLL void fq_zech_ctx_init_modulus(fq_zech_ctx_t ctx,
                               const nmod_poly_t modulus,
                               const char *var);
 
+FLINT_DLL int fq_zech_ctx_init_fq_nmod_ctx_mmap(fq_zech_ctx_t ctx,
+                        fq_nmod_ctx_t fq_nmod_ctx, const char * filename);
+
+FLINT_DLL int fq_zech_ctx_init_modulus_mmap(fq_zech_ctx_t ctx,
+        const nmod_poly_t modulus, const char * var, const char * filename);
+
+FLINT_DLL void _fq_zech_ctx_init_params(fq_zech_ctx_t ctx,
+                                            fq_nmod_ctx_t fq_nmod_ctx);
+
+FLINT_DLL void _fq_zech_ctx_init_tables(mp_ptr zech_log_table,
+    mp_ptr prime_field_table, mp_ptr eval_table, const fq_zech_ctx_t ctx);
+
+FLINT_DLL void _fq_zech_ctx_tables_clear(void * tables);
+
 FLINT_DLL void fq_zech_ctx_randtest(fq_zech_ctx_t ctx, flint_rand_t state);
 
 FLINT_DLL void fq_zech_ctx_randtest_reducible(fq_zech_ctx_t ctx, flint_rand_t state);
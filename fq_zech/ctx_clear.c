@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -17,9 +18,16 @@
 void
 fq_zech_ctx_clear(fq_zech_ctx_t ctx)
 {
-    flint_free(ctx->zech_log_table);
-    flint_free(ctx->prime_field_table);
-    flint_free(ctx->eval_table);
+    if (ctx->tables != NULL)
+    {
+        _fq_zech_ctx_tables_clear(ctx->tables);
+    }
+    else
+    {
+        flint_free(ctx->zech_log_table);
+        flint_free(ctx->prime_field_table);
+        flint_free(ctx->eval_table);
+    }
 
     if (ctx->owns_fq_nmod_ctx)
     {
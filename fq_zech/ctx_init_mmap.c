@@ -0,0 +1,303 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/* for mkstemp, fchmod and ftruncate under -ansi */
+#define _XOPEN_SOURCE 700
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "fq_zech.h"
+
+#if (!defined (__WIN32) || defined(__CYGWIN__)) && !defined(_MSC_VER)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+    A table file consists of the header
+
+        magic, p, d, len, a[0], ..., a[len - 1], j[0], ..., j[len - 1]
+
+    describing the monic modulus by its nonzero terms, followed by the
+    Zech logarithm table (q limbs), the prime field table (p limbs) and
+    the evaluation table (q limbs), all as native limbs so that the
+    tables can be used in place.
+*/
+#define FQ_ZECH_TABLES_MAGIC (UWORD(0x5a454348) + FLINT_BITS)
+
+typedef struct fq_zech_tables_struct
+{
+    mp_limb_t * map;
+    size_t size;
+    slong refcount;
+    struct fq_zech_tables_struct * next;
+}
+fq_zech_tables_struct;
+
+/* mappings currently in use by some context of this process */
+static fq_zech_tables_struct * _fq_zech_tables_list = NULL;
+static pthread_mutex_t _fq_zech_tables_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static slong
+_fq_zech_tables_header_len(const fq_nmod_ctx_t ctx)
+{
+    return 4 + 2 * ctx->len;
+}
+
+static size_t
+_fq_zech_tables_size(const fq_zech_ctx_t ctx)
+{
+    return sizeof(mp_limb_t) * (_fq_zech_tables_header_len(ctx->fq_nmod_ctx)
+                                        + 2 * (ctx->qm1 + 1) + ctx->p);
+}
+
+static void
+_fq_zech_tables_header(mp_ptr H, const fq_zech_ctx_t ctx)
+{
+    const fq_nmod_ctx_struct * fctx = ctx->fq_nmod_ctx;
+    slong k;
+
+    H[0] = FQ_ZECH_TABLES_MAGIC;
+    H[1] = ctx->p;
+    H[2] = fq_nmod_ctx_degree(fctx);
+    H[3] = fctx->len;
+    for (k = 0; k < fctx->len; k++)
+    {
+        H[4 + k] = fctx->a[k];
+        H[4 + fctx->len + k] = fctx->j[k];
+    }
+}
+
+static int
+_fq_zech_tables_match(const mp_limb_t * map, size_t size,
+                                                const fq_zech_ctx_t ctx)
+{
+    mp_limb_t H[4 + 2 * (FLINT_BITS + 1)];
+    slong len = _fq_zech_tables_header_len(ctx->fq_nmod_ctx);
+
+    if (size != _fq_zech_tables_size(ctx))
+        return 0;
+
+    _fq_zech_tables_header(H, ctx);
+
+    return memcmp(H, map, sizeof(mp_limb_t) * len) == 0;
+}
+
+static void
+_fq_zech_tables_attach(fq_zech_ctx_t ctx, fq_zech_tables_struct * T)
+{
+    slong len = _fq_zech_tables_header_len(ctx->fq_nmod_ctx);
+
+    T->refcount++;
+    ctx->tables = T;
+    ctx->zech_log_table = T->map + len;
+    ctx->prime_field_table = T->map + len + ctx->qm1 + 1;
+    ctx->eval_table = T->map + len + ctx->qm1 + 1 + ctx->p;
+}
+
+/*
+    Builds the tables into a temporary file next to filename, which is
+    renamed into place once complete, so that other processes never see a
+    partial file. Returns a read only mapping of the result or NULL.
+*/
+static mp_limb_t *
+_fq_zech_tables_build(const char * filename, const fq_zech_ctx_t ctx)
+{
+    size_t size = _fq_zech_tables_size(ctx);
+    slong len = _fq_zech_tables_header_len(ctx->fq_nmod_ctx);
+    mp_limb_t * map, * res = NULL;
+    char * tmpname;
+    int fd;
+
+    tmpname = flint_malloc(strlen(filename) + 8);
+    strcpy(tmpname, filename);
+    strcat(tmpname, ".XXXXXX");
+
+    fd = mkstemp(tmpname);
+    if (fd == -1)
+    {
+        flint_free(tmpname);
+        return NULL;
+    }
+
+    if (fchmod(fd, 0644) == 0 && ftruncate(fd, size) == 0)
+    {
+        map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        if (map != MAP_FAILED)
+        {
+            _fq_zech_tables_header(map, ctx);
+            _fq_zech_ctx_init_tables(map + len, map + len + ctx->qm1 + 1,
+                                map + len + ctx->qm1 + 1 + ctx->p, ctx);
+            munmap(map, size);
+
+            map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+
+            if (map != MAP_FAILED)
+            {
+                if (rename(tmpname, filename) == 0)
+                    res = map;
+                else
+                    munmap(map, size);
+            }
+        }
+    }
+
+    if (res == NULL)
+        unlink(tmpname);
+
+    close(fd);
+    flint_free(tmpname);
+
+    return res;
+}
+
+/* Returns a read only mapping of the existing file, or NULL. */
+static mp_limb_t *
+_fq_zech_tables_open(const char * filename, const fq_zech_ctx_t ctx, int * exists)
+{
+    size_t size = _fq_zech_tables_size(ctx);
+    mp_limb_t * map;
+    struct stat st;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    *exists = (fd != -1 || errno != ENOENT);
+
+    if (fd == -1)
+        return NULL;
+
+    map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t) st.st_size == size)
+        map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (map == MAP_FAILED)
+        return NULL;
+
+    if (!_fq_zech_tables_match(map, size, ctx))
+    {
+        munmap(map, size);
+        return NULL;
+    }
+
+    return map;
+}
+
+int
+fq_zech_ctx_init_fq_nmod_ctx_mmap(fq_zech_ctx_t ctx,
+                        fq_nmod_ctx_t fq_nmod_ctx, const char * filename)
+{
+    fq_zech_tables_struct * T;
+    mp_limb_t * map;
+    int exists;
+
+    _fq_zech_ctx_init_params(ctx, fq_nmod_ctx);
+
+    pthread_mutex_lock(&_fq_zech_tables_lock);
+
+    /* share a mapping of this process for the same field */
+    for (T = _fq_zech_tables_list; T != NULL; T = T->next)
+        if (_fq_zech_tables_match(T->map, T->size, ctx))
+            break;
+
+    if (T == NULL)
+    {
+        map = _fq_zech_tables_open(filename, ctx, &exists);
+
+        /* never replace a file that is there but does not match */
+        if (map == NULL && !exists)
+            map = _fq_zech_tables_build(filename, ctx);
+
+        if (map != NULL)
+        {
+            T = flint_malloc(sizeof(fq_zech_tables_struct));
+            T->map = map;
+            T->size = _fq_zech_tables_size(ctx);
+            T->refcount = 0;
+            T->next = _fq_zech_tables_list;
+            _fq_zech_tables_list = T;
+        }
+    }
+
+    if (T != NULL)
+        _fq_zech_tables_attach(ctx, T);
+
+    pthread_mutex_unlock(&_fq_zech_tables_lock);
+
+    if (T == NULL)
+    {
+        /* fall back to tables owned by the context */
+        fq_zech_ctx_init_fq_nmod_ctx(ctx, fq_nmod_ctx);
+        return 0;
+    }
+
+    return 1;
+}
+
+void
+_fq_zech_ctx_tables_clear(void * tables)
+{
+    fq_zech_tables_struct * T = tables, ** prev;
+
+    pthread_mutex_lock(&_fq_zech_tables_lock);
+
+    if (--T->refcount == 0)
+    {
+        for (prev = &_fq_zech_tables_list; *prev != T; prev = &(*prev)->next)
+            ;
+
+        *prev = T->next;
+        munmap(T->map, T->size);
+        flint_free(T);
+    }
+
+    pthread_mutex_unlock(&_fq_zech_tables_lock);
+}
+
+#else
+
+int
+fq_zech_ctx_init_fq_nmod_ctx_mmap(fq_zech_ctx_t ctx,
+                        fq_nmod_ctx_t fq_nmod_ctx, const char * filename)
+{
+    fq_zech_ctx_init_fq_nmod_ctx(ctx, fq_nmod_ctx);
+    return 0;
+}
+
+void
+_fq_zech_ctx_tables_clear(void * tables)
+{
+}
+
+#endif
+
+int
+fq_zech_ctx_init_modulus_mmap(fq_zech_ctx_t ctx, const nmod_poly_t modulus,
+                                const char * var, const char * filename)
+{
+    fq_nmod_ctx_struct * fq_nmod_ctx;
+    int result;
+
+    fq_nmod_ctx = flint_malloc(sizeof(fq_nmod_ctx_struct));
+
+    fq_nmod_ctx_init_modulus(fq_nmod_ctx, modulus, var);
+    result = fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx, fq_nmod_ctx, filename);
+    ctx->owns_fq_nmod_ctx = 1;
+
+    return result;
+}
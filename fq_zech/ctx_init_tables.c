@@ -0,0 +1,178 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "fq_zech.h"
+
+typedef struct
+{
+    mp_ptr prime_field_table;
+    mp_ptr eval_table;
+    mp_ptr reverse_table;
+    mp_ptr zech_log_table;
+    mp_limb_t start;
+    mp_limb_t stop;
+    const fq_zech_ctx_struct * ctx;
+}
+zech_tables_arg_t;
+
+/*
+    Runs through the powers gen^i for start <= i < stop, recording the
+    integer obtained by evaluating each power at p. Multiplication by the
+    generator is a shift followed by a fold with the sparse modulus.
+*/
+static void
+_fq_zech_tables_powers(zech_tables_arg_t * arg)
+{
+    const fq_nmod_ctx_struct * fctx = arg->ctx->fq_nmod_ctx;
+    const slong d = fq_nmod_ctx_degree(fctx);
+    const nmod_t mod = fctx->mod;
+    mp_ptr c, na;
+    mp_limb_t i, e, top;
+    fq_nmod_t r;
+    slong k;
+    int constant;
+
+    c = flint_malloc(sizeof(mp_limb_t) * (d + fctx->len));
+    na = c + d;
+
+    for (k = 0; k < fctx->len - 1; k++)
+        na[k] = nmod_neg(fctx->a[k], mod);
+
+    fq_nmod_init(r, fctx);
+    fq_nmod_gen(r, fctx);
+    fq_nmod_pow_ui(r, r, arg->start, fctx);
+    for (k = 0; k < d; k++)
+        c[k] = (k < r->length) ? r->coeffs[k] : 0;
+    fq_nmod_clear(r, fctx);
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        e = c[d - 1];
+        constant = 1;
+        for (k = d - 2; k >= 0; k--)
+        {
+            constant &= (e == 0);
+            e = e * mod.n + c[k];
+        }
+
+        arg->reverse_table[e] = i;
+        arg->eval_table[i] = e;
+        if (constant)
+            arg->prime_field_table[e] = i;
+
+        top = c[d - 1];
+        for (k = d - 1; k > 0; k--)
+            c[k] = c[k - 1];
+        c[0] = 0;
+
+        if (top != 0)
+            for (k = 0; k < fctx->len - 1; k++)
+                c[fctx->j[k]] = nmod_add(c[fctx->j[k]],
+                                     nmod_mul(top, na[k], mod), mod);
+    }
+
+    flint_free(c);
+}
+
+/* fills in the Zech logarithms of the elements with start <= n < stop */
+static void
+_fq_zech_tables_zech(zech_tables_arg_t * arg)
+{
+    const mp_limb_t p = arg->ctx->p;
+    mp_limb_t n, nz;
+
+    for (n = arg->start; n < arg->stop; n++)
+    {
+        nz = (n % p == p - 1) ? n - p + 1 : n + 1;
+        arg->zech_log_table[arg->reverse_table[n]] = arg->reverse_table[nz];
+    }
+}
+
+static void *
+_fq_zech_tables_powers_worker(void * arg_ptr)
+{
+    _fq_zech_tables_powers((zech_tables_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void *
+_fq_zech_tables_zech_worker(void * arg_ptr)
+{
+    _fq_zech_tables_zech((zech_tables_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_fq_zech_ctx_init_tables(mp_ptr zech_log_table, mp_ptr prime_field_table,
+                           mp_ptr eval_table, const fq_zech_ctx_t ctx)
+{
+    const mp_limb_t q = ctx->qm1 + 1;
+    pthread_t * threads;
+    zech_tables_arg_t * args;
+    mp_ptr reverse_table;
+    slong i, num_threads;
+
+    reverse_table = flint_malloc(q * sizeof(mp_limb_t));
+
+    zech_log_table[ctx->qm1] = 0;
+    prime_field_table[0] = ctx->qm1;
+    reverse_table[0] = ctx->qm1;
+    eval_table[ctx->qm1] = 0;
+
+    /* not worth a thread below a few thousand elements each */
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(),
+                                                (slong) (q / 4096)));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(zech_tables_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].prime_field_table = prime_field_table;
+        args[i].eval_table = eval_table;
+        args[i].reverse_table = reverse_table;
+        args[i].zech_log_table = zech_log_table;
+        args[i].ctx = ctx;
+        args[i].start = (ctx->qm1 / num_threads) * i;
+        args[i].stop = (i == num_threads - 1) ? ctx->qm1 :
+                                        (ctx->qm1 / num_threads) * (i + 1);
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+                                _fq_zech_tables_powers_worker, &args[i]);
+
+    _fq_zech_tables_powers(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    /* the Zech logarithms need the complete reverse table */
+    args[num_threads - 1].stop = q;
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL,
+                                _fq_zech_tables_zech_worker, &args[i]);
+
+    _fq_zech_tables_zech(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(reverse_table);
+}
@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_zech.h"
+
+static int
+_fq_zech_ctx_tables_equal(const fq_zech_ctx_t ctx1, const fq_zech_ctx_t ctx2)
+{
+    mp_limb_t q = ctx1->qm1 + 1;
+
+    return ctx1->qm1 == ctx2->qm1 && ctx1->p == ctx2->p
+        && _nmod_vec_equal(ctx1->zech_log_table, ctx2->zech_log_table, q)
+        && _nmod_vec_equal(ctx1->prime_field_table,
+                                    ctx2->prime_field_table, ctx1->p)
+        && _nmod_vec_equal(ctx1->eval_table, ctx2->eval_table, q);
+}
+
+int
+main(void)
+{
+    slong i;
+    char filename[64];
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_init_mmap....");
+    fflush(stdout);
+
+    flint_sprintf(filename, "fq_zech_tables_%wu.tab", n_randlimb(state));
+    remove(filename);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fq_zech_ctx_t ctx, ctx1, ctx2;
+        fq_nmod_ctx_t fctx1, fctx2;
+        nmod_poly_t modulus;
+        int res1, res2;
+
+        fq_zech_ctx_randtest(ctx, state);
+
+        nmod_poly_init(modulus, ctx->p);
+        nmod_poly_set(modulus, ctx->fq_nmod_ctx->modulus);
+
+        /* builds and writes the file, or maps the existing one */
+        fq_nmod_ctx_init_modulus(fctx1, modulus, "a");
+        res1 = fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx1, fctx1, filename);
+
+        /* shares the mapping of ctx1 */
+        fq_nmod_ctx_init_modulus(fctx2, modulus, "a");
+        res2 = fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx2, fctx2, filename);
+
+        if (!res1 || !res2 || ctx1->tables != ctx2->tables
+            || !_fq_zech_ctx_tables_equal(ctx, ctx1)
+            || !_fq_zech_ctx_tables_equal(ctx, ctx2))
+        {
+            flint_printf("FAIL (shared):\n\n");
+            fq_zech_ctx_print(ctx);
+            flint_printf("res1 = %d, res2 = %d\n", res1, res2);
+            abort();
+        }
+
+        fq_zech_ctx_clear(ctx1);
+        fq_nmod_ctx_clear(fctx1);
+
+        /* maps the file written above in a fresh registry */
+        fq_zech_ctx_clear(ctx2);
+        res2 = fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx2, fctx2, filename);
+
+        if (!res2 || !_fq_zech_ctx_tables_equal(ctx, ctx2))
+        {
+            flint_printf("FAIL (reload):\n\n");
+            fq_zech_ctx_print(ctx);
+            abort();
+        }
+
+        fq_zech_ctx_clear(ctx2);
+        fq_nmod_ctx_clear(fctx2);
+
+        /* a file for another field is left alone */
+        if (n_randint(state, 2))
+        {
+            fq_zech_ctx_t ctx3;
+
+            fq_zech_ctx_randtest(ctx2, state);
+            res2 = fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx3,
+                                        ctx2->fq_nmod_ctx, filename);
+
+            if (!_fq_zech_ctx_tables_equal(ctx2, ctx3)
+                || res2 != (ctx2->p == ctx->p && ctx2->qm1 == ctx->qm1
+                    && nmod_poly_equal(ctx2->fq_nmod_ctx->modulus, modulus)))
+            {
+                flint_printf("FAIL (other field):\n\n");
+                fq_zech_ctx_print(ctx);
+                fq_zech_ctx_print(ctx2);
+                abort();
+            }
+
+            fq_zech_ctx_clear(ctx3);
+            fq_zech_ctx_clear(ctx2);
+        }
+
+        remove(filename);
+
+        nmod_poly_clear(modulus);
+        fq_zech_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef GF2_MAT_H
+#define GF2_MAT_H
+
+#ifdef GF2_MAT_INLINES_C
+#define GF2_MAT_INLINE FLINT_DLL
+#else
+#define GF2_MAT_INLINE static __inline__
+#endif
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Matrices over GF(2), packed one bit per entry: entry (i, j) is bit
+    j % FLINT_BITS of rows[i][j / FLINT_BITS]. Each row takes stride limbs,
+    and the bits beyond the last column are always zero.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong r;
+    slong c;
+    slong stride;
+    mp_limb_t ** rows;
+}
+gf2_mat_struct;
+
+typedef gf2_mat_struct gf2_mat_t[1];
+
+/* Memory management  ********************************************************/
+
+FLINT_DLL void gf2_mat_init(gf2_mat_t A, slong rows, slong cols);
+
+FLINT_DLL void gf2_mat_init_set(gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_clear(gf2_mat_t A);
+
+FLINT_DLL void gf2_mat_swap(gf2_mat_t A, gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_set(gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_zero(gf2_mat_t A);
+
+FLINT_DLL void gf2_mat_one(gf2_mat_t A);
+
+/* Basic properties and entry access *****************************************/
+
+GF2_MAT_INLINE
+slong gf2_mat_nrows(const gf2_mat_t A)
+{
+    return A->r;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_ncols(const gf2_mat_t A)
+{
+    return A->c;
+}
+
+GF2_MAT_INLINE
+int gf2_mat_get_entry(const gf2_mat_t A, slong i, slong j)
+{
+    return (A->rows[i][j / FLINT_BITS] >> (j % FLINT_BITS)) & 1;
+}
+
+GF2_MAT_INLINE
+void gf2_mat_set_entry(gf2_mat_t A, slong i, slong j, int x)
+{
+    mp_limb_t bit = UWORD(1) << (j % FLINT_BITS);
+
+    if (x & 1)
+        A->rows[i][j / FLINT_BITS] |= bit;
+    else
+        A->rows[i][j / FLINT_BITS] &= ~bit;
+}
+
+FLINT_DLL int gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL int gf2_mat_is_zero(const gf2_mat_t A);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void gf2_mat_set_nmod_mat(gf2_mat_t A, const nmod_mat_t B);
+
+FLINT_DLL void gf2_mat_get_nmod_mat(nmod_mat_t B, const gf2_mat_t A);
+
+/* Random generation and printing ********************************************/
+
+FLINT_DLL void gf2_mat_randtest(gf2_mat_t A, flint_rand_t state);
+
+FLINT_DLL void gf2_mat_print_pretty(const gf2_mat_t A);
+
+/* Arithmetic ****************************************************************/
+
+FLINT_DLL void gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A);
+
+FLINT_DLL void gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A,
+                                                        const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A,
+                                                        const gf2_mat_t B);
+
+FLINT_DLL void gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+/* Elimination ***************************************************************/
+
+FLINT_DLL slong _gf2_mat_rref(gf2_mat_t A, slong * pivots);
+
+FLINT_DLL slong gf2_mat_rref(gf2_mat_t A);
+
+FLINT_DLL slong gf2_mat_rank(const gf2_mat_t A);
+
+FLINT_DLL slong gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A);
+
+FLINT_DLL int gf2_mat_solve(gf2_mat_t X, const gf2_mat_t A, const gf2_mat_t B);
+
+/* Tuning parameters *********************************************************/
+
+/* Matrices with fewer rows or columns than this are multiplied classically */
+#define GF2_MAT_MUL_M4RM_CUTOFF 128
+
+/*
+    Largest number of rows combined in one Four Russians table, and the
+    number of limbs of each table row, chosen so that a table fits in L2
+*/
+#define GF2_MAT_M4R_MAX_K 8
+#define GF2_MAT_M4RM_BLOCK_LIMBS 64
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
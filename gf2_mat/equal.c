@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+int
+gf2_mat_equal(const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j;
+
+    if (A->r != B->r || A->c != B->c)
+        return 0;
+
+    /* the unused bits of each row are zero */
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->stride; j++)
+            if (A->rows[i][j] != B->rows[i][j])
+                return 0;
+
+    return 1;
+}
@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_init(gf2_mat_t A, slong rows, slong cols)
+{
+    A->stride = (cols + FLINT_BITS - 1) / FLINT_BITS;
+
+    if (rows && cols)
+    {
+        slong i;
+
+        A->entries = flint_calloc(rows * A->stride, sizeof(mp_limb_t));
+        A->rows = flint_malloc(rows * sizeof(mp_limb_t *));
+
+        for (i = 0; i < rows; i++)
+            A->rows[i] = A->entries + i * A->stride;
+    }
+    else
+        A->entries = NULL;
+
+    A->r = rows;
+    A->c = cols;
+}
@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, j, l, s;
+    mp_limb_t w;
+    unsigned int b0;
+    mp_ptr c;
+    mp_srcptr b;
+
+    gf2_mat_zero(C);
+
+    if (B->c == 0)
+        return;
+
+    s = B->stride;
+
+    for (i = 0; i < A->r; i++)
+    {
+        c = C->rows[i];
+
+        /* add the rows of B selected by the bits of row i of A */
+        for (l = 0; l < A->stride; l++)
+        {
+            for (w = A->rows[i][l]; w != 0; w &= w - 1)
+            {
+                count_trailing_zeros(b0, w);
+                b = B->rows[l * FLINT_BITS + b0];
+
+                for (j = 0; j < s; j++)
+                    c[j] ^= b[j];
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+/* number of tables applied in each pass over the rows of C */
+#define M4RM_TABLES 4
+
+/*
+    Sets T[idx] to the sum of the rows k0 + b of B for the bits b of idx,
+    restricted to the w limbs starting at limb c0.
+*/
+static void
+_gf2_mat_m4rm_table(mp_ptr T, const gf2_mat_t B, slong k0, slong kk,
+                                                            slong c0, slong w)
+{
+    slong idx, j;
+    unsigned int b0;
+    mp_srcptr b, prev;
+    mp_ptr t;
+
+    for (j = 0; j < w; j++)
+        T[j] = 0;
+
+    /* each entry differs from an earlier one by a single row */
+    for (idx = 1; idx < (WORD(1) << kk); idx++)
+    {
+        prev = T + (idx & (idx - 1)) * w;
+        count_trailing_zeros(b0, (mp_limb_t) idx);
+        b = B->rows[k0 + b0] + c0;
+        t = T + idx * w;
+
+        for (j = 0; j < w; j++)
+            t[j] = prev[j] ^ b[j];
+    }
+}
+
+void
+gf2_mat_mul_m4rm(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    mp_ptr T, c;
+    mp_srcptr t[M4RM_TABLES];
+    mp_limb_t mask;
+    slong m, k, K, c0, k0, kk, w, i, j, l, ntab, size;
+
+    m = A->r;
+    k = A->c;
+
+    gf2_mat_zero(C);
+
+    if (m == 0 || k == 0 || B->c == 0)
+        return;
+
+    /* table indices are read from aligned chunks of K bits of A */
+    K = GF2_MAT_M4R_MAX_K;
+    mask = (UWORD(1) << K) - 1;
+    size = (WORD(1) << K) * GF2_MAT_M4RM_BLOCK_LIMBS;
+
+    T = flint_malloc(sizeof(mp_limb_t) * M4RM_TABLES * size);
+
+    /* columns of B and C in blocks, so that the tables stay in cache */
+    for (c0 = 0; c0 < B->stride; c0 += GF2_MAT_M4RM_BLOCK_LIMBS)
+    {
+        w = FLINT_MIN(GF2_MAT_M4RM_BLOCK_LIMBS, B->stride - c0);
+
+        for (k0 = 0; k0 < k; k0 += M4RM_TABLES * K)
+        {
+            ntab = 0;
+
+            for (l = 0; l < M4RM_TABLES && k0 + l * K < k; l++)
+            {
+                kk = FLINT_MIN(K, k - k0 - l * K);
+                _gf2_mat_m4rm_table(T + l * size, B, k0 + l * K, kk, c0, w);
+                ntab++;
+            }
+
+            for (i = 0; i < m; i++)
+            {
+                mp_srcptr a = A->rows[i];
+                c = C->rows[i] + c0;
+
+                /* the bits of A beyond column k are zero */
+                for (l = 0; l < ntab; l++)
+                {
+                    slong bit = k0 + l * K;
+                    mp_limb_t idx;
+
+                    idx = (a[bit / FLINT_BITS] >> (bit % FLINT_BITS)) & mask;
+                    t[l] = T + l * size + idx * w;
+                }
+
+                if (ntab == M4RM_TABLES)
+                {
+                    for (j = 0; j < w; j++)
+                        c[j] ^= t[0][j] ^ t[1][j] ^ t[2][j] ^ t[3][j];
+                }
+                else
+                {
+                    for (l = 0; l < ntab; l++)
+                        for (j = 0; j < w; j++)
+                            c[j] ^= t[l][j];
+                }
+            }
+        }
+    }
+
+    flint_free(T);
+}
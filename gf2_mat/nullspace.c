@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+slong
+gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A)
+{
+    slong i, j, k, n, rank, nullity;
+    slong * pivots, * nonpivots;
+    gf2_mat_t tmp;
+
+    n = A->c;
+
+    pivots = flint_malloc(sizeof(slong) * FLINT_MAX(1, n));
+
+    gf2_mat_init_set(tmp, A);
+    rank = _gf2_mat_rref(tmp, pivots);
+    nullity = n - rank;
+    nonpivots = pivots + rank;
+
+    for (i = j = k = 0; k < nullity; j++)
+    {
+        if (i < rank && pivots[i] == j)
+            i++;
+        else
+            nonpivots[k++] = j;
+    }
+
+    /* the same basis as nmod_mat_nullspace */
+    gf2_mat_zero(X);
+
+    for (i = 0; i < nullity; i++)
+    {
+        for (j = 0; j < rank; j++)
+            if (gf2_mat_get_entry(tmp, j, nonpivots[i]))
+                gf2_mat_set_entry(X, pivots[j], i, 1);
+
+        gf2_mat_set_entry(X, nonpivots[i], i, 1);
+    }
+
+    flint_free(pivots);
+    gf2_mat_clear(tmp);
+
+    return nullity;
+}
@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_print_pretty(const gf2_mat_t A)
+{
+    slong i, j;
+
+    flint_printf("<%wd x %wd matrix over GF(2)>\n", A->r, A->c);
+
+    for (i = 0; i < A->r; i++)
+    {
+        flint_printf("[");
+        for (j = 0; j < A->c; j++)
+            flint_printf("%d", gf2_mat_get_entry(A, i, j));
+        flint_printf("]\n");
+    }
+}
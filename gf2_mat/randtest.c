@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_randtest(gf2_mat_t A, flint_rand_t state)
+{
+    slong i, j, rem;
+    mp_limb_t mask;
+    int density;
+
+    if (A->c == 0)
+        return;
+
+    /* dense, sparse (one entry in 2^density) or zero-heavy matrices */
+    density = n_randint(state, 4);
+    rem = A->c % FLINT_BITS;
+    mask = (rem == 0) ? ~UWORD(0) : (UWORD(1) << rem) - 1;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->stride; j++)
+        {
+            mp_limb_t w = n_randlimb(state);
+            int k;
+
+            for (k = 0; k < density; k++)
+                w &= n_randlimb(state);
+
+            A->rows[i][j] = w;
+        }
+
+        A->rows[i][A->stride - 1] &= mask;
+    }
+}
@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+slong
+gf2_mat_rank(const gf2_mat_t A)
+{
+    gf2_mat_t T;
+    slong rank;
+
+    gf2_mat_init_set(T, A);
+    rank = gf2_mat_rref(T);
+    gf2_mat_clear(T);
+
+    return rank;
+}
@@ -0,0 +1,166 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+/* adds row src to row dst, starting from limb l0 */
+static __inline__ void
+_gf2_row_add(mp_ptr dst, mp_srcptr src, slong l0, slong len)
+{
+    slong j;
+
+    for (j = l0; j < len; j++)
+        dst[j] ^= src[j];
+}
+
+/* returns the k <= 8 bits of row starting at column c */
+static __inline__ mp_limb_t
+_gf2_row_bits(mp_srcptr row, slong c, slong k, slong len)
+{
+    slong l = c / FLINT_BITS, o = c % FLINT_BITS;
+    mp_limb_t w;
+
+    w = row[l] >> o;
+    if (o + k > FLINT_BITS && l + 1 < len)
+        w |= row[l + 1] << (FLINT_BITS - o);
+
+    return w & ((UWORD(1) << k) - 1);
+}
+
+/*
+    Method of the Four Russians inversion (M4RI): the columns are handled
+    in strips of k. Up to k pivots are found in the strip by Gaussian
+    elimination among the remaining rows, keeping the pivot rows reduced
+    against each other; every other row is then cleared on the pivot
+    columns with a single lookup in a table of all 2^k sums of the pivot
+    rows. Rows below the current pivot row are zero left of the strip, so
+    the table rows and additions start at the limb containing the strip.
+*/
+slong
+_gf2_mat_rref(gf2_mat_t A, slong * pivots)
+{
+    slong m, n, s, r, c, k, K, kk, col, i, p, l0, len, idx;
+    slong pivcol[GF2_MAT_M4R_MAX_K];
+    mp_limb_t w, bits;
+    mp_ptr T, t;
+    mp_srcptr prev;
+    unsigned int b0;
+
+    m = A->r;
+    n = A->c;
+    s = A->stride;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    K = FLINT_MAX(1, FLINT_MIN(GF2_MAT_M4R_MAX_K, FLINT_BIT_COUNT(m) - 3));
+    T = flint_malloc(sizeof(mp_limb_t) * (WORD(1) << K) * s);
+
+    r = 0;
+
+    for (c = 0; c < n && r < m; c += k)
+    {
+        k = FLINT_MIN(K, n - c);
+        l0 = c / FLINT_BITS;
+        len = s - l0;
+        kk = 0;
+
+        for (col = c; col < c + k && r + kk < m; col++)
+        {
+            for (i = r + kk; i < m; i++)
+            {
+                for (p = 0; p < kk; p++)
+                    if (gf2_mat_get_entry(A, i, pivcol[p]))
+                        _gf2_row_add(A->rows[i], A->rows[r + p], l0, s);
+
+                if (gf2_mat_get_entry(A, i, col))
+                    break;
+            }
+
+            if (i == m)
+                continue;
+
+            if (i != r + kk)
+            {
+                mp_ptr u = A->rows[i];
+                A->rows[i] = A->rows[r + kk];
+                A->rows[r + kk] = u;
+            }
+
+            for (p = 0; p < kk; p++)
+                if (gf2_mat_get_entry(A, r + p, col))
+                    _gf2_row_add(A->rows[r + p], A->rows[r + kk], l0, s);
+
+            pivcol[kk++] = col;
+        }
+
+        if (kk == 0)
+            continue;
+
+        /* T[idx] is the sum of the pivot rows r + p for the bits p of idx */
+        for (i = 0; i < len; i++)
+            T[i] = 0;
+
+        for (idx = 1; idx < (WORD(1) << kk); idx++)
+        {
+            count_trailing_zeros(b0, (mp_limb_t) idx);
+            prev = T + (idx & (idx - 1)) * len;
+            t = T + idx * len;
+
+            for (i = 0; i < len; i++)
+                t[i] = prev[i] ^ A->rows[r + b0][l0 + i];
+        }
+
+        for (i = 0; i < m; i++)
+        {
+            if (i == r)
+            {
+                i += kk - 1;
+                continue;
+            }
+
+            bits = _gf2_row_bits(A->rows[i], c, k, s);
+
+            if (bits == 0)
+                continue;
+
+            for (p = 0, w = 0; p < kk; p++)
+                w |= ((bits >> (pivcol[p] - c)) & 1) << p;
+
+            if (w != 0)
+                _gf2_row_add(A->rows[i] + l0, T + w * len, 0, len);
+        }
+
+        for (p = 0; p < kk; p++)
+            pivots[r + p] = pivcol[p];
+
+        r += kk;
+    }
+
+    flint_free(T);
+
+    return r;
+}
+
+slong
+gf2_mat_rref(gf2_mat_t A)
+{
+    slong rank, * pivots;
+
+    pivots = flint_malloc(sizeof(slong) * FLINT_MAX(1, FLINT_MIN(A->r, A->c)));
+    rank = _gf2_mat_rref(A, pivots);
+    flint_free(pivots);
+
+    return rank;
+}
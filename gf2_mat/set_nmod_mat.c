@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_set_nmod_mat(gf2_mat_t A, const nmod_mat_t B)
+{
+    slong i, j;
+    mp_limb_t w;
+
+    for (i = 0; i < B->r; i++)
+    {
+        for (j = 0; j < A->stride; j++)
+            A->rows[i][j] = 0;
+
+        for (j = 0; j < B->c; j++)
+        {
+            w = nmod_mat_entry(B, i, j) & 1;
+            A->rows[i][j / FLINT_BITS] |= w << (j % FLINT_BITS);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+int
+gf2_mat_solve(gf2_mat_t X, const gf2_mat_t A, const gf2_mat_t B)
+{
+    gf2_mat_t M;
+    slong i, j, n, k, rank, * pivots;
+    int result;
+
+    n = A->r;
+    k = B->c;
+
+    if (n == 0)
+        return 1;
+
+    /* row reduce [A | B]; A is invertible iff the pivots are all in A */
+    gf2_mat_init(M, n, n + k);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < A->stride; j++)
+            M->rows[i][j] = A->rows[i][j];
+
+        for (j = 0; j < k; j++)
+            if (gf2_mat_get_entry(B, i, j))
+                gf2_mat_set_entry(M, i, n + j, 1);
+    }
+
+    pivots = flint_malloc(sizeof(slong) * n);
+    rank = _gf2_mat_rref(M, pivots);
+
+    result = (rank == n && pivots[n - 1] == n - 1);
+
+    if (result)
+        for (i = 0; i < n; i++)
+            for (j = 0; j < k; j++)
+                gf2_mat_set_entry(X, i, j, gf2_mat_get_entry(M, i, n + j));
+
+    flint_free(pivots);
+    gf2_mat_clear(M);
+
+    return result;
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B, C, D;
+        nmod_mat_t M, N, P;
+        slong m, k, n;
+        int which;
+
+        if (n_randint(state, 4) == 0)
+        {
+            m = n_randint(state, 300);
+            k = n_randint(state, 300);
+            n = n_randint(state, 5000);
+        }
+        else
+        {
+            m = n_randint(state, 100);
+            k = n_randint(state, 100);
+            n = n_randint(state, 100);
+        }
+
+        gf2_mat_init(A, m, k);
+        gf2_mat_init(B, k, n);
+        gf2_mat_init(C, m, n);
+        gf2_mat_init(D, m, n);
+        nmod_mat_init(M, m, k, 2);
+        nmod_mat_init(N, k, n, 2);
+        nmod_mat_init(P, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+        gf2_mat_randtest(C, state);
+
+        which = n_randint(state, 3);
+
+        if (which == 0)
+            gf2_mat_mul_classical(C, A, B);
+        else if (which == 1)
+            gf2_mat_mul_m4rm(C, A, B);
+        else
+            gf2_mat_mul(C, A, B);
+
+        gf2_mat_get_nmod_mat(M, A);
+        gf2_mat_get_nmod_mat(N, B);
+        nmod_mat_mul(P, M, N);
+        gf2_mat_set_nmod_mat(D, P);
+
+        if (!gf2_mat_equal(C, D))
+        {
+            flint_printf("FAIL: m = %wd, k = %wd, n = %wd, which = %d\n",
+                m, k, n, which);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        gf2_mat_clear(D);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_mat_clear(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
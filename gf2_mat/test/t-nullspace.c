@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B, ker;
+        nmod_mat_t M;
+        slong m, n, r, nullity;
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 200);
+            n = n_randint(state, 200);
+        }
+        else
+        {
+            m = n_randint(state, 30);
+            n = n_randint(state, 30);
+        }
+
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(ker, n, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        if (n_randint(state, 2))
+            nmod_mat_randops(M, n_randint(state, 2 * m * n + 1), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        nullity = gf2_mat_nullspace(ker, A);
+
+        if (nullity + r != n || gf2_mat_rank(A) != r)
+        {
+            flint_printf("FAIL: nullity + rank != n\n");
+            abort();
+        }
+
+        if (gf2_mat_rank(ker) != nullity)
+        {
+            flint_printf("FAIL: rank(ker) != nullity\n");
+            abort();
+        }
+
+        gf2_mat_mul(B, A, ker);
+
+        if (!gf2_mat_is_zero(B))
+        {
+            flint_printf("FAIL: A * ker != 0\n");
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(ker);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+#include "perm.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rref....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M;
+        slong m, n, r, rank1, rank2, * pivots, * P;
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 300);
+            n = n_randint(state, 300);
+        }
+        else
+        {
+            m = n_randint(state, 40);
+            n = n_randint(state, 40);
+        }
+
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(M, m, n, 2);
+
+        if (n_randint(state, 2))
+        {
+            nmod_mat_randrank(M, state, r);
+            if (n_randint(state, 2))
+                nmod_mat_randops(M, n_randint(state, 2 * m * n + 1), state);
+            gf2_mat_set_nmod_mat(A, M);
+        }
+        else
+        {
+            gf2_mat_randtest(A, state);
+            gf2_mat_get_nmod_mat(M, A);
+        }
+
+        rank1 = gf2_mat_rref(A);
+
+        /* compare with the generic LU based rref */
+        pivots = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+        P = _perm_init(m);
+        rank2 = _nmod_mat_rref(M, pivots, P);
+        gf2_mat_set_nmod_mat(B, M);
+
+        if (rank1 != rank2 || !gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL: m = %wd, n = %wd, rank %wd, %wd\n",
+                m, n, rank1, rank2);
+            abort();
+        }
+
+        flint_free(pivots);
+        _perm_clear(P);
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t M, N;
+        slong i, j, m, n;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(M, m, n, 2);
+        nmod_mat_init(N, m, n, 2);
+
+        nmod_mat_randtest(M, state);
+
+        gf2_mat_set_nmod_mat(A, M);
+
+        for (i = 0; i < m; i++)
+        {
+            for (j = 0; j < n; j++)
+            {
+                if (gf2_mat_get_entry(A, i, j) != nmod_mat_entry(M, i, j))
+                {
+                    flint_printf("FAIL: entry (%wd, %wd)\n", i, j);
+                    abort();
+                }
+            }
+        }
+
+        gf2_mat_get_nmod_mat(N, A);
+
+        if (!nmod_mat_equal(M, N))
+        {
+            flint_printf("FAIL: get_nmod_mat\n");
+            abort();
+        }
+
+        gf2_mat_randtest(B, state);
+        gf2_mat_get_nmod_mat(N, B);
+        gf2_mat_set_nmod_mat(A, N);
+
+        if (!gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL: round trip\n");
+            gf2_mat_print_pretty(A);
+            gf2_mat_print_pretty(B);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
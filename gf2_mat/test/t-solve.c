@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, X, Y, B;
+        nmod_mat_t M;
+        slong n, k, r;
+        int result;
+
+        if (n_randint(state, 10) == 0)
+            n = n_randint(state, 200);
+        else
+            n = n_randint(state, 30);
+
+        k = n_randint(state, 20);
+        r = (n_randint(state, 4) == 0) ? n_randint(state, n + 1) : n;
+
+        gf2_mat_init(A, n, n);
+        gf2_mat_init(X, n, k);
+        gf2_mat_init(Y, n, k);
+        gf2_mat_init(B, n, k);
+        nmod_mat_init(M, n, n, 2);
+
+        nmod_mat_randrank(M, state, r);
+        if (n_randint(state, 2))
+            nmod_mat_randops(M, n_randint(state, 2 * n * n + 1), state);
+        gf2_mat_set_nmod_mat(A, M);
+
+        gf2_mat_randtest(X, state);
+        gf2_mat_mul(B, A, X);
+
+        result = gf2_mat_solve(Y, A, B);
+
+        if (result != (r == n) || (result && !gf2_mat_equal(X, Y)))
+        {
+            flint_printf("FAIL: n = %wd, k = %wd, r = %wd, result = %d\n",
+                n, k, r, result);
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(X);
+        gf2_mat_clear(Y);
+        gf2_mat_clear(B);
+        nmod_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t M, N, P;
+        slong m, n;
+
+        m = n_randint(state, 200);
+        n = n_randint(state, 200);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, n, m);
+        gf2_mat_init(C, n, m);
+        nmod_mat_init(M, m, n, 2);
+        nmod_mat_init(N, n, m, 2);
+        nmod_mat_init(P, n, m, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+
+        gf2_mat_transpose(B, A);
+
+        gf2_mat_get_nmod_mat(M, A);
+        nmod_mat_transpose(N, M);
+        gf2_mat_get_nmod_mat(P, B);
+
+        gf2_mat_set_nmod_mat(C, N);
+
+        if (!nmod_mat_equal(N, P) || !gf2_mat_equal(B, C))
+        {
+            flint_printf("FAIL: m = %wd, n = %wd\n", m, n);
+            abort();
+        }
+
+        /* in place for square matrices */
+        if (m == n)
+        {
+            gf2_mat_set(C, A);
+            gf2_mat_transpose(C, C);
+
+            if (!gf2_mat_equal(B, C))
+            {
+                flint_printf("FAIL: aliasing\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(M);
+        nmod_mat_clear(N);
+        nmod_mat_clear(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+#if FLINT_BITS == 64
+#define TRANSPOSE_MASK UWORD(0x00000000ffffffff)
+#else
+#define TRANSPOSE_MASK UWORD(0x0000ffff)
+#endif
+
+/*
+    Transposes the FLINT_BITS x FLINT_BITS bit matrix x in place by
+    swapping the off-diagonal blocks of halving size.
+*/
+static void
+_gf2_mat_transpose_block(mp_limb_t * x)
+{
+    mp_limb_t m, t;
+    slong j, k;
+
+    m = TRANSPOSE_MASK;
+
+    for (j = FLINT_BITS / 2; j != 0; j >>= 1, m ^= (m << j))
+    {
+        for (k = 0; k < FLINT_BITS; k = ((k | j) + 1) & ~j)
+        {
+            t = ((x[k] >> j) ^ x[k | j]) & m;
+            x[k] ^= t << j;
+            x[k | j] ^= t;
+        }
+    }
+}
+
+void
+gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A)
+{
+    mp_limb_t x[FLINT_BITS];
+    slong bi, bj, i, rows, cols;
+
+    if (A->r == 0 || A->c == 0)
+        return;
+
+    if (A == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->c, A->r);
+        gf2_mat_transpose(T, A);
+        gf2_mat_swap(B, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    for (bi = 0; bi < B->stride; bi++)
+    {
+        rows = FLINT_MIN(FLINT_BITS, A->r - bi * FLINT_BITS);
+
+        for (bj = 0; bj < A->stride; bj++)
+        {
+            cols = FLINT_MIN(FLINT_BITS, A->c - bj * FLINT_BITS);
+
+            for (i = 0; i < rows; i++)
+                x[i] = A->rows[bi * FLINT_BITS + i][bj];
+            for ( ; i < FLINT_BITS; i++)
+                x[i] = 0;
+
+            _gf2_mat_transpose_block(x);
+
+            for (i = 0; i < cols; i++)
+                B->rows[bj * FLINT_BITS + i][bi] = x[i];
+        }
+    }
+}
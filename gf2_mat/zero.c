@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_zero(gf2_mat_t A)
+{
+    slong i;
+
+    for (i = 0; i < A->r && A->stride != 0; i++)
+        flint_mpn_zero(A->rows[i], A->stride);
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2010,2011 Fredrik Johansson
     Copyright (C) 2014 Ashish Kedia
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -163,6 +164,12 @@ FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmo
 FLINT_DLL void _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
+FLINT_DLL int nmod_mat_mul_double_fits(nmod_t mod);
+FLINT_DLL void nmod_mat_mul_double(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+
+FLINT_DLL void _nmod_mat_mul_double(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op);
+
 FLINT_DLL void nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B);
 
@@ -232,6 +239,9 @@ FLINT_DLL slong nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_recursive(slong * P, nmod_mat_t A, int rank_check);
 
+FLINT_DLL slong nmod_mat_pluq(slong * P, slong * Q, nmod_mat_t A);
+FLINT_DLL slong nmod_mat_pluq_classical(slong * P, slong * Q, nmod_mat_t A);
+
 /* Nonsingular solving */
 
 FLINT_DLL int nmod_mat_solve(nmod_mat_t X, const nmod_mat_t A, const nmod_mat_t B);
@@ -268,6 +278,8 @@ void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
  * 
  * FLINT_DLL void nmod_mat_charpoly_danilevsky(nmod_poly_t p, const nmod_mat_t M);
  *
+ * FLINT_DLL void nmod_mat_charpoly_krylov(nmod_poly_t p, const nmod_mat_t M);
+ *
  * FLINT_DLL void nmod_mat_minpoly(nmod_poly_t p, const nmod_mat_t M);
 */
 
@@ -279,6 +291,16 @@ void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 /* Strassen multiplication */
 #define NMOD_MAT_MUL_STRASSEN_CUTOFF 256
 
+/*
+    Moduli of at most this many bits are multiplied with the floating-point
+    kernel once all dimensions are at least NMOD_MAT_MUL_DOUBLE_CUTOFF
+*/
+#define NMOD_MAT_MUL_DOUBLE_MAX_BITS 26
+#define NMOD_MAT_MUL_DOUBLE_CUTOFF 16
+
+/* Strassen multiplication for moduli using the floating-point kernel */
+#define NMOD_MAT_MUL_DOUBLE_STRASSEN_CUTOFF 2048
+
 /* Cutoff between classical and recursive triangular solving */
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define NMOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
@@ -286,6 +308,16 @@ void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 /* Cutoff between classical and recursive LU decomposition */
 #define NMOD_MAT_LU_RECURSIVE_CUTOFF 4
 
+/*
+    Cutoff between classical and recursive PLUQ decomposition, and the
+    smallest number of rows or columns per thread in its block updates
+*/
+#define NMOD_MAT_PLUQ_CUTOFF 32
+#define NMOD_MAT_PLUQ_THREAD_CUTOFF 64
+
+/* Cutoff between Danilevsky and Krylov characteristic polynomial */
+#define NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF 24
+
 /*
    Suggested initial modulus size for multimodular algorithms. This should
    be chosen so that we get the most number of bits per cycle
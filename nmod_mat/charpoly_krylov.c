@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+void nmod_mat_charpoly_krylov(nmod_poly_t p, const nmod_mat_t M)
+{
+    slong n = M->r, i, k;
+    int nlimbs, nonsingular;
+    nmod_mat_t AT, K, KT;
+    mp_ptr u, c;
+    flint_rand_t state;
+
+    if (n < 2)
+    {
+        nmod_mat_t A;
+        nmod_mat_init_set(A, M);
+        nmod_mat_charpoly_danilevsky(p, A);
+        nmod_mat_clear(A);
+        return;
+    }
+
+    nmod_mat_init(AT, n, n, M->mod.n);
+    nmod_mat_init(K, n, n, M->mod.n);
+    nmod_mat_init(KT, n, n, M->mod.n);
+    u = _nmod_vec_init(n);
+    c = _nmod_vec_init(n);
+
+    nmod_mat_transpose(AT, M);
+    nlimbs = _nmod_vec_dot_bound_limbs(n, M->mod);
+
+    /*
+        The rows of K are w, wA, ..., wA^(n-1) for a random row vector w.
+        If they are linearly independent, writing wA^n = sum c_i wA^i gives
+        the characteristic polynomial x^n - sum c_i x^i. The products with
+        A are dot products with the rows of A^T, using delayed reduction.
+    */
+    flint_randinit(state);
+    for (k = 0; k < n; k++)
+        nmod_mat_entry(K, 0, k) = n_randint(state, M->mod.n);
+    flint_randclear(state);
+
+    for (i = 1; i < n; i++)
+        for (k = 0; k < n; k++)
+            nmod_mat_entry(K, i, k) = _nmod_vec_dot(K->rows[i - 1],
+                                            AT->rows[k], n, M->mod, nlimbs);
+
+    for (k = 0; k < n; k++)
+        u[k] = _nmod_vec_dot(K->rows[n - 1], AT->rows[k], n, M->mod, nlimbs);
+
+    nmod_mat_transpose(KT, K);
+    nonsingular = nmod_mat_solve_vec(c, KT, u);
+
+    if (nonsingular)
+    {
+        nmod_poly_fit_length(p, n + 1);
+        _nmod_vec_neg(p->coeffs, c, n, M->mod);
+        p->coeffs[n] = UWORD(1);
+        _nmod_poly_set_length(p, n + 1);
+    }
+
+    nmod_mat_clear(AT);
+    nmod_mat_clear(K);
+    nmod_mat_clear(KT);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(c);
+
+    /* not cyclic, or an unlucky choice of w */
+    if (!nonsingular)
+    {
+        nmod_mat_t A;
+        nmod_mat_init_set(A, M);
+        nmod_mat_charpoly_danilevsky(p, A);
+        nmod_mat_clear(A);
+    }
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -18,15 +19,19 @@
 void
 nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
 {
-    slong m, k, n;
+    slong m, k, n, cutoff;
 
     m = A->r;
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    /* the floating-point kernel pushes the Strassen crossover up */
+    if (nmod_mat_mul_double_fits(A->mod))
+        cutoff = NMOD_MAT_MUL_DOUBLE_STRASSEN_CUTOFF;
+    else
+        cutoff = NMOD_MAT_MUL_STRASSEN_CUTOFF;
+
+    if (m < cutoff || n < cutoff || k < cutoff)
     {
         nmod_mat_mul_classical(C, A, B);
     }
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010,2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -180,6 +181,13 @@ _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
         return;
     }
 
+    if (m >= NMOD_MAT_MUL_DOUBLE_CUTOFF && k >= NMOD_MAT_MUL_DOUBLE_CUTOFF
+        && n >= NMOD_MAT_MUL_DOUBLE_CUTOFF && nmod_mat_mul_double_fits(mod))
+    {
+        _nmod_mat_mul_double(D, C, A, B, op);
+        return;
+    }
+
     nlimbs = _nmod_vec_dot_bound_limbs(k, mod);
 
     if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
@@ -0,0 +1,371 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+#include <immintrin.h>
+#endif
+
+/*
+    Blocking parameters: the micro-kernel updates an MR x NR block of the
+    product, the packed KC x NR panel of B stays in L1, the packed MC x KC
+    block of A in L2 and the KC x NC panel of B in L3.
+*/
+#define DMUL_MR 6
+#define DMUL_NR 8
+#define DMUL_KC 256
+#define DMUL_MC 96
+#define DMUL_NC 2048
+
+/*
+    Entries are stored as doubles in the symmetric range [-n/2, n/2], so
+    that every product is at most h^2 with h = floor(n/2) in absolute value.
+    Partial sums are reduced to the range (-2n, 2n) after every kb terms,
+    where kb is chosen such that 2n + kb h^2 <= 2^53 - 2n; all arithmetic
+    is then exact.
+*/
+typedef void (*_nmod_mat_mul_double_kernel_t)(double * c, slong ldc,
+        const double * a, const double * b, slong kc, slong kb,
+        double n, double ninv);
+
+static void
+_nmod_mat_mul_double_kernel(double * c, slong ldc, const double * a,
+        const double * b, slong kc, slong kb, double n, double ninv)
+{
+    double t[DMUL_MR * DMUL_NR], q;
+    slong i, j, l, stop;
+
+    for (i = 0; i < DMUL_MR; i++)
+        for (j = 0; j < DMUL_NR; j++)
+            t[i * DMUL_NR + j] = c[i * ldc + j];
+
+    for (l = 0; l < kc; )
+    {
+        stop = FLINT_MIN(kc, l + kb);
+
+        for ( ; l < stop; l++)
+            for (i = 0; i < DMUL_MR; i++)
+                for (j = 0; j < DMUL_NR; j++)
+                    t[i * DMUL_NR + j] += a[l * DMUL_MR + i] * b[l * DMUL_NR + j];
+
+        /* truncating the quotient leaves a remainder of less than 2n */
+        for (i = 0; i < DMUL_MR * DMUL_NR; i++)
+        {
+            q = (double) (slong) (t[i] * ninv);
+            t[i] -= q * n;
+        }
+    }
+
+    for (i = 0; i < DMUL_MR; i++)
+        for (j = 0; j < DMUL_NR; j++)
+            c[i * ldc + j] = t[i * DMUL_NR + j];
+}
+
+#if NMOD_VEC_HAVE_SIMD
+
+#define DMUL_FMA_ROW(i)                                                     \
+    do {                                                                    \
+        av = _mm256_broadcast_sd(a + (i));                                  \
+        c ## i ## 0 = _mm256_fmadd_pd(av, b0, c ## i ## 0);                 \
+        c ## i ## 1 = _mm256_fmadd_pd(av, b1, c ## i ## 1);                 \
+    } while (0)
+
+#define DMUL_FMA_RED(x)                                                     \
+    do {                                                                    \
+        q = _mm256_round_pd(_mm256_mul_pd(x, vninv),                        \
+                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); \
+        x = _mm256_fnmadd_pd(q, vn, x);                                     \
+    } while (0)
+
+#define DMUL_FMA_ROW_RED(i)                                                 \
+    do {                                                                    \
+        DMUL_FMA_RED(c ## i ## 0);                                          \
+        DMUL_FMA_RED(c ## i ## 1);                                          \
+    } while (0)
+
+#define DMUL_FMA_LOAD(i)                                                    \
+    do {                                                                    \
+        c ## i ## 0 = _mm256_loadu_pd(c + (i) * ldc);                       \
+        c ## i ## 1 = _mm256_loadu_pd(c + (i) * ldc + 4);                   \
+    } while (0)
+
+#define DMUL_FMA_STORE(i)                                                   \
+    do {                                                                    \
+        _mm256_storeu_pd(c + (i) * ldc, c ## i ## 0);                       \
+        _mm256_storeu_pd(c + (i) * ldc + 4, c ## i ## 1);                   \
+    } while (0)
+
+/* AVX2 does not imply FMA, which only this kernel needs */
+static int _nmod_mat_mul_double_fma = -1;
+
+static int
+_nmod_mat_mul_double_have_fma(void)
+{
+    if (_nmod_mat_mul_double_fma < 0)
+    {
+        __builtin_cpu_init();
+        _nmod_mat_mul_double_fma = (__builtin_cpu_supports("fma") != 0);
+    }
+
+    return _nmod_mat_mul_double_fma;
+}
+
+/* the same kernel with the 6 x 8 block held in twelve AVX registers */
+__attribute__((target("avx2,fma")))
+static void
+_nmod_mat_mul_double_kernel_fma(double * c, slong ldc, const double * a,
+        const double * b, slong kc, slong kb, double n, double ninv)
+{
+    __m256d c00, c01, c10, c11, c20, c21, c30, c31, c40, c41, c50, c51;
+    __m256d av, b0, b1, q, vn, vninv;
+    slong l, stop;
+
+    vn = _mm256_set1_pd(n);
+    vninv = _mm256_set1_pd(ninv);
+
+    DMUL_FMA_LOAD(0); DMUL_FMA_LOAD(1); DMUL_FMA_LOAD(2);
+    DMUL_FMA_LOAD(3); DMUL_FMA_LOAD(4); DMUL_FMA_LOAD(5);
+
+    for (l = 0; l < kc; )
+    {
+        stop = FLINT_MIN(kc, l + kb);
+
+        for ( ; l < stop; l++)
+        {
+            b0 = _mm256_loadu_pd(b);
+            b1 = _mm256_loadu_pd(b + 4);
+
+            DMUL_FMA_ROW(0); DMUL_FMA_ROW(1); DMUL_FMA_ROW(2);
+            DMUL_FMA_ROW(3); DMUL_FMA_ROW(4); DMUL_FMA_ROW(5);
+
+            a += DMUL_MR;
+            b += DMUL_NR;
+        }
+
+        DMUL_FMA_ROW_RED(0); DMUL_FMA_ROW_RED(1); DMUL_FMA_ROW_RED(2);
+        DMUL_FMA_ROW_RED(3); DMUL_FMA_ROW_RED(4); DMUL_FMA_ROW_RED(5);
+    }
+
+    DMUL_FMA_STORE(0); DMUL_FMA_STORE(1); DMUL_FMA_STORE(2);
+    DMUL_FMA_STORE(3); DMUL_FMA_STORE(4); DMUL_FMA_STORE(5);
+}
+
+#endif
+
+static __inline__ double
+_nmod_to_double(mp_limb_t x, mp_limb_t h, mp_limb_t n)
+{
+    return (x > h) ? -(double) (n - x) : (double) x;
+}
+
+/*
+    Packs rows r0, ..., r0 + mc - 1 and columns k0, ..., k0 + kc - 1 of A
+    into panels of MR rows, each stored column by column, padding the last
+    panel with zeros.
+*/
+static void
+_nmod_mat_mul_double_pack_A(double * Ap, mp_ptr * const A, slong r0,
+        slong mc, slong k0, slong kc, mp_limb_t h, mp_limb_t n)
+{
+    slong i, ir, l, rows;
+
+    for (ir = 0; ir < mc; ir += DMUL_MR)
+    {
+        rows = FLINT_MIN(DMUL_MR, mc - ir);
+
+        for (l = 0; l < kc; l++)
+        {
+            for (i = 0; i < rows; i++)
+                Ap[l * DMUL_MR + i] =
+                    _nmod_to_double(A[r0 + ir + i][k0 + l], h, n);
+            for ( ; i < DMUL_MR; i++)
+                Ap[l * DMUL_MR + i] = 0.0;
+        }
+
+        Ap += DMUL_MR * kc;
+    }
+}
+
+/* the same for panels of NR columns of B, each stored row by row */
+static void
+_nmod_mat_mul_double_pack_B(double * Bp, mp_ptr * const B, slong k0,
+        slong kc, slong c0, slong nc, mp_limb_t h, mp_limb_t n)
+{
+    slong j, jr, l, cols;
+
+    for (jr = 0; jr < nc; jr += DMUL_NR)
+    {
+        cols = FLINT_MIN(DMUL_NR, nc - jr);
+
+        for (l = 0; l < kc; l++)
+        {
+            for (j = 0; j < cols; j++)
+                Bp[l * DMUL_NR + j] =
+                    _nmod_to_double(B[k0 + l][c0 + jr + j], h, n);
+            for ( ; j < DMUL_NR; j++)
+                Bp[l * DMUL_NR + j] = 0.0;
+        }
+
+        Bp += DMUL_NR * kc;
+    }
+}
+
+int
+nmod_mat_mul_double_fits(nmod_t mod)
+{
+#if FLINT64
+    return FLINT_BITS - mod.norm <= NMOD_MAT_MUL_DOUBLE_MAX_BITS;
+#else
+    /* the kernels convert the partial sums through a 64-bit slong */
+    return 0;
+#endif
+}
+
+void
+_nmod_mat_mul_double(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op)
+{
+    _nmod_mat_mul_double_kernel_t kernel;
+    double * T, * Ap, * Bp, * tile, buf[DMUL_MR * DMUL_NR];
+    double dn, ninv, hh;
+    mp_limb_t n, h, c;
+    slong m, k, p, i, j, ic, jc, pc, ir, jr, mc, nc, kc, kb, rows, cols;
+    nmod_t mod;
+
+    mod = A->mod;
+    n = mod.n;
+    m = A->r;
+    k = A->c;
+    p = B->c;
+
+    if (!nmod_mat_mul_double_fits(mod))
+    {
+        flint_printf("Exception (nmod_mat_mul_double). Modulus too large.\n");
+        flint_abort();
+    }
+
+    if (m == 0 || p == 0)
+        return;
+
+    if (k == 0)
+    {
+        if (op == 0)
+            nmod_mat_zero(D);
+        else
+            nmod_mat_set(D, C);
+        return;
+    }
+
+    h = n / 2;
+    dn = (double) n;
+    ninv = 1.0 / dn;
+    /* kb = floor((2^53 - 4n) / h^2), in double so that it is well defined
+       on every word size; the quotient may be rounded up by one */
+    hh = FLINT_MAX((double) h * (double) h, 1.0);
+    kb = (slong) FLINT_MIN((9007199254740992.0 - 4.0 * dn) / hh,
+                                                        (double) DMUL_KC);
+    if ((double) kb * hh > 9007199254740992.0 - 4.0 * dn)
+        kb--;
+
+    kernel = _nmod_mat_mul_double_kernel;
+#if NMOD_VEC_HAVE_SIMD
+    if (nmod_vec_simd_level() >= NMOD_VEC_SIMD_AVX2
+                                    && _nmod_mat_mul_double_have_fma())
+        kernel = _nmod_mat_mul_double_kernel_fma;
+#endif
+
+    T = flint_calloc(m * p, sizeof(double));
+    Ap = flint_malloc(sizeof(double) * DMUL_MC * DMUL_KC);
+    Bp = flint_malloc(sizeof(double) * DMUL_KC *
+                ((FLINT_MIN(p, DMUL_NC) + DMUL_NR - 1) / DMUL_NR) * DMUL_NR);
+
+    for (jc = 0; jc < p; jc += DMUL_NC)
+    {
+        nc = FLINT_MIN(DMUL_NC, p - jc);
+
+        for (pc = 0; pc < k; pc += DMUL_KC)
+        {
+            kc = FLINT_MIN(DMUL_KC, k - pc);
+
+            _nmod_mat_mul_double_pack_B(Bp, B->rows, pc, kc, jc, nc, h, n);
+
+            for (ic = 0; ic < m; ic += DMUL_MC)
+            {
+                mc = FLINT_MIN(DMUL_MC, m - ic);
+
+                _nmod_mat_mul_double_pack_A(Ap, A->rows, ic, mc, pc, kc, h, n);
+
+                for (jr = 0; jr < nc; jr += DMUL_NR)
+                {
+                    cols = FLINT_MIN(DMUL_NR, nc - jr);
+
+                    for (ir = 0; ir < mc; ir += DMUL_MR)
+                    {
+                        rows = FLINT_MIN(DMUL_MR, mc - ir);
+                        tile = T + (ic + ir) * p + jc + jr;
+
+                        if (rows == DMUL_MR && cols == DMUL_NR)
+                        {
+                            kernel(tile, p, Ap + ir * kc, Bp + jr * kc,
+                                                        kc, kb, dn, ninv);
+                            continue;
+                        }
+
+                        /* partial block at the edge of the product */
+                        for (i = 0; i < DMUL_MR; i++)
+                            for (j = 0; j < DMUL_NR; j++)
+                                buf[i * DMUL_NR + j] = (i < rows && j < cols) ?
+                                    tile[i * p + j] : 0.0;
+
+                        kernel(buf, DMUL_NR, Ap + ir * kc, Bp + jr * kc,
+                                                        kc, kb, dn, ninv);
+
+                        for (i = 0; i < rows; i++)
+                            for (j = 0; j < cols; j++)
+                                tile[i * p + j] = buf[i * DMUL_NR + j];
+                    }
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < p; j++)
+        {
+            slong t = ((slong) T[i * p + j]) % (slong) n;
+
+            c = (t < 0) ? (mp_limb_t) (t + n) : (mp_limb_t) t;
+
+            if (op == 1)
+                c = nmod_add(C->rows[i][j], c, mod);
+            else if (op == -1)
+                c = nmod_sub(C->rows[i][j], c, mod);
+
+            D->rows[i][j] = c;
+        }
+    }
+
+    flint_free(T);
+    flint_free(Ap);
+    flint_free(Bp);
+}
+
+void
+nmod_mat_mul_double(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    _nmod_mat_mul_double(C, NULL, A, B, 0);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,12 +14,13 @@
 #include <gmp.h>
 #include "flint.h"
 #include "nmod_mat.h"
+#include "gf2_mat.h"
 
 slong
 nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A)
 {
-    slong i, j, k, m, n, rank, nullity;
-    slong * p;
+    slong i, j, m, n, rank, nullity;
+    slong * p, * P;
     slong * pivots;
     slong * nonpivots;
     nmod_mat_t tmp;
@@ -26,55 +28,48 @@ nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A)
     m = A->r;
     n = A->c;
 
+    /* the packed GF(2) code gives the same basis */
+    if (A->mod.n == 2)
+    {
+        gf2_mat_t B, Y;
+
+        gf2_mat_init(B, m, n);
+        gf2_mat_init(Y, X->r, X->c);
+        gf2_mat_set_nmod_mat(B, A);
+        nullity = gf2_mat_nullspace(Y, B);
+        gf2_mat_get_nmod_mat(X, Y);
+        gf2_mat_clear(B);
+        gf2_mat_clear(Y);
+
+        return nullity;
+    }
+
     p = flint_malloc(sizeof(slong) * FLINT_MAX(m, n));
+    P = flint_malloc(sizeof(slong) * m);
 
     nmod_mat_init_set(tmp, A);
-    rank = nmod_mat_rref(tmp);
+    rank = _nmod_mat_rref(tmp, p, P);
     nullity = n - rank;
 
     nmod_mat_zero(X);
 
-    if (rank == 0)
-    {
-        for (i = 0; i < nullity; i++)
-            nmod_mat_entry(X, i, i) = UWORD(1);
-    }
-    else if (nullity)
-    {
-        pivots = p;            /* length = rank */
-        nonpivots = p + rank;  /* length = nullity */
+    /* the rref returns the pivot columns followed by the others */
+    pivots = p;            /* length = rank */
+    nonpivots = p + rank;  /* length = nullity */
 
-        for (i = j = k = 0; i < rank; i++)
-        {
-            while (nmod_mat_entry(tmp, i, j) == UWORD(0))
-            {
-                nonpivots[k] = j;
-                k++;
-                j++;
-            }
-            pivots[i] = j;
-            j++;
-        }
-        while (k < nullity)
+    for (i = 0; i < nullity; i++)
+    {
+        for (j = 0; j < rank; j++)
         {
-            nonpivots[k] = j;
-            k++;
-            j++;
+            mp_limb_t c = nmod_mat_entry(tmp, j, nonpivots[i]);
+            nmod_mat_entry(X, pivots[j], i) = nmod_neg(c, A->mod);
         }
 
-        for (i = 0; i < nullity; i++)
-        {
-            for (j = 0; j < rank; j++)
-            {
-                mp_limb_t c = nmod_mat_entry(tmp, j, nonpivots[i]);
-                nmod_mat_entry(X, pivots[j], i) = nmod_neg(c, A->mod);
-            }
-
-            nmod_mat_entry(X, nonpivots[i], i) = UWORD(1);
-        }
+        nmod_mat_entry(X, nonpivots[i], i) = UWORD(1);
     }
 
     flint_free(p);
+    flint_free(P);
     nmod_mat_clear(tmp);
 
     return nullity;
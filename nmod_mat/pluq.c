@@ -0,0 +1,285 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+typedef struct
+{
+    nmod_mat_struct * X;
+    const nmod_mat_struct * L;
+    const nmod_mat_struct * Y;
+    int op;
+}
+pluq_update_arg_t;
+
+/* op = 0: X = L^(-1) X with L unit lower triangular; op = 1: X -= L Y */
+static void
+_nmod_mat_pluq_update(pluq_update_arg_t * arg)
+{
+    if (arg->op == 0)
+        nmod_mat_solve_tril(arg->X, arg->L, arg->X, 1);
+    else
+        nmod_mat_submul(arg->X, arg->X, arg->L, arg->Y);
+}
+
+static void *
+_nmod_mat_pluq_update_worker(void * arg_ptr)
+{
+    _nmod_mat_pluq_update((pluq_update_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Performs the update on X, split into column blocks (op = 0) or row
+    blocks (op = 1) which are handled by separate threads.
+*/
+static void
+_nmod_mat_pluq_update_threaded(nmod_mat_t X, const nmod_mat_t L,
+                                            const nmod_mat_t Y, int op)
+{
+    pthread_t * threads;
+    pluq_update_arg_t * args;
+    nmod_mat_struct * Xw, * Lw;
+    slong k, len, num_threads, start, stop;
+
+    len = (op == 0) ? X->c : X->r;
+    num_threads = FLINT_MIN(flint_get_num_threads(),
+                                    len / NMOD_MAT_PLUQ_THREAD_CUTOFF);
+
+    if (num_threads <= 1)
+    {
+        pluq_update_arg_t arg;
+
+        arg.X = X;
+        arg.L = L;
+        arg.Y = Y;
+        arg.op = op;
+        _nmod_mat_pluq_update(&arg);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(pluq_update_arg_t) * num_threads);
+    Xw = flint_malloc(sizeof(nmod_mat_struct) * num_threads);
+    Lw = flint_malloc(sizeof(nmod_mat_struct) * num_threads);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        start = (k * len) / num_threads;
+        stop = ((k + 1) * len) / num_threads;
+
+        if (op == 0)
+        {
+            nmod_mat_window_init(Xw + k, X, 0, start, X->r, stop);
+            args[k].L = L;
+        }
+        else
+        {
+            nmod_mat_window_init(Xw + k, X, start, 0, stop, X->c);
+            nmod_mat_window_init(Lw + k, L, start, 0, stop, L->c);
+            args[k].L = Lw + k;
+        }
+
+        args[k].X = Xw + k;
+        args[k].Y = Y;
+        args[k].op = op;
+    }
+
+    for (k = 0; k < num_threads - 1; k++)
+        pthread_create(&threads[k], NULL,
+            _nmod_mat_pluq_update_worker, &args[k]);
+
+    _nmod_mat_pluq_update(&args[num_threads - 1]);
+
+    for (k = 0; k < num_threads - 1; k++)
+        pthread_join(threads[k], NULL);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        nmod_mat_window_clear(Xw + k);
+        if (op == 1)
+            nmod_mat_window_clear(Lw + k);
+    }
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(Xw);
+    flint_free(Lw);
+}
+
+/* applies the row permutation P1 to rows offset, ..., offset + n - 1 */
+static void
+_nmod_mat_pluq_permute_rows(slong * P, nmod_mat_t A, const slong * P1,
+                                                    slong n, slong offset)
+{
+    mp_ptr * Atmp;
+    slong * Ptmp;
+    slong i;
+
+    if (n == 0)
+        return;
+
+    Atmp = flint_malloc(sizeof(mp_ptr) * n);
+    Ptmp = flint_malloc(sizeof(slong) * n);
+
+    for (i = 0; i < n; i++)
+    {
+        Atmp[i] = A->rows[P1[i] + offset];
+        Ptmp[i] = P[P1[i] + offset];
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        A->rows[i + offset] = Atmp[i];
+        P[i + offset] = Ptmp[i];
+    }
+
+    flint_free(Atmp);
+    flint_free(Ptmp);
+}
+
+/*
+    Applies the column permutation Q1 to columns c0, ..., c0 + n - 1 of
+    rows r0, ..., r1 - 1, recording it in Q when Q is not NULL.
+*/
+static void
+_nmod_mat_pluq_permute_cols(slong * Q, nmod_mat_t A, const slong * Q1,
+                                        slong n, slong c0, slong r0, slong r1)
+{
+    mp_ptr tmp;
+    slong i, j;
+
+    if (n == 0)
+        return;
+
+    tmp = _nmod_vec_init(FLINT_MAX(n, r1 - r0));
+
+    for (i = r0; i < r1; i++)
+    {
+        for (j = 0; j < n; j++)
+            tmp[j] = A->rows[i][c0 + Q1[j]];
+        for (j = 0; j < n; j++)
+            A->rows[i][c0 + j] = tmp[j];
+    }
+
+    if (Q != NULL)
+    {
+        slong * Qtmp = flint_malloc(sizeof(slong) * n);
+
+        for (j = 0; j < n; j++)
+            Qtmp[j] = Q[c0 + Q1[j]];
+        for (j = 0; j < n; j++)
+            Q[c0 + j] = Qtmp[j];
+
+        flint_free(Qtmp);
+    }
+
+    _nmod_vec_clear(tmp);
+}
+
+/*
+    Recursive PLUQ decomposition splitting the columns in halves. After
+    the left half is decomposed, its pivot rows are used to eliminate the
+    right half (a triangular solve and a trailing-matrix update with fast
+    matrix multiplication, both split over threads), the remaining block
+    is decomposed recursively and its pivot columns are rotated next to
+    those of the left half. The pivots are the same as those chosen by
+    nmod_mat_pluq_classical.
+*/
+slong
+nmod_mat_pluq(slong * P, slong * Q, nmod_mat_t A)
+{
+    slong i, m, n, n1, r1, r2;
+    slong * P1, * Q1;
+    nmod_mat_t A0, A00, A01, A10, A11;
+
+    m = A->r;
+    n = A->c;
+
+    if (m < NMOD_MAT_PLUQ_CUTOFF || n < NMOD_MAT_PLUQ_CUTOFF)
+        return nmod_mat_pluq_classical(P, Q, A);
+
+    n1 = n / 2;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+    for (i = 0; i < n; i++)
+        Q[i] = i;
+
+    P1 = flint_malloc(sizeof(slong) * m);
+    Q1 = flint_malloc(sizeof(slong) * n);
+
+    nmod_mat_window_init(A0, A, 0, 0, m, n1);
+    r1 = nmod_mat_pluq(P1, Q1, A0);
+    nmod_mat_window_clear(A0);
+
+    /* the row swaps of the left half only moved the pointers of A0 */
+    _nmod_mat_pluq_permute_rows(P, A, P1, m, 0);
+    for (i = 0; i < n1; i++)
+        Q[i] = Q1[i];
+
+    nmod_mat_window_init(A00, A, 0, 0, r1, r1);
+    nmod_mat_window_init(A01, A, 0, n1, r1, n);
+    nmod_mat_window_init(A10, A, r1, 0, m, r1);
+    nmod_mat_window_init(A11, A, r1, n1, m, n);
+
+    if (r1 != 0)
+    {
+        _nmod_mat_pluq_update_threaded(A01, A00, NULL, 0);
+
+        if (r1 < m)
+            _nmod_mat_pluq_update_threaded(A11, A10, A01, 1);
+    }
+
+    r2 = nmod_mat_pluq(P1, Q1, A11);
+
+    _nmod_mat_pluq_permute_rows(P, A, P1, m - r1, r1);
+
+    /* the rows of U above A11 get the same column permutation */
+    _nmod_mat_pluq_permute_cols(Q, A, Q1, n - n1, n1, 0, r1);
+
+    /*
+        Rotate the pivot columns of A11 in front of the non-pivot columns
+        of the left half; below row r1, the latter are zero, and this moves
+        the second block of L next to the first.
+    */
+    if (r2 != 0 && r1 != n1)
+    {
+        slong * R = flint_malloc(sizeof(slong) * (n1 - r1 + r2));
+
+        for (i = 0; i < r2; i++)
+            R[i] = n1 - r1 + i;
+        for (i = 0; i < n1 - r1; i++)
+            R[r2 + i] = i;
+
+        _nmod_mat_pluq_permute_cols(Q, A, R, n1 - r1 + r2, r1, 0, m);
+
+        flint_free(R);
+    }
+
+    nmod_mat_window_clear(A00);
+    nmod_mat_window_clear(A01);
+    nmod_mat_window_clear(A10);
+    nmod_mat_window_clear(A11);
+
+    flint_free(P1);
+    flint_free(Q1);
+
+    return r1 + r2;
+}
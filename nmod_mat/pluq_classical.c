@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+/*
+    Gaussian elimination searching the columns from left to right and
+    taking the first nonzero entry of the remaining rows as pivot. Pivot
+    rows and columns are moved into place by cyclic rotations rather than
+    transpositions, so that the remaining rows and columns keep their
+    relative order; this is what makes the permutations reveal the row
+    and column rank profiles.
+*/
+slong
+nmod_mat_pluq_classical(slong * P, slong * Q, nmod_mat_t A)
+{
+    mp_limb_t d, e, t, ** a;
+    mp_ptr u;
+    nmod_t mod;
+    slong i, j, m, n, rank, col, len;
+
+    m = A->r;
+    n = A->c;
+    a = A->rows;
+    mod = A->mod;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+    for (j = 0; j < n; j++)
+        Q[j] = j;
+
+    rank = 0;
+
+    for (col = 0; col < n && rank < m; col++)
+    {
+        for (i = rank; i < m && a[i][col] == 0; i++) ;
+
+        if (i == m)
+            continue;
+
+        if (i != rank)
+        {
+            slong p = P[i];
+
+            u = a[i];
+            for (j = i; j > rank; j--)
+            {
+                a[j] = a[j - 1];
+                P[j] = P[j - 1];
+            }
+            a[rank] = u;
+            P[rank] = p;
+        }
+
+        /* the columns skipped so far are zero below row rank */
+        if (col != rank)
+        {
+            slong q = Q[col];
+
+            for (i = 0; i < m; i++)
+            {
+                t = a[i][col];
+                memmove(a[i] + rank + 1, a[i] + rank,
+                                        (col - rank) * sizeof(mp_limb_t));
+                a[i][rank] = t;
+            }
+
+            for (j = col; j > rank; j--)
+                Q[j] = Q[j - 1];
+            Q[rank] = q;
+        }
+
+        d = n_invmod(a[rank][rank], mod.n);
+        len = n - rank - 1;
+
+        for (i = rank + 1; i < m; i++)
+        {
+            if (a[i][rank] == 0)
+                continue;
+
+            e = n_mulmod2_preinv(a[i][rank], d, mod.n, mod.ninv);
+
+            if (len != 0)
+                _nmod_vec_scalar_addmul_nmod(a[i] + rank + 1,
+                    a[rank] + rank + 1, len, nmod_neg(e, mod), mod);
+
+            a[i][rank] = e;
+        }
+
+        rank++;
+    }
+
+    return rank;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -12,94 +13,57 @@
 #include <stdlib.h>
 #include <gmp.h>
 #include "flint.h"
+#include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "gf2_mat.h"
 #include "perm.h"
 
+/*
+    Uses the PLUQ decomposition: its column permutation lists the pivot
+    columns of the rref followed by the non-pivot columns, both in
+    increasing order, and writing U = [U1 | U2] in that column order, the
+    nonzero rows of the rref are [1 | U1^(-1) U2].
+*/
 slong
 _nmod_mat_rref(nmod_mat_t A, slong * pivots_nonpivots, slong * P)
 {
-    slong i, j, k, n, rank;
-    slong * pivots;
-    slong * nonpivots;
-
+    slong i, j, m, n, rank;
+    slong * Q = pivots_nonpivots;
     nmod_mat_t U, V;
 
+    m = A->r;
     n = A->c;
 
-    rank = nmod_mat_lu(P, A, 0);
+    rank = nmod_mat_pluq(P, Q, A);
 
     if (rank == 0)
-    {
-        for (i = 0; i < n; i++)
-            pivots_nonpivots[i] = i;
         return rank;
-    }
-
-    /* Clear L */
-    for (i = 0; i < A->r; i++)
-        for (j = 0; j < FLINT_MIN(i, rank); j++)
-            nmod_mat_entry(A, i, j) = UWORD(0);
-
-    /* We now reorder U to proper upper triangular form U | V
-       with U full-rank triangular, set V = U^(-1) V, and then
-       put the column back in the original order.
 
-       An improvement for some matrices would be to compress V by
-       discarding columns containing nothing but zeros. */
-
-    nmod_mat_init(U, rank, rank, A->mod.n);
     nmod_mat_init(V, rank, n - rank, A->mod.n);
 
-    pivots = pivots_nonpivots;
-    nonpivots = pivots_nonpivots + rank;
-
-    for (i = j = k = 0; i < rank; i++)
-    {
-        while (nmod_mat_entry(A, i, j) == UWORD(0))
-        {
-            nonpivots[k] = j;
-            k++;
-            j++;
-        }
-        pivots[i] = j;
-        j++;
-    }
-    while (k < n - rank)
-    {
-        nonpivots[k] = j;
-        k++;
-        j++;
-    }
-
-    for (i = 0; i < rank; i++)
+    if (rank < n)
     {
-        for (j = 0; j <= i; j++)
-            nmod_mat_entry(U, j, i) = nmod_mat_entry(A, j, pivots[i]);
-    }
+        nmod_mat_window_init(U, A, 0, rank, rank, n);
+        nmod_mat_set(V, U);
+        nmod_mat_window_clear(U);
 
-    for (i = 0; i < n - rank; i++)
-    {
-        for (j = 0; j < rank; j++)
-            nmod_mat_entry(V, j, i) = nmod_mat_entry(A, j, nonpivots[i]);
+        nmod_mat_window_init(U, A, 0, 0, rank, rank);
+        nmod_mat_solve_triu(V, U, V, 0);
+        nmod_mat_window_clear(U);
     }
 
-    nmod_mat_solve_triu(V, U, V, 0);
+    /* the rows of A have been permuted, so reset them all */
+    for (i = 0; i < m; i++)
+        _nmod_vec_zero(A->rows[i], n);
 
-    /* Clear pivot columns */
     for (i = 0; i < rank; i++)
     {
-        for (j = 0; j <= i; j++)
-            nmod_mat_entry(A, j, pivots[i]) = (i == j);
-    }
+        nmod_mat_entry(A, i, Q[i]) = UWORD(1);
 
-    /* Write back the actual content */
-    for (i = 0; i < n - rank; i++)
-    {
-        for (j = 0; j < rank; j++)
-            nmod_mat_entry(A, j, nonpivots[i]) = nmod_mat_entry(V, j, i);
+        for (j = 0; j < n - rank; j++)
+            nmod_mat_entry(A, i, Q[rank + j]) = nmod_mat_entry(V, i, j);
     }
 
-    nmod_mat_clear(U);
     nmod_mat_clear(V);
 
     return rank;
@@ -109,6 +73,20 @@ slong
 nmod_mat_rref(nmod_mat_t A)
 {
     slong rank, * pivots_nonpivots, * P;
+
+    if (A->mod.n == 2)
+    {
+        gf2_mat_t B;
+
+        gf2_mat_init(B, A->r, A->c);
+        gf2_mat_set_nmod_mat(B, A);
+        rank = gf2_mat_rref(B);
+        gf2_mat_get_nmod_mat(A, B);
+        gf2_mat_clear(B);
+
+        return rank;
+    }
+
     pivots_nonpivots = flint_malloc(sizeof(slong) * A->c);
     P = _perm_init(nmod_mat_nrows(A));
 
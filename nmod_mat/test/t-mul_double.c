@@ -0,0 +1,152 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+void
+nmod_mat_mul_check(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    slong i, j, k;
+    mp_limb_t c;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            c = 0;
+
+            for (k = 0; k < A->c; k++)
+                c = nmod_add(c, nmod_mul(A->rows[i][k], B->rows[k][j], C->mod),
+                                                                C->mod);
+
+            C->rows[i][j] = c;
+        }
+    }
+}
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_double....");
+    fflush(stdout);
+
+#if FLINT64  /* the floating-point kernel is only used on 64-bit machines */
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D, E;
+        mp_limb_t mod;
+        slong m, k, n;
+        int op, level;
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 300);
+            k = n_randint(state, 600);
+            n = n_randint(state, 300);
+        }
+        else
+        {
+            m = n_randint(state, 40);
+            k = n_randint(state, 40);
+            n = n_randint(state, 40);
+        }
+
+        /* the largest moduli need the most intermediate reductions */
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                mod = n_randtest_not_zero(state) %
+                                (UWORD(1) << NMOD_MAT_MUL_DOUBLE_MAX_BITS);
+                mod += (mod == 0);
+                break;
+            case 1:
+                mod = (UWORD(1) << NMOD_MAT_MUL_DOUBLE_MAX_BITS)
+                                            - 1 - n_randbits(state, 4);
+                break;
+            default:
+                mod = (UWORD(1) << (NMOD_MAT_MUL_DOUBLE_MAX_BITS - 1))
+                                            + n_randbits(state, 4);
+                break;
+        }
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(E, m, n, mod);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(A, state);
+        else
+            nmod_mat_randfull(A, state);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(B, state);
+        else
+            nmod_mat_randfull(B, state);
+
+        nmod_mat_randtest(C, state);
+
+        /* exercise the portable kernel as well */
+        level = nmod_vec_simd_level();
+        if (n_randint(state, 2))
+            nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+
+        op = (int) n_randint(state, 3) - 1;
+
+        nmod_mat_mul_check(D, A, B);
+
+        if (op == 1)
+            nmod_mat_add(D, C, D);
+        else if (op == -1)
+            nmod_mat_sub(D, C, D);
+
+        if (op == 0)
+            nmod_mat_mul_double(E, A, B);
+        else
+        {
+            nmod_mat_set(E, C);
+            _nmod_mat_mul_double(E, E, A, B, op);
+        }
+
+        nmod_vec_set_simd_level(level);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu, op = %d\n",
+                m, k, n, mod, op);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+#endif
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
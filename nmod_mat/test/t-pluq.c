@@ -0,0 +1,230 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+/* rank of the submatrix of A formed by its first r rows and c columns */
+slong lu_rank(const nmod_mat_t A, slong r, slong c)
+{
+    nmod_mat_t B;
+    slong i, j, rank, * P;
+
+    nmod_mat_init(B, r, c, A->mod.n);
+    for (i = 0; i < r; i++)
+        for (j = 0; j < c; j++)
+            nmod_mat_entry(B, i, j) = nmod_mat_entry(A, i, j);
+
+    P = flint_malloc(sizeof(slong) * r);
+    rank = nmod_mat_lu_classical(P, B, 0);
+
+    flint_free(P);
+    nmod_mat_clear(B);
+
+    return rank;
+}
+
+void check(const slong * P, const slong * Q, const nmod_mat_t LU,
+                                            const nmod_mat_t A, slong rank)
+{
+    nmod_mat_t B, L, U;
+    slong m, n, i, j, k, * prof;
+
+    m = A->r;
+    n = A->c;
+
+    nmod_mat_init(B, m, n, A->mod.n);
+    nmod_mat_init(L, m, rank, A->mod.n);
+    nmod_mat_init(U, rank, n, A->mod.n);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            if (i >= rank && j >= rank && nmod_mat_entry(LU, i, j) != 0)
+            {
+                flint_printf("FAIL: wrong shape!\n");
+                abort();
+            }
+
+            if (i < rank && j >= i)
+            {
+                if (j == i && nmod_mat_entry(LU, i, j) == 0)
+                {
+                    flint_printf("FAIL: zero pivot!\n");
+                    abort();
+                }
+
+                nmod_mat_entry(U, i, j) = nmod_mat_entry(LU, i, j);
+            }
+            else if (j < rank)
+                nmod_mat_entry(L, i, j) = nmod_mat_entry(LU, i, j);
+        }
+
+        if (i < rank)
+            nmod_mat_entry(L, i, i) = UWORD(1);
+    }
+
+    nmod_mat_mul(B, L, U);
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            if (nmod_mat_entry(B, i, j) != nmod_mat_entry(A, P[i], Q[j]))
+            {
+                flint_printf("FAIL\n");
+                flint_printf("A:\n");
+                nmod_mat_print_pretty(A);
+                flint_printf("LU:\n");
+                nmod_mat_print_pretty(LU);
+                abort();
+            }
+        }
+    }
+
+    /* column rank profile */
+    for (j = k = 0; j < n; j++)
+    {
+        if (lu_rank(A, m, j + 1) > lu_rank(A, m, j))
+        {
+            if (k >= rank || Q[k] != j)
+            {
+                flint_printf("FAIL: wrong column rank profile!\n");
+                abort();
+            }
+            k++;
+        }
+    }
+
+    /* row rank profile */
+    prof = flint_malloc(sizeof(slong) * m);
+    for (i = 0; i < m; i++)
+        prof[i] = 0;
+    for (i = 0; i < rank; i++)
+        prof[P[i]] = 1;
+
+    for (i = 0; i < m; i++)
+    {
+        if ((lu_rank(A, i + 1, n) > lu_rank(A, i, n)) != prof[i])
+        {
+            flint_printf("FAIL: wrong row rank profile!\n");
+            abort();
+        }
+    }
+
+    flint_free(prof);
+    nmod_mat_clear(B);
+    nmod_mat_clear(L);
+    nmod_mat_clear(U);
+}
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pluq....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, LU, LU2;
+        mp_limb_t mod;
+        slong m, n, r, d, j, k, rank, rank2;
+        slong * P, * Q, * P2, * Q2;
+
+        m = n_randint(state, 100);
+        n = n_randint(state, 100);
+        mod = n_randtest_prime(state, 0);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_randrank(A, state, r);
+
+        if (n_randint(state, 2))
+        {
+            d = n_randint(state, 2*m*n + 1);
+            nmod_mat_randops(A, d, state);
+        }
+
+        /* zero out some rows and columns to get nontrivial profiles */
+        if (n_randint(state, 2))
+        {
+            for (j = 0; j < m; j++)
+                if (n_randint(state, 4) == 0)
+                    _nmod_vec_zero(A->rows[j], n);
+
+            for (k = 0; k < n; k++)
+                if (n_randint(state, 4) == 0)
+                    for (j = 0; j < m; j++)
+                        nmod_mat_entry(A, j, k) = 0;
+        }
+
+        nmod_mat_init_set(LU, A);
+        nmod_mat_init_set(LU2, A);
+        P = flint_malloc(sizeof(slong) * m);
+        Q = flint_malloc(sizeof(slong) * n);
+        P2 = flint_malloc(sizeof(slong) * m);
+        Q2 = flint_malloc(sizeof(slong) * n);
+
+        rank = nmod_mat_pluq(P, Q, LU);
+        rank2 = nmod_mat_pluq_classical(P2, Q2, LU2);
+
+        if (rank != lu_rank(A, m, n) || rank != rank2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong rank!\n");
+            flint_printf("A:");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        check(P, Q, LU, A, rank);
+        check(P2, Q2, LU2, A, rank2);
+
+        /* both variants choose the same pivots */
+        for (j = 0; j < m; j++)
+            if (P[j] != P2[j])
+                break;
+        for (k = 0; k < n; k++)
+            if (Q[k] != Q2[k])
+                break;
+
+        if (j < m || k < n || !nmod_mat_equal(LU, LU2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("classical and recursive PLUQ differ!\n");
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(LU);
+        nmod_mat_clear(LU2);
+        flint_free(P);
+        flint_free(Q);
+        flint_free(P2);
+        flint_free(Q2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
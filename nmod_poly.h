@@ -46,6 +46,11 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+#define NMOD_POLY_TREE_THREAD_CUTOFF 1024 /* Subproduct trees: threading   */
+#define NMOD_POLY_MULTIPOINT_PREINV_CUTOFF 32 /* Node inverses: min degree */
+#define NMOD_POLY_EVALUATE_SHOUP_CUTOFF 8 /* Horner: lazy Shoup products */
+#define NMOD_POLY_INTERP_MAX_COSETS 8   /* Transform points: max cosets  */
+
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -130,6 +135,57 @@ typedef struct
 }
 nmod_poly_compose_mod_precomp_preinv_arg_t;
 
+/*
+    Evaluation points with their subproduct tree, the product of all nodes
+    and the inverses of the reversed nodes, and the interpolation weights.
+*/
+typedef struct
+{
+    mp_ptr * tree;
+    mp_ptr * tree_inv;
+    mp_ptr root;
+    mp_ptr root_inv;
+    mp_ptr weights;
+    slong len;
+    nmod_t mod;
+}
+nmod_poly_multipoint_struct;
+
+typedef nmod_poly_multipoint_struct nmod_poly_multipoint_t[1];
+
+/*
+    A set of evaluation points suited to evaluation and interpolation of
+    polynomials of bounded length. If the modulus has enough roots of unity
+    of order a power of two, the points are K cosets c_k <w> of the group
+    generated by a root of unity w of order M, handled by number theoretic
+    transforms; otherwise they are 0, 1, ..., len - 1 with a subproduct tree.
+*/
+typedef struct
+{
+    mp_ptr w;           /* w^j for j < M / 2 with Shoup constants */
+    mp_ptr w_pr;
+    mp_ptr winv;        /* w^-j for j < M / 2 with Shoup constants */
+    mp_ptr winv_pr;
+    mp_ptr cpow;        /* c_k^i for i < M, k < K with Shoup constants */
+    mp_ptr cpow_pr;
+    mp_ptr cinv;        /* c_k^-i / M for i < M, k < K with Shoup constants */
+    mp_ptr cinv_pr;
+    mp_ptr c;           /* c_k, and d_k = c_k^M with Shoup constants */
+    mp_ptr d;
+    mp_ptr d_pr;
+    mp_ptr Vinv;        /* inverse of the Vandermonde matrix of the d_k */
+    nmod_poly_multipoint_t tree;
+    slong depth;
+    slong M;
+    slong K;
+    slong len;
+    int ntt;
+    nmod_t mod;
+}
+nmod_poly_interp_struct;
+
+typedef nmod_poly_interp_struct nmod_poly_interp_t[1];
+
 /* zn_poly helper functions  ************************************************
 
 Copyright (C) 2007, 2008 David Harvey
@@ -827,6 +883,75 @@ FLINT_DLL void _nmod_poly_tree_free(mp_ptr * tree, slong len);
 FLINT_DLL void _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots,
     slong len, nmod_t mod);
 
+FLINT_DLL void _nmod_poly_tree_level_threaded(void (* fn)(void *, slong, slong),
+    void * arg, slong num, slong len);
+
+/* Multipoint evaluation and interpolation with precomputation  *************/
+
+FLINT_DLL void nmod_poly_multipoint_init(nmod_poly_multipoint_t M,
+                                    mp_srcptr xs, slong len, mp_limb_t n);
+
+FLINT_DLL void nmod_poly_multipoint_clear(nmod_poly_multipoint_t M);
+
+FLINT_DLL void _nmod_poly_multipoint_evaluate(mp_ptr ys, mp_srcptr poly,
+                                slong plen, const nmod_poly_multipoint_t M);
+
+FLINT_DLL void nmod_poly_multipoint_evaluate(mp_ptr ys,
+                    const nmod_poly_t poly, const nmod_poly_multipoint_t M);
+
+FLINT_DLL void _nmod_poly_multipoint_evaluate_transposed(mp_ptr ys,
+            mp_srcptr poly, slong plen, const nmod_poly_multipoint_t M);
+
+FLINT_DLL void nmod_poly_multipoint_evaluate_transposed(mp_ptr ys,
+                    const nmod_poly_t poly, const nmod_poly_multipoint_t M);
+
+FLINT_DLL void _nmod_poly_multipoint_interpolate(mp_ptr poly, mp_srcptr ys,
+                                            const nmod_poly_multipoint_t M);
+
+FLINT_DLL void nmod_poly_multipoint_interpolate(nmod_poly_t poly,
+                            mp_srcptr ys, const nmod_poly_multipoint_t M);
+
+/* Evaluation and interpolation at transform-friendly points  ***************/
+
+FLINT_DLL int nmod_poly_interp_init(nmod_poly_interp_t S,
+                                                    slong len, mp_limb_t n);
+
+FLINT_DLL void nmod_poly_interp_clear(nmod_poly_interp_t S);
+
+NMOD_POLY_INLINE
+slong nmod_poly_interp_num_points(const nmod_poly_interp_t S)
+{
+    return S->len;
+}
+
+FLINT_DLL void nmod_poly_interp_points(mp_ptr xs, const nmod_poly_interp_t S);
+
+NMOD_POLY_INLINE
+int _nmod_poly_interp_ntt_available(slong len, mp_limb_t n)
+{
+    slong v;
+
+    if (len <= 0 || n >= UWORD_HALF || (mp_limb_t) len >= n)
+        return 0;
+
+    count_trailing_zeros(v, n - 1);
+    v = FLINT_MIN(v, FLINT_CLOG2(len));
+
+    return ((len - 1) >> v) < NMOD_POLY_INTERP_MAX_COSETS;
+}
+
+FLINT_DLL void _nmod_poly_interp_evaluate(mp_ptr ys, mp_srcptr poly,
+                                    slong plen, const nmod_poly_interp_t S);
+
+FLINT_DLL void nmod_poly_interp_evaluate(mp_ptr ys, const nmod_poly_t poly,
+                                                const nmod_poly_interp_t S);
+
+FLINT_DLL void _nmod_poly_interp_interpolate(mp_ptr poly, mp_srcptr ys,
+                                                const nmod_poly_interp_t S);
+
+FLINT_DLL void nmod_poly_interp_interpolate(nmod_poly_t poly, mp_srcptr ys,
+                                                const nmod_poly_interp_t S);
+
 /* Interpolation  ************************************************************/
 
 FLINT_DLL void _nmod_poly_interpolate_nmod_vec_newton(mp_ptr poly, mp_srcptr xs,
@@ -1233,20 +1358,28 @@ FLINT_DLL void nmod_poly_inflate(nmod_poly_t result, const nmod_poly_t input,
 
 FLINT_DLL void nmod_mat_charpoly_danilevsky(nmod_poly_t p, const nmod_mat_t M);
 
+FLINT_DLL void nmod_mat_charpoly_krylov(nmod_poly_t p, const nmod_mat_t M);
+
 NMOD_POLY_INLINE
 void nmod_mat_charpoly(nmod_poly_t p, const nmod_mat_t M)
 {
    nmod_mat_t A;
 
-   nmod_mat_init(A, M->r, M->c, p->mod.n);
-   nmod_mat_set(A, M);
-
-   if (A->r != A->c)
+   if (M->r != M->c)
    {
        flint_printf("Exception (nmod_mat_charpoly).  Non-square matrix.\n");
        flint_abort();
    }
 
+   if (M->r >= NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF)
+   {
+       nmod_mat_charpoly_krylov(p, M);
+       return;
+   }
+
+   nmod_mat_init(A, M->r, M->c, p->mod.n);
+   nmod_mat_set(A, M);
+
    nmod_mat_charpoly_danilevsky(p, A);
 
    nmod_mat_clear(A);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -31,6 +32,22 @@ _nmod_poly_evaluate_nmod(mp_srcptr poly, slong len, mp_limb_t c, nmod_t mod)
     val = poly[m];
     m--;
 
+    if (len >= NMOD_POLY_EVALUATE_SHOUP_CUTOFF && mod.norm >= 2)
+    {
+        /* Horner with the value kept in [0, 2n) */
+        const mp_limb_t c_red = n_mod2_preinv(c, mod.n, mod.ninv);
+        const mp_limb_t c_pr = n_mulmod_precomp_shoup(c_red, mod.n);
+        const mp_limb_t n2 = 2 * mod.n;
+
+        for ( ; m >= 0; m--)
+        {
+            val = n_mulmod_shoup_lazy(c_red, val, c_pr, mod.n) + poly[m];
+            val -= (val >= n2) ? n2 : 0;
+        }
+
+        return (val >= mod.n) ? val - mod.n : val;
+    }
+
     for ( ; m >= 0; m--)
     {
         val = n_mulmod2_preinv(val, c, mod.n, mod.ninv);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -12,6 +13,7 @@
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
+#include "nmod_vec.h"
 #include "nmod_poly.h"
 
 /* This gives some speedup for small lengths. */
@@ -24,14 +26,75 @@ static __inline__ void _nmod_poly_rem_2(mp_ptr r, mp_srcptr a, slong al,
         _nmod_poly_rem(r, a, al, b, bl, mod);
 }
 
+typedef struct
+{
+    mp_ptr t;
+    mp_ptr u;
+    mp_srcptr poly;
+    slong plen;
+    mp_srcptr pa;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+evaluate_fast_arg_t;
+
+/* initial reduction of the polynomial by nodes start, ..., stop - 1 */
+static void
+_nmod_poly_evaluate_fast_top(void * arg_ptr, slong start, slong stop)
+{
+    evaluate_fast_arg_t * arg = (evaluate_fast_arg_t *) arg_ptr;
+    slong k, i, tlen, pow = arg->pow;
+
+    for (k = start; k < stop; k++)
+    {
+        i = k * pow;
+        tlen = ((i + pow) <= arg->len) ? pow : arg->len % pow;
+        _nmod_poly_rem(arg->t + i, arg->poly, arg->plen,
+                            arg->pa + k * (pow + 1), tlen + 1, arg->mod);
+    }
+}
+
+/* reduces the remainders for parents start, ..., stop - 1 of a level */
+static void
+_nmod_poly_evaluate_fast_level(void * arg_ptr, slong start, slong stop)
+{
+    evaluate_fast_arg_t * arg = (evaluate_fast_arg_t *) arg_ptr;
+    slong k, left, pow = arg->pow;
+    mp_srcptr pa, pb;
+    mp_ptr pc;
+    nmod_t mod = arg->mod;
+
+    for (k = start; k < stop; k++)
+    {
+        left = arg->len - 2 * pow * k;
+        pa = arg->pa + (2 * pow + 2) * k;
+        pb = arg->t + 2 * pow * k;
+        pc = arg->u + 2 * pow * k;
+
+        if (left >= 2 * pow)
+        {
+            _nmod_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, mod);
+            _nmod_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, mod);
+        }
+        else if (left > pow)
+        {
+            _nmod_poly_rem(pc, pb, left, pa, pow + 1, mod);
+            _nmod_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, mod);
+        }
+        else
+            _nmod_vec_set(pc, pb, left);
+    }
+}
+
 void
 _nmod_poly_evaluate_nmod_vec_fast_precomp(mp_ptr vs, mp_srcptr poly,
     slong plen, const mp_ptr * tree, slong len, nmod_t mod)
 {
-    slong height, i, j, pow, left;
+    evaluate_fast_arg_t arg;
+    slong height, i, pow;
     slong tree_height;
-    slong tlen;
-    mp_ptr t, u, swap, pa, pb, pc;
+    mp_ptr t, u, swap;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
@@ -50,8 +113,6 @@ _nmod_poly_evaluate_nmod_vec_fast_precomp(mp_ptr vs, mp_srcptr poly,
     t = _nmod_vec_init(len);
     u = _nmod_vec_init(len);
 
-    left = len;
-
     /* Initial reduction. We allow the polynomial to be larger
        or smaller than the number of points. */
     height = FLINT_BIT_COUNT(plen - 1) - 1;
@@ -60,38 +121,28 @@ _nmod_poly_evaluate_nmod_vec_fast_precomp(mp_ptr vs, mp_srcptr poly,
         height--;
     pow = WORD(1) << height;
 
-    for (i = j = 0; i < len; i += pow, j += (pow + 1))
-    {
-        tlen = ((i + pow) <= len) ? pow : len % pow;
-        _nmod_poly_rem(t + i, poly, plen, tree[height] + j, tlen + 1, mod);
-    }
+    arg.t = t;
+    arg.poly = poly;
+    arg.plen = plen;
+    arg.pa = tree[height];
+    arg.pow = pow;
+    arg.len = len;
+    arg.mod = mod;
+
+    _nmod_poly_tree_level_threaded(_nmod_poly_evaluate_fast_top, &arg,
+                                                (len + pow - 1) / pow, len);
 
     for (i = height - 1; i >= 0; i--)
     {
         pow = WORD(1) << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
 
-        while (left >= 2 * pow)
-        {
-            _nmod_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, mod);
-            _nmod_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, mod);
+        arg.t = t;
+        arg.u = u;
+        arg.pa = tree[i];
+        arg.pow = pow;
 
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
-        }
-
-        if (left > pow)
-        {
-            _nmod_poly_rem(pc, pb, left, pa, pow + 1, mod);
-            _nmod_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, mod);
-        }
-        else if (left > 0)
-            _nmod_vec_set(pc, pb, left);
+        _nmod_poly_tree_level_threaded(_nmod_poly_evaluate_fast_level, &arg,
+                                            (len + 2 * pow - 1) / (2 * pow), len);
 
         swap = t;
         t = u;
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Decimation in frequency transform of length M = 2^depth: replaces a by
+    its values at the powers of w, in bit-reversed order.
+*/
+static void
+_nmod_poly_interp_ntt(mp_ptr a, const nmod_poly_interp_t S)
+{
+    slong m, h, s, j, step, M = S->M;
+    mp_limb_t u, v, n = S->mod.n;
+
+    for (m = M, step = 1; m >= 2; m /= 2, step *= 2)
+    {
+        h = m / 2;
+
+        for (s = 0; s < M; s += m)
+        {
+            for (j = 0; j < h; j++)
+            {
+                u = a[s + j];
+                v = a[s + j + h];
+                a[s + j] = nmod_add(u, v, S->mod);
+                a[s + j + h] = n_mulmod_shoup(S->w[j * step],
+                        nmod_sub(u, v, S->mod), S->w_pr[j * step], n);
+            }
+        }
+    }
+}
+
+void
+_nmod_poly_interp_evaluate(mp_ptr ys, mp_srcptr poly, slong plen,
+                                                const nmod_poly_interp_t S)
+{
+    slong i, k, l, M = S->M;
+    mp_limb_t s, n = S->mod.n;
+    mp_ptr b;
+
+    if (!S->ntt)
+    {
+        _nmod_poly_multipoint_evaluate(ys, poly, plen, S->tree);
+        return;
+    }
+
+    /*
+        Writing poly = sum x^i p_i(x^M) for i < M, its value at c_k w^t is
+        the value at w^t of sum c_k^i p_i(d_k) x^i.
+    */
+    for (k = 0; k < S->K; k++)
+    {
+        b = ys + k * M;
+
+        for (i = 0; i < M; i++)
+        {
+            s = 0;
+
+            for (l = (plen - 1 - i) / M; l >= 0 && i < plen; l--)
+                s = nmod_add(n_mulmod_shoup(S->d[k], s, S->d_pr[k], n),
+                                                poly[i + l * M], S->mod);
+
+            b[i] = n_mulmod_shoup(S->cpow[k * M + i], s,
+                                            S->cpow_pr[k * M + i], n);
+        }
+
+        _nmod_poly_interp_ntt(b, S);
+    }
+}
+
+void
+nmod_poly_interp_evaluate(mp_ptr ys, const nmod_poly_t poly,
+                                                const nmod_poly_interp_t S)
+{
+    _nmod_poly_interp_evaluate(ys, poly->coeffs, poly->length, S);
+}
@@ -0,0 +1,224 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+/*
+    Chooses M = 2^depth dividing n - 1 and K <= NMOD_POLY_INTERP_MAX_COSETS
+    cosets with K M >= len minimal, preferring larger transforms, and sets
+    up the tables. Returns 0 if n has too few roots of unity of order a
+    power of two.
+*/
+static int
+_nmod_poly_interp_init_ntt(nmod_poly_interp_t S, slong len)
+{
+    nmod_t mod = S->mod;
+    mp_limb_t w, winv, c, d, Minv, ci, t;
+    slong i, j, k, l, v, M, K, h, best, best_depth;
+    nmod_mat_t V, Vinv;
+    mp_ptr tab;
+    int ok;
+
+    count_trailing_zeros(v, mod.n - 1);
+    v = FLINT_MIN(v, FLINT_CLOG2(len));
+
+    best = WORD_MAX;
+    best_depth = -1;
+
+    for (j = v; j >= 0; j--)
+    {
+        M = WORD(1) << j;
+        K = (len + M - 1) / M;
+
+        if (K > NMOD_POLY_INTERP_MAX_COSETS)
+            break;
+
+        if (K * M < best)
+        {
+            best = K * M;
+            best_depth = j;
+        }
+    }
+
+    if (best_depth < 0 || best >= mod.n)
+        return 0;
+
+    M = WORD(1) << best_depth;
+    K = best / M;
+    h = FLINT_MAX(M / 2, 1);
+
+    tab = _nmod_vec_init(4 * h + 4 * K * M + 3 * K + K * K);
+    S->w = tab;
+    S->w_pr = S->w + h;
+    S->winv = S->w_pr + h;
+    S->winv_pr = S->winv + h;
+    S->cpow = S->winv_pr + h;
+    S->cpow_pr = S->cpow + K * M;
+    S->cinv = S->cpow_pr + K * M;
+    S->cinv_pr = S->cinv + K * M;
+    S->c = S->cinv_pr + K * M;
+    S->d = S->c + K;
+    S->d_pr = S->d + K;
+    S->Vinv = S->d_pr + K;
+
+    /* shifts c_k with distinct nonzero c_k^M give disjoint cosets */
+    for (k = 0, c = 1; k < K && c < mod.n && c < 64 * K; c++)
+    {
+        d = n_powmod2_ui_preinv(c, M, mod.n, mod.ninv);
+
+        for (l = 0; l < k && S->d[l] != d; l++) ;
+
+        if (d != 0 && l == k)
+        {
+            S->c[k] = c;
+            S->d[k] = d;
+            S->d_pr[k] = n_mulmod_precomp_shoup(d, mod.n);
+            k++;
+        }
+    }
+
+    if (k < K)
+    {
+        _nmod_vec_clear(tab);
+        S->w = NULL;
+        return 0;
+    }
+
+    /* a root of unity of order exactly M */
+    w = 1;
+    if (M > 1)
+    {
+        for (c = 2; ; c++)
+        {
+            w = n_powmod2_ui_preinv(c, (mod.n - 1) >> best_depth,
+                                                        mod.n, mod.ninv);
+            if (n_powmod2_ui_preinv(w, M / 2, mod.n, mod.ninv) == mod.n - 1)
+                break;
+        }
+    }
+
+    winv = n_invmod(w, mod.n);
+    S->w[0] = S->winv[0] = 1;
+    for (i = 1; i < h; i++)
+    {
+        S->w[i] = nmod_mul(S->w[i - 1], w, mod);
+        S->winv[i] = nmod_mul(S->winv[i - 1], winv, mod);
+    }
+
+    for (i = 0; i < h; i++)
+    {
+        S->w_pr[i] = n_mulmod_precomp_shoup(S->w[i], mod.n);
+        S->winv_pr[i] = n_mulmod_precomp_shoup(S->winv[i], mod.n);
+    }
+
+    Minv = n_invmod(M, mod.n);
+
+    for (k = 0; k < K; k++)
+    {
+        ci = n_invmod(S->c[k], mod.n);
+        S->cpow[k * M] = 1;
+        S->cinv[k * M] = Minv;
+
+        for (i = 1; i < M; i++)
+        {
+            S->cpow[k * M + i] = nmod_mul(S->cpow[k * M + i - 1], S->c[k], mod);
+            S->cinv[k * M + i] = nmod_mul(S->cinv[k * M + i - 1], ci, mod);
+        }
+
+        for (i = 0; i < M; i++)
+        {
+            S->cpow_pr[k * M + i] =
+                            n_mulmod_precomp_shoup(S->cpow[k * M + i], mod.n);
+            S->cinv_pr[k * M + i] =
+                            n_mulmod_precomp_shoup(S->cinv[k * M + i], mod.n);
+        }
+    }
+
+    nmod_mat_init(V, K, K, mod.n);
+    nmod_mat_init(Vinv, K, K, mod.n);
+
+    for (k = 0; k < K; k++)
+    {
+        t = 1;
+        for (l = 0; l < K; l++)
+        {
+            nmod_mat_entry(V, k, l) = t;
+            t = nmod_mul(t, S->d[k], mod);
+        }
+    }
+
+    ok = nmod_mat_inv(Vinv, V);
+
+    for (l = 0; l < K; l++)
+        for (k = 0; k < K; k++)
+            S->Vinv[l * K + k] = nmod_mat_entry(Vinv, l, k);
+
+    nmod_mat_clear(V);
+    nmod_mat_clear(Vinv);
+
+    if (!ok)
+    {
+        _nmod_vec_clear(tab);
+        S->w = NULL;
+        return 0;
+    }
+
+    S->depth = best_depth;
+    S->M = M;
+    S->K = K;
+    S->len = K * M;
+    S->ntt = 1;
+
+    return 1;
+}
+
+int
+nmod_poly_interp_init(nmod_poly_interp_t S, slong len, mp_limb_t n)
+{
+    mp_ptr xs;
+    slong i;
+
+    nmod_init(&S->mod, n);
+    nmod_poly_multipoint_init(S->tree, NULL, 0, n);
+    S->w = NULL;
+    S->depth = S->M = S->K = 0;
+    S->len = 0;
+    S->ntt = 0;
+
+    if (len <= 0)
+        return 1;
+
+    if (!n_is_prime(n))
+        return 0;
+
+    if (n < UWORD_HALF && _nmod_poly_interp_init_ntt(S, len))
+        return 1;
+
+    if (len > n)
+        return 0;
+
+    xs = _nmod_vec_init(len);
+    for (i = 0; i < len; i++)
+        xs[i] = i;
+
+    nmod_poly_multipoint_init(S->tree, xs, len, n);
+    S->len = len;
+
+    _nmod_vec_clear(xs);
+
+    return 1;
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Decimation in time transform of length M = 2^depth at the inverse
+    powers of w: takes values in bit-reversed order and returns M times the
+    coefficients of their interpolating polynomial.
+*/
+static void
+_nmod_poly_interp_ntt_inverse(mp_ptr a, const nmod_poly_interp_t S)
+{
+    slong m, h, s, j, step, M = S->M;
+    mp_limb_t u, v, n = S->mod.n;
+
+    for (m = 2, step = M / 2; m <= M; m *= 2, step /= 2)
+    {
+        h = m / 2;
+
+        for (s = 0; s < M; s += m)
+        {
+            for (j = 0; j < h; j++)
+            {
+                u = a[s + j];
+                v = n_mulmod_shoup(S->winv[j * step], a[s + j + h],
+                                                S->winv_pr[j * step], n);
+                a[s + j] = nmod_add(u, v, S->mod);
+                a[s + j + h] = nmod_sub(u, v, S->mod);
+            }
+        }
+    }
+}
+
+void
+_nmod_poly_interp_interpolate(mp_ptr poly, mp_srcptr ys,
+                                                const nmod_poly_interp_t S)
+{
+    slong i, k, l, M = S->M, K = S->K;
+    mp_limb_t s, n = S->mod.n;
+    mp_ptr T, b;
+
+    if (!S->ntt)
+    {
+        _nmod_poly_multipoint_interpolate(poly, ys, S->tree);
+        return;
+    }
+
+    T = (K == 1) ? poly : _nmod_vec_init(K * M);
+
+    /* recover p_i(d_k) on each coset, then the p_i from their K values */
+    for (k = 0; k < K; k++)
+    {
+        b = T + k * M;
+        _nmod_vec_set(b, ys + k * M, M);
+        _nmod_poly_interp_ntt_inverse(b, S);
+
+        for (i = 0; i < M; i++)
+            b[i] = n_mulmod_shoup(S->cinv[k * M + i], b[i],
+                                            S->cinv_pr[k * M + i], n);
+    }
+
+    if (K == 1)
+        return;
+
+    for (i = 0; i < M; i++)
+    {
+        for (l = 0; l < K; l++)
+        {
+            s = 0;
+            for (k = 0; k < K; k++)
+                s = nmod_add(s, nmod_mul(S->Vinv[l * K + k],
+                                            T[k * M + i], S->mod), S->mod);
+            poly[i + l * M] = s;
+        }
+    }
+
+    _nmod_vec_clear(T);
+}
+
+void
+nmod_poly_interp_interpolate(nmod_poly_t poly, mp_srcptr ys,
+                                                const nmod_poly_interp_t S)
+{
+    nmod_poly_fit_length(poly, S->len);
+    _nmod_poly_interp_interpolate(poly->coeffs, ys, S);
+    poly->length = S->len;
+    _nmod_poly_normalise(poly);
+}
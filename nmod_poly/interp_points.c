@@ -0,0 +1,42 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_interp_points(mp_ptr xs, const nmod_poly_interp_t S)
+{
+    slong i, k, t, e, M = S->M, h = M / 2;
+    mp_limb_t w;
+
+    if (!S->ntt)
+    {
+        for (i = 0; i < S->len; i++)
+            xs[i] = i;
+        return;
+    }
+
+    /* the transform leaves the values in bit-reversed order */
+    for (k = 0; k < S->K; k++)
+    {
+        for (t = 0; t < M; t++)
+        {
+            e = (M == 1) ? 0 : n_revbin(t, S->depth);
+            w = (e < h || M == 1) ? S->w[e] : nmod_neg(S->w[e - h], S->mod);
+            xs[k * M + t] = nmod_mul(S->c[k], w, S->mod);
+        }
+    }
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -40,47 +41,61 @@ _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree, slong len, nmod_
     _nmod_poly_derivative(tmp, tmp, len + 1, mod);
     _nmod_poly_evaluate_nmod_vec_fast_precomp(w, tmp, len, tree, len, mod);
 
-    for (i = 0; i < len; i++)
-        w[i] = n_invmod(w[i], mod.n);
+    /* invert all weights with a single inversion */
+    tmp[0] = w[0];
+    for (i = 1; i < len; i++)
+        tmp[i] = nmod_mul(tmp[i - 1], w[i], mod);
+
+    tmp[len] = n_invmod(tmp[len - 1], mod.n);
+
+    for (i = len - 1; i > 0; i--)
+    {
+        mp_limb_t t = nmod_mul(tmp[len], tmp[i - 1], mod);
+        tmp[len] = nmod_mul(tmp[len], w[i], mod);
+        w[i] = t;
+    }
+
+    w[0] = tmp[len];
 
     _nmod_vec_clear(tmp);
 }
 
-void
-_nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcptr ys,
-    const mp_ptr * tree, mp_srcptr weights, slong len, nmod_t mod)
+typedef struct
 {
-    mp_ptr t, u, pa, pb;
-    slong i, pow, left;
-
-    if (len == 0)
-        return;
+    mp_ptr poly;
+    mp_srcptr pa;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+interpolate_fast_arg_t;
 
-    t = _nmod_vec_init(len);
-    u = _nmod_vec_init(len);
+/* combines the pairs of nodes start, ..., stop - 1 of a level */
+static void
+_nmod_poly_interpolate_fast_level(void * arg_ptr, slong start, slong stop)
+{
+    interpolate_fast_arg_t * arg = (interpolate_fast_arg_t *) arg_ptr;
+    slong k, left, pow = arg->pow;
+    mp_srcptr pa;
+    mp_ptr pb, t, u;
+    nmod_t mod = arg->mod;
 
-    for (i = 0; i < len; i++)
-        poly[i] = nmod_mul(weights[i], ys[i], mod);
+    t = _nmod_vec_init(2 * pow);
+    u = _nmod_vec_init(2 * pow);
 
-    for (i = 0; i < FLINT_CLOG2(len); i++)
+    for (k = start; k < stop; k++)
     {
-        pow = (WORD(1) << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        left = arg->len - 2 * pow * k;
+        pa = arg->pa + (2 * pow + 2) * k;
+        pb = arg->poly + 2 * pow * k;
 
-        while (left >= 2 * pow)
+        if (left >= 2 * pow)
         {
             _nmod_poly_mul(t, pa, pow + 1, pb + pow, pow, mod);
             _nmod_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, mod);
             _nmod_vec_add(pb, t, u, 2 * pow, mod);
-
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
         }
-
-        if (left > pow)
+        else if (left > pow)
         {
             _nmod_poly_mul(t, pa, pow + 1, pb + pow, left - pow, mod);
             _nmod_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, mod);
@@ -92,6 +107,34 @@ _nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcptr ys,
     _nmod_vec_clear(u);
 }
 
+void
+_nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcptr ys,
+    const mp_ptr * tree, mp_srcptr weights, slong len, nmod_t mod)
+{
+    slong i, pow;
+
+    if (len == 0)
+        return;
+
+    for (i = 0; i < len; i++)
+        poly[i] = nmod_mul(weights[i], ys[i], mod);
+
+    for (i = 0; i < FLINT_CLOG2(len); i++)
+    {
+        interpolate_fast_arg_t arg;
+
+        pow = (WORD(1) << i);
+        arg.poly = poly;
+        arg.pa = tree[i];
+        arg.pow = pow;
+        arg.len = len;
+        arg.mod = mod;
+
+        _nmod_poly_tree_level_threaded(_nmod_poly_interpolate_fast_level,
+                                &arg, (len + 2 * pow - 1) / (2 * pow), len);
+    }
+}
+
 
 void
 _nmod_poly_interpolate_nmod_vec_fast(mp_ptr poly,
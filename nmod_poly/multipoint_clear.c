@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_multipoint_clear(nmod_poly_multipoint_t M)
+{
+    slong i;
+
+    if (M->len == 0)
+        return;
+
+    for (i = 0; i <= FLINT_CLOG2(M->len); i++)
+        if (M->tree_inv[i] != NULL)
+            _nmod_vec_clear(M->tree_inv[i]);
+
+    flint_free(M->tree_inv);
+    _nmod_poly_tree_free(M->tree, M->len);
+    _nmod_vec_clear(M->root);
+    _nmod_vec_clear(M->root_inv);
+    _nmod_vec_clear(M->weights);
+}
@@ -0,0 +1,209 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    mp_ptr t;
+    mp_ptr u;
+    mp_srcptr poly;
+    slong plen;
+    mp_srcptr pa;
+    mp_srcptr pinv;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+multipoint_evaluate_arg_t;
+
+/*
+    Sets R to A modulo the node B of degree pow < lenA, using the
+    precomputed inverse Binv of its reversal if there is one and A is short
+    enough. The scratch space Q needs room for pow coefficients.
+*/
+static __inline__ void
+_nmod_poly_rem_node(mp_ptr R, mp_ptr Q, mp_srcptr A, slong lenA,
+                        mp_srcptr B, mp_srcptr Binv, slong pow, nmod_t mod)
+{
+    if (lenA == 2)
+        R[0] = nmod_sub(A[0], nmod_mul(A[1], B[0], mod), mod);
+    else if (Binv != NULL && lenA <= 2 * pow)
+        _nmod_poly_divrem_newton_n_preinv(Q, R, A, lenA, B, pow + 1,
+                                                        Binv, pow, mod);
+    else
+        _nmod_poly_rem(R, A, lenA, B, pow + 1, mod);
+}
+
+static void
+_nmod_poly_multipoint_evaluate_top(void * arg_ptr, slong start, slong stop)
+{
+    multipoint_evaluate_arg_t * arg = (multipoint_evaluate_arg_t *) arg_ptr;
+    slong k, i, tlen, pow = arg->pow;
+    mp_ptr Q;
+
+    Q = _nmod_vec_init(pow);
+
+    for (k = start; k < stop; k++)
+    {
+        i = k * pow;
+
+        if (i + pow <= arg->len)
+            _nmod_poly_rem_node(arg->t + i, Q, arg->poly, arg->plen,
+                arg->pa + k * (pow + 1), (arg->pinv == NULL) ? NULL :
+                    arg->pinv + k * (pow + 1), pow, arg->mod);
+        else
+        {
+            tlen = arg->len - i;
+            _nmod_poly_rem(arg->t + i, arg->poly, arg->plen,
+                                arg->pa + k * (pow + 1), tlen + 1, arg->mod);
+        }
+    }
+
+    _nmod_vec_clear(Q);
+}
+
+static void
+_nmod_poly_multipoint_evaluate_level(void * arg_ptr, slong start, slong stop)
+{
+    multipoint_evaluate_arg_t * arg = (multipoint_evaluate_arg_t *) arg_ptr;
+    slong k, left, pow = arg->pow;
+    mp_srcptr pa, pinv, pb;
+    mp_ptr pc, Q;
+    nmod_t mod = arg->mod;
+
+    Q = _nmod_vec_init(pow);
+
+    for (k = start; k < stop; k++)
+    {
+        left = arg->len - 2 * pow * k;
+        pa = arg->pa + (2 * pow + 2) * k;
+        pinv = (arg->pinv == NULL) ? NULL : arg->pinv + (2 * pow + 2) * k;
+        pb = arg->t + 2 * pow * k;
+        pc = arg->u + 2 * pow * k;
+
+        if (left >= 2 * pow)
+        {
+            _nmod_poly_rem_node(pc, Q, pb, 2 * pow, pa, pinv, pow, mod);
+            _nmod_poly_rem_node(pc + pow, Q, pb, 2 * pow, pa + pow + 1,
+                (pinv == NULL) ? NULL : pinv + pow + 1, pow, mod);
+        }
+        else if (left > pow)
+        {
+            _nmod_poly_rem_node(pc, Q, pb, left, pa, pinv, pow, mod);
+            _nmod_poly_rem(pc + pow, pb, left, pa + pow + 1,
+                                                    left - pow + 1, mod);
+        }
+        else
+            _nmod_vec_set(pc, pb, left);
+    }
+
+    _nmod_vec_clear(Q);
+}
+
+/*
+    Remainder tree as in _nmod_poly_evaluate_nmod_vec_fast_precomp, but
+    dividing by the nodes with their precomputed inverses.
+*/
+void
+_nmod_poly_multipoint_evaluate(mp_ptr ys, mp_srcptr poly, slong plen,
+                                            const nmod_poly_multipoint_t M)
+{
+    multipoint_evaluate_arg_t arg;
+    slong height, i, pow, len = M->len;
+    mp_ptr t, u, r, swap;
+    nmod_t mod = M->mod;
+
+    if (len < 2 || plen < 2)
+    {
+        _nmod_poly_evaluate_nmod_vec_fast_precomp(ys, poly, plen,
+                                                    M->tree, len, mod);
+        return;
+    }
+
+    t = _nmod_vec_init(len);
+    u = _nmod_vec_init(len);
+    r = NULL;
+
+    /* reduce modulo the product of all nodes first */
+    if (plen > len)
+    {
+        r = _nmod_vec_init(len);
+
+        if (plen <= 2 * len)
+        {
+            mp_ptr q = _nmod_vec_init(plen - len);
+            _nmod_poly_divrem_newton_n_preinv(q, r, poly, plen,
+                                    M->root, len + 1, M->root_inv, len, mod);
+            _nmod_vec_clear(q);
+        }
+        else
+            _nmod_poly_rem(r, poly, plen, M->root, len + 1, mod);
+
+        poly = r;
+        plen = len;
+    }
+
+    height = FLINT_BIT_COUNT(plen - 1) - 1;
+    while (height >= FLINT_CLOG2(len))
+        height--;
+    pow = WORD(1) << height;
+
+    arg.t = t;
+    arg.u = u;
+    arg.poly = poly;
+    arg.plen = plen;
+    arg.pa = M->tree[height];
+    arg.pinv = M->tree_inv[height];
+    arg.pow = pow;
+    arg.len = len;
+    arg.mod = mod;
+
+    _nmod_poly_tree_level_threaded(_nmod_poly_multipoint_evaluate_top, &arg,
+                                                    (len + pow - 1) / pow, len);
+
+    for (i = height - 1; i >= 0; i--)
+    {
+        pow = WORD(1) << i;
+
+        arg.t = t;
+        arg.u = u;
+        arg.pa = M->tree[i];
+        arg.pinv = M->tree_inv[i];
+        arg.pow = pow;
+
+        _nmod_poly_tree_level_threaded(_nmod_poly_multipoint_evaluate_level,
+                                &arg, (len + 2 * pow - 1) / (2 * pow), len);
+
+        swap = t;
+        t = u;
+        u = swap;
+    }
+
+    _nmod_vec_set(ys, t, len);
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+    if (r != NULL)
+        _nmod_vec_clear(r);
+}
+
+void
+nmod_poly_multipoint_evaluate(mp_ptr ys, const nmod_poly_t poly,
+                                            const nmod_poly_multipoint_t M)
+{
+    _nmod_poly_multipoint_evaluate(ys, poly->coeffs, poly->length, M);
+}
@@ -0,0 +1,172 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    mp_ptr t;
+    mp_ptr u;
+    mp_srcptr pa;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+multipoint_transposed_arg_t;
+
+/*
+    Given the scaled remainder r of length d = d1 + d2 of a node with
+    children of degrees d1 and d2, sets c to the d1 coefficients
+    d2, ..., d - 1 of r m, where m is the other child of degree d2.
+*/
+static __inline__ void
+_nmod_poly_mulmid_node(mp_ptr c, mp_ptr W, mp_srcptr r, slong d,
+                                        mp_srcptr m, slong d2, nmod_t mod)
+{
+    _nmod_poly_mullow(W, r, d, m, d2 + 1, d, mod);
+    _nmod_vec_set(c, W + d2, d - d2);
+}
+
+static void
+_nmod_poly_multipoint_transposed_level(void * arg_ptr, slong start, slong stop)
+{
+    multipoint_transposed_arg_t * arg =
+                                (multipoint_transposed_arg_t *) arg_ptr;
+    slong k, left, pow = arg->pow;
+    mp_srcptr pa, pb;
+    mp_ptr pc, W;
+    nmod_t mod = arg->mod;
+
+    W = _nmod_vec_init(2 * pow);
+
+    for (k = start; k < stop; k++)
+    {
+        left = arg->len - 2 * pow * k;
+        pa = arg->pa + (2 * pow + 2) * k;
+        pb = arg->t + 2 * pow * k;
+        pc = arg->u + 2 * pow * k;
+
+        if (pow == 1 && left >= 2)
+        {
+            pc[0] = nmod_add(pb[0], nmod_mul(pa[2], pb[1], mod), mod);
+            pc[1] = nmod_add(pb[0], nmod_mul(pa[0], pb[1], mod), mod);
+        }
+        else if (left >= 2 * pow)
+        {
+            _nmod_poly_mulmid_node(pc, W, pb, 2 * pow, pa + pow + 1, pow, mod);
+            _nmod_poly_mulmid_node(pc + pow, W, pb, 2 * pow, pa, pow, mod);
+        }
+        else if (left > pow)
+        {
+            _nmod_poly_mulmid_node(pc, W, pb, left,
+                                        pa + pow + 1, left - pow, mod);
+            _nmod_poly_mulmid_node(pc + pow, W, pb, left, pa, pow, mod);
+        }
+        else
+            _nmod_vec_set(pc, pb, left);
+    }
+
+    _nmod_vec_clear(W);
+}
+
+/*
+    Transposed remainder tree (Bostan, Lecerf and Schost). The node M of
+    the tree carries the first deg(M) coefficients of the expansion of
+    (P mod M) / M in 1/x, which for the children M1 and M2 of M = M1 M2 are
+    obtained by middle products with M2 and M1 respectively, without any
+    division. At a leaf x - a the single coefficient is P(a). The
+    coefficients are stored in reversed order.
+*/
+void
+_nmod_poly_multipoint_evaluate_transposed(mp_ptr ys, mp_srcptr poly,
+                                slong plen, const nmod_poly_multipoint_t M)
+{
+    multipoint_transposed_arg_t arg;
+    slong i, pow, len = M->len;
+    mp_ptr t, u, swap;
+    nmod_t mod = M->mod;
+
+    if (len < 2 || plen < 2)
+    {
+        _nmod_poly_evaluate_nmod_vec_fast_precomp(ys, poly, plen,
+                                                    M->tree, len, mod);
+        return;
+    }
+
+    t = _nmod_vec_init(len);
+    u = _nmod_vec_init(len);
+
+    if (plen > len)
+    {
+        if (plen <= 2 * len)
+        {
+            mp_ptr q = _nmod_vec_init(plen - len);
+            _nmod_poly_divrem_newton_n_preinv(q, u, poly, plen,
+                                    M->root, len + 1, M->root_inv, len, mod);
+            _nmod_vec_clear(q);
+        }
+        else
+            _nmod_poly_rem(u, poly, plen, M->root, len + 1, mod);
+
+        plen = len;
+    }
+    else
+    {
+        _nmod_vec_set(u, poly, plen);
+        _nmod_vec_zero(u + plen, len - plen);
+    }
+
+    /*
+        With P of length len and Q the product of all nodes, the expansion
+        of P / Q is the reversal of rev(P) rev(Q)^(-1) mod x^len, divided
+        by x, so t receives the expansion already in reversed order.
+    */
+    _nmod_poly_reverse(u, u, len, len);
+    _nmod_poly_mullow(t, M->root_inv, len, u, len, len, mod);
+    _nmod_poly_reverse(t, t, len, len);
+
+    for (i = FLINT_CLOG2(len) - 1; i >= 0; i--)
+    {
+        pow = WORD(1) << i;
+
+        arg.t = t;
+        arg.u = u;
+        arg.pa = M->tree[i];
+        arg.pow = pow;
+        arg.len = len;
+        arg.mod = mod;
+
+        _nmod_poly_tree_level_threaded(_nmod_poly_multipoint_transposed_level,
+                                &arg, (len + 2 * pow - 1) / (2 * pow), len);
+
+        swap = t;
+        t = u;
+        u = swap;
+    }
+
+    _nmod_vec_set(ys, t, len);
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
+
+void
+nmod_poly_multipoint_evaluate_transposed(mp_ptr ys, const nmod_poly_t poly,
+                                            const nmod_poly_multipoint_t M)
+{
+    _nmod_poly_multipoint_evaluate_transposed(ys, poly->coeffs,
+                                                        poly->length, M);
+}
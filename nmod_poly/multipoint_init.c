@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    mp_ptr inv;
+    mp_srcptr tree;
+    slong pow;
+    nmod_t mod;
+}
+multipoint_init_arg_t;
+
+/* inverts the reversals of the nodes start, ..., stop - 1 of a level */
+static void
+_nmod_poly_multipoint_init_level(void * arg_ptr, slong start, slong stop)
+{
+    multipoint_init_arg_t * arg = (multipoint_init_arg_t *) arg_ptr;
+    slong k, pow = arg->pow;
+    mp_ptr rev;
+
+    rev = _nmod_vec_init(pow + 1);
+
+    for (k = start; k < stop; k++)
+    {
+        _nmod_poly_reverse(rev, arg->tree + k * (pow + 1), pow + 1, pow + 1);
+        _nmod_poly_inv_series(arg->inv + k * (pow + 1),
+                                            rev, pow + 1, pow, arg->mod);
+    }
+
+    _nmod_vec_clear(rev);
+}
+
+void
+nmod_poly_multipoint_init(nmod_poly_multipoint_t M,
+                                    mp_srcptr xs, slong len, mp_limb_t n)
+{
+    multipoint_init_arg_t arg;
+    slong i, height, pow;
+    mp_ptr rev;
+
+    nmod_init(&M->mod, n);
+    M->len = len;
+
+    if (len == 0)
+    {
+        M->tree = NULL;
+        M->tree_inv = NULL;
+        M->root = NULL;
+        M->root_inv = NULL;
+        M->weights = NULL;
+        return;
+    }
+
+    height = FLINT_CLOG2(len);
+
+    M->tree = _nmod_poly_tree_alloc(len);
+    _nmod_poly_tree_build(M->tree, xs, len, M->mod);
+
+    /* the tree stops below the root */
+    M->root = _nmod_vec_init(len + 1);
+    if (len == 1)
+        _nmod_vec_set(M->root, M->tree[0], 2);
+    else
+    {
+        pow = WORD(1) << (height - 1);
+        _nmod_poly_mul(M->root, M->tree[height - 1], pow + 1,
+                        M->tree[height - 1] + (pow + 1), len - pow + 1, M->mod);
+    }
+
+    rev = _nmod_vec_init(len + 1);
+
+    M->root_inv = _nmod_vec_init(len);
+    _nmod_poly_reverse(rev, M->root, len + 1, len + 1);
+    _nmod_poly_inv_series(M->root_inv, rev, len + 1, len, M->mod);
+
+    /* inverses of the reversed nodes of full degree */
+    M->tree_inv = flint_malloc(sizeof(mp_ptr) * (height + 1));
+
+    for (i = 0; i <= height; i++)
+    {
+        pow = WORD(1) << i;
+
+        if (pow < NMOD_POLY_MULTIPOINT_PREINV_CUTOFF || i == height)
+        {
+            M->tree_inv[i] = NULL;
+            continue;
+        }
+
+        M->tree_inv[i] = _nmod_vec_init(len + (len >> i) + 1);
+
+        arg.inv = M->tree_inv[i];
+        arg.tree = M->tree[i];
+        arg.pow = pow;
+        arg.mod = M->mod;
+
+        _nmod_poly_tree_level_threaded(_nmod_poly_multipoint_init_level,
+                                                    &arg, len / pow, len);
+    }
+
+    /* weights 1 / Q'(x_i) for Q the product of all nodes */
+    M->weights = _nmod_vec_init(len);
+    if (len == 1)
+        M->weights[0] = 1;
+    else
+    {
+        _nmod_poly_derivative(rev, M->root, len + 1, M->mod);
+        _nmod_poly_multipoint_evaluate_transposed(M->weights, rev, len, M);
+
+        /* invert all weights with a single inversion */
+        rev[0] = M->weights[0];
+        for (i = 1; i < len; i++)
+            rev[i] = nmod_mul(rev[i - 1], M->weights[i], M->mod);
+
+        rev[len] = n_invmod(rev[len - 1], M->mod.n);
+
+        for (i = len - 1; i > 0; i--)
+        {
+            mp_limb_t t = nmod_mul(rev[len], rev[i - 1], M->mod);
+            rev[len] = nmod_mul(rev[len], M->weights[i], M->mod);
+            M->weights[i] = t;
+        }
+
+        M->weights[0] = rev[len];
+    }
+
+    _nmod_vec_clear(rev);
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_multipoint_interpolate(mp_ptr poly, mp_srcptr ys,
+                                            const nmod_poly_multipoint_t M)
+{
+    _nmod_poly_interpolate_nmod_vec_fast_precomp(poly, ys,
+                                    M->tree, M->weights, M->len, M->mod);
+}
+
+void
+nmod_poly_multipoint_interpolate(nmod_poly_t poly, mp_srcptr ys,
+                                            const nmod_poly_multipoint_t M)
+{
+    if (M->len == 0)
+    {
+        nmod_poly_zero(poly);
+    }
+    else
+    {
+        nmod_poly_fit_length(poly, M->len);
+        poly->length = M->len;
+        _nmod_poly_multipoint_interpolate(poly->coeffs, ys, M);
+        _nmod_poly_normalise(poly);
+    }
+}
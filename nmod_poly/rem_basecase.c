@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010, 2011 William Hart
     Copyright (C) 2011 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -124,6 +125,44 @@ void _nmod_poly_rem_basecase_3(mp_ptr R, mp_ptr W,
     }
 }
 
+/* as _nmod_poly_divrem_basecase_lazy, for n < 2^62 */
+void _nmod_poly_rem_basecase_lazy(mp_ptr R, mp_ptr W,
+                               mp_srcptr A, slong lenA, mp_srcptr B, slong lenB,
+                               nmod_t mod)
+{
+    const mp_limb_t invL = n_invmod(B[lenB - 1], mod.n);
+    const mp_limb_t n2 = 2 * mod.n;
+    slong iR, i;
+    mp_ptr R1 = W, Bpr = W + lenA;
+    mp_limb_t r, c, t;
+
+    flint_mpn_copyi(R1, A, lenA);
+
+    for (i = 0; i < lenB - 1; i++)
+        Bpr[i] = n_mulmod_precomp_shoup(B[i], mod.n);
+
+    for (iR = lenA - 1; iR >= lenB - 1; iR--)
+    {
+        r = R1[iR];
+        r -= (r >= mod.n) ? mod.n : 0;
+
+        if (r == 0)
+            continue;
+
+        c = mod.n - n_mulmod2_preinv(r, invL, mod.n, mod.ninv);
+
+        for (i = 0; i < lenB - 1; i++)
+        {
+            t = R1[iR - lenB + 1 + i] + n_mulmod_shoup_lazy(B[i], c,
+                                                            Bpr[i], mod.n);
+            R1[iR - lenB + 1 + i] = t - ((t >= n2) ? n2 : 0);
+        }
+    }
+
+    for (i = 0; i < lenB - 1; i++)
+        R[i] = (R1[i] >= mod.n) ? R1[i] - mod.n : R1[i];
+}
+
 void _nmod_poly_rem_basecase(mp_ptr R, mp_ptr W,
                              mp_srcptr A, slong lenA, mp_srcptr B, slong lenB,
                              nmod_t mod)
@@ -133,6 +172,8 @@ void _nmod_poly_rem_basecase(mp_ptr R, mp_ptr W,
 
     if (bits <= FLINT_BITS)
         _nmod_poly_rem_basecase_1(R, W, A, lenA, B, lenB, mod);
+    else if (mod.norm >= 2)
+        _nmod_poly_rem_basecase_lazy(R, W, A, lenA, B, lenB, mod);
     else if (bits <= 2 * FLINT_BITS)
         _nmod_poly_rem_basecase_2(R, W, A, lenA, B, lenB, mod);
     else
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+static int
+_limb_cmp(const void * a, const void * b)
+{
+    mp_limb_t x = *((const mp_limb_t *) a), y = *((const mp_limb_t *) b);
+    return (x > y) - (x < y);
+}
+
+/* a random prime, with a large power of two dividing n - 1 half the time */
+static mp_limb_t
+_random_prime(flint_rand_t state)
+{
+    mp_limb_t k, n;
+    slong e;
+
+    if (n_randint(state, 2))
+        return n_randtest_prime(state, 0);
+
+    e = n_randint(state, 16);
+
+    do {
+        k = n_randtest_bits(state, n_randint(state, FLINT_BITS - 2 - e) + 1);
+        n = (k << e) + 1;
+    } while (!n_is_prime(n));
+
+    return n;
+}
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("interp_evaluate....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_interp_t S;
+        nmod_poly_t P;
+        mp_ptr xs, ys;
+        mp_limb_t n;
+        slong i, len, num;
+
+        n = _random_prime(state);
+        len = n_randint(state, 300);
+
+        if (!nmod_poly_interp_init(S, len, n))
+        {
+            if (len <= n)
+            {
+                flint_printf("FAIL (init): n = %wu, len = %wd\n", n, len);
+                abort();
+            }
+
+            nmod_poly_interp_clear(S);
+            continue;
+        }
+
+        num = nmod_poly_interp_num_points(S);
+
+        if (num < len)
+        {
+            flint_printf("FAIL (num_points): n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        nmod_poly_init(P, n);
+        xs = _nmod_vec_init(num);
+        ys = _nmod_vec_init(num);
+
+        nmod_poly_randtest(P, state, n_randint(state, 2 * num + 1));
+        nmod_poly_interp_points(xs, S);
+        nmod_poly_interp_evaluate(ys, P, S);
+
+        for (i = 0; i < num; i++)
+        {
+            if (ys[i] != nmod_poly_evaluate_nmod(P, xs[i]))
+            {
+                flint_printf("FAIL: n = %wu, len = %wd, i = %wd\n",
+                                                                n, len, i);
+                abort();
+            }
+        }
+
+        /* the points are distinct */
+        qsort(xs, num, sizeof(mp_limb_t), _limb_cmp);
+        for (i = 1; i < num; i++)
+        {
+            if (xs[i] == xs[i - 1])
+            {
+                flint_printf("FAIL (points): n = %wu, len = %wd\n", n, len);
+                abort();
+            }
+        }
+
+        nmod_poly_clear(P);
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+        nmod_poly_interp_clear(S);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("multipoint_interpolate....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_multipoint_t M;
+        nmod_poly_t P, Q;
+        mp_ptr x, y;
+        mp_limb_t mod;
+        slong j, k, n, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        npoints = n_randint(state, (i % 20 == 0) ? 1500 : 100);
+        npoints = FLINT_MIN(npoints, mod);
+        n = n_randint(state, npoints + 1);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        nmod_poly_init(P, mod);
+        nmod_poly_init(Q, mod);
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+
+        nmod_poly_randtest(P, state, n);
+
+        for (j = 0; j < npoints; j++)
+        {
+            do
+            {
+                x[j] = n_randint(state, mod);
+                for (k = 0; k < j && x[k] != x[j]; k++) ;
+            } while (k < j);
+        }
+
+        nmod_poly_multipoint_init(M, x, npoints, mod);
+
+        nmod_poly_evaluate_nmod_vec_iter(y, P, x, npoints);
+        nmod_poly_multipoint_interpolate(Q, y, M);
+
+        result = nmod_poly_equal(P, Q);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("mod=%wu, n=%wd, npoints=%wd\n\n", mod, n, npoints);
+            flint_printf("P: "); nmod_poly_print(P); flint_printf("\n\n");
+            flint_printf("Q: "); nmod_poly_print(Q); flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_multipoint_clear(M);
+        nmod_poly_clear(P);
+        nmod_poly_clear(Q);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
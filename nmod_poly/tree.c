@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -44,11 +45,46 @@ void _nmod_poly_tree_free(mp_ptr * tree, slong len)
     }
 }
 
+typedef struct
+{
+    mp_srcptr pa;
+    mp_ptr pb;
+    slong pow;
+    slong len;
+    nmod_t mod;
+}
+tree_build_arg_t;
+
+/* multiplies the pairs of nodes start, ..., stop - 1 of a level */
+static void
+_nmod_poly_tree_build_level(void * arg_ptr, slong start, slong stop)
+{
+    tree_build_arg_t * arg = (tree_build_arg_t *) arg_ptr;
+    slong k, left, pow = arg->pow;
+    mp_srcptr pa;
+    mp_ptr pb;
+
+    for (k = start; k < stop; k++)
+    {
+        left = arg->len - 2 * pow * k;
+        pa = arg->pa + (2 * pow + 2) * k;
+        pb = arg->pb + (2 * pow + 1) * k;
+
+        if (left >= 2 * pow)
+            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, arg->mod);
+        else if (left > pow)
+            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1,
+                                                    left - pow + 1, arg->mod);
+        else
+            _nmod_vec_set(pb, pa, left + 1);
+    }
+}
+
 void
 _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
 {
-    slong height, pow, left, i;
-    mp_ptr pa, pb;
+    slong height, pow, i;
+    mp_ptr pa;
 
     if (len == 0)
         return;
@@ -88,22 +124,16 @@ _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
 
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
-        pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
-
-        while (left >= 2 * pow)
-        {
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, mod);
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow + 1;
-        }
+        tree_build_arg_t arg;
 
-        if (left > pow)
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, mod);
-        else if (left > 0)
-            _nmod_vec_set(pb, pa, left + 1);
+        pow = WORD(1) << i;
+        arg.pa = tree[i];
+        arg.pb = tree[i + 1];
+        arg.pow = pow;
+        arg.len = len;
+        arg.mod = mod;
+
+        _nmod_poly_tree_level_threaded(_nmod_poly_tree_build_level, &arg,
+                                            (len + 2 * pow - 1) / (2 * pow), len);
     }
 }
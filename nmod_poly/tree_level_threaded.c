@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    void (* fn)(void *, slong, slong);
+    void * arg;
+    slong start;
+    slong stop;
+}
+tree_level_arg_t;
+
+static void *
+_nmod_poly_tree_level_worker(void * arg_ptr)
+{
+    tree_level_arg_t * arg = (tree_level_arg_t *) arg_ptr;
+
+    arg->fn(arg->arg, arg->start, arg->stop);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_nmod_poly_tree_level_threaded(void (* fn)(void *, slong, slong),
+                                        void * arg, slong num, slong len)
+{
+    pthread_t * threads;
+    tree_level_arg_t * args;
+    slong k, num_threads;
+
+    num_threads = flint_get_num_threads();
+
+    if (len < NMOD_POLY_TREE_THREAD_CUTOFF)
+        num_threads = 1;
+
+    num_threads = FLINT_MIN(num_threads, num);
+
+    if (num_threads <= 1)
+    {
+        fn(arg, 0, num);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(tree_level_arg_t) * num_threads);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        args[k].fn = fn;
+        args[k].arg = arg;
+        args[k].start = (k * num) / num_threads;
+        args[k].stop = ((k + 1) * num) / num_threads;
+    }
+
+    for (k = 0; k < num_threads - 1; k++)
+        pthread_create(&threads[k], NULL,
+            _nmod_poly_tree_level_worker, &args[k]);
+
+    args[num_threads - 1].fn(args[num_threads - 1].arg,
+        args[num_threads - 1].start, args[num_threads - 1].stop);
+
+    for (k = 0; k < num_threads - 1; k++)
+        pthread_join(threads[k], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
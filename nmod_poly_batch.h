@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef NMOD_POLY_BATCH_H
+#define NMOD_POLY_BATCH_H
+
+#ifdef NMOD_POLY_BATCH_INLINES_C
+#define NMOD_POLY_BATCH_INLINE FLINT_DLL
+#else
+#define NMOD_POLY_BATCH_INLINE static __inline__
+#endif
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    A batch of num polynomials over Z/nZ stored coefficient-major: the
+    coefficient of x^i of polynomial j is coeffs[i * num + j], so that the
+    same coefficient of all polynomials is contiguous. Each polynomial has
+    room for alloc coefficients, and the coefficients beyond its length
+    are always zero.
+*/
+typedef struct
+{
+    mp_ptr coeffs;
+    slong * length;
+    slong num;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_poly_batch_struct;
+
+typedef nmod_poly_batch_struct nmod_poly_batch_t[1];
+
+/* Memory management  ********************************************************/
+
+FLINT_DLL void nmod_poly_batch_init(nmod_poly_batch_t B, slong num,
+                                                    slong alloc, mp_limb_t n);
+
+FLINT_DLL void nmod_poly_batch_clear(nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_fit_length(nmod_poly_batch_t B, slong len);
+
+FLINT_DLL void nmod_poly_batch_swap(nmod_poly_batch_t B1, nmod_poly_batch_t B2);
+
+FLINT_DLL void nmod_poly_batch_set(nmod_poly_batch_t B1,
+                                                const nmod_poly_batch_t B2);
+
+FLINT_DLL void nmod_poly_batch_zero(nmod_poly_batch_t B);
+
+FLINT_DLL void _nmod_poly_batch_normalise(nmod_poly_batch_t B, slong len);
+
+/* Basic properties and conversions  *****************************************/
+
+NMOD_POLY_BATCH_INLINE
+slong nmod_poly_batch_num(const nmod_poly_batch_t B)
+{
+    return B->num;
+}
+
+NMOD_POLY_BATCH_INLINE
+slong nmod_poly_batch_length(const nmod_poly_batch_t B, slong j)
+{
+    return B->length[j];
+}
+
+NMOD_POLY_BATCH_INLINE
+mp_limb_t nmod_poly_batch_get_coeff_ui(const nmod_poly_batch_t B,
+                                                            slong j, slong i)
+{
+    return (i < B->length[j]) ? B->coeffs[i * B->num + j] : UWORD(0);
+}
+
+FLINT_DLL slong nmod_poly_batch_max_length(const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_set_nmod_poly(nmod_poly_batch_t B, slong j,
+                                                        const nmod_poly_t poly);
+
+FLINT_DLL void nmod_poly_batch_get_nmod_poly(nmod_poly_t poly,
+                                            const nmod_poly_batch_t B, slong j);
+
+FLINT_DLL void nmod_poly_batch_randtest(nmod_poly_batch_t B,
+                                            flint_rand_t state, slong len);
+
+FLINT_DLL void nmod_poly_batch_randtest_monic(nmod_poly_batch_t B,
+                                            flint_rand_t state, slong len);
+
+/* Kernels on coefficient rows  **********************************************/
+
+FLINT_DLL void _nmod_poly_batch_addmul_lanes(mp_ptr W, mp_srcptr a,
+                                                    mp_srcptr b, slong len);
+
+#if NMOD_VEC_HAVE_SIMD
+FLINT_DLL void _nmod_poly_batch_addmul_lanes_avx2(mp_ptr W, mp_srcptr a,
+                                                    mp_srcptr b, slong len);
+#endif
+
+FLINT_DLL void _nmod_poly_batch_inv_lanes(mp_ptr res, mp_srcptr a,
+                                                    slong len, nmod_t mod);
+
+/* Arithmetic  ***************************************************************/
+
+FLINT_DLL void _nmod_poly_batch_mul(mp_ptr C, mp_srcptr A, slong lenA,
+                        mp_srcptr B, slong lenB, slong num, nmod_t mod);
+
+FLINT_DLL void nmod_poly_batch_mul(nmod_poly_batch_t C,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void _nmod_poly_batch_divrem(mp_ptr Q, mp_ptr R, mp_srcptr A,
+        slong lenA, mp_srcptr B, slong lenB, slong num, nmod_t mod);
+
+FLINT_DLL void nmod_poly_batch_divrem(nmod_poly_batch_t Q,
+    nmod_poly_batch_t R, const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_rem(nmod_poly_batch_t R,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+FLINT_DLL void nmod_poly_batch_mulmod(nmod_poly_batch_t C,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B,
+                        const nmod_poly_batch_t F);
+
+/* Evaluation  ***************************************************************/
+
+FLINT_DLL void nmod_poly_batch_evaluate_nmod_vec(mp_ptr ys,
+                                    const nmod_poly_batch_t A, mp_srcptr xs);
+
+/* Greatest common divisor  **************************************************/
+
+FLINT_DLL void nmod_poly_batch_gcd(nmod_poly_batch_t G,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B);
+
+/* Tuning  *******************************************************************/
+
+/* number of polynomials processed together by the arithmetic kernels */
+#define NMOD_POLY_BATCH_BLOCK 64
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
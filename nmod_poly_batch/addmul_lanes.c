@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Sets W[j] += a[j] b[j] for 0 <= j < len, without reduction. The entries
+    of a and b must be less than 2^32 and the sums must fit in a limb.
+*/
+void
+_nmod_poly_batch_addmul_lanes(mp_ptr W, mp_srcptr a, mp_srcptr b, slong len)
+{
+    slong j;
+
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= 8 && nmod_vec_simd_level() >= NMOD_VEC_SIMD_AVX2)
+    {
+        _nmod_poly_batch_addmul_lanes_avx2(W, a, b, len);
+        return;
+    }
+#endif
+
+    for (j = 0; j < len; j++)
+        W[j] += a[j] * b[j];
+}
@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+/* As _nmod_poly_batch_addmul_lanes, four lanes at a time. */
+__attribute__((target("avx2")))
+void
+_nmod_poly_batch_addmul_lanes_avx2(mp_ptr W, mp_srcptr a,
+                                                mp_srcptr b, slong len)
+{
+    __m256i x0, x1, y0, y1, w0, w1;
+    slong j;
+
+    for (j = 0; j + 8 <= len; j += 8)
+    {
+        x0 = _mm256_loadu_si256((const __m256i *) (a + j));
+        x1 = _mm256_loadu_si256((const __m256i *) (a + j + 4));
+        y0 = _mm256_loadu_si256((const __m256i *) (b + j));
+        y1 = _mm256_loadu_si256((const __m256i *) (b + j + 4));
+        w0 = _mm256_loadu_si256((const __m256i *) (W + j));
+        w1 = _mm256_loadu_si256((const __m256i *) (W + j + 4));
+        w0 = _mm256_add_epi64(w0, _mm256_mul_epu32(x0, y0));
+        w1 = _mm256_add_epi64(w1, _mm256_mul_epu32(x1, y1));
+        _mm256_storeu_si256((__m256i *) (W + j), w0);
+        _mm256_storeu_si256((__m256i *) (W + j + 4), w1);
+    }
+
+    for ( ; j < len; j++)
+        W[j] += a[j] * b[j];
+}
+
+#endif
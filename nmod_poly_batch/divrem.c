@@ -0,0 +1,218 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Schoolbook division of a block of blk lanes starting at lane j0 when
+    all sums of products fit in a limb. The remainder is kept unreduced in
+    W, to which the products of the quotient coefficients with the negated
+    divisor are added; a coefficient is only reduced once it becomes the
+    leading one.
+*/
+static void
+_nmod_poly_batch_divrem_block(mp_ptr Q, mp_ptr R, mp_ptr W, mp_srcptr A,
+    slong lenA, mp_srcptr B, slong lenB, slong num, slong j0, slong blk,
+    nmod_t mod)
+{
+    mp_ptr linv, negB, q;
+    slong i, j, k;
+    mp_limb_t r;
+
+    linv = _nmod_vec_init(blk * (lenB + 1));
+    q = linv + blk;
+    negB = q + blk;
+
+    _nmod_poly_batch_inv_lanes(linv, B + (lenB - 1) * num + j0, blk, mod);
+
+    for (k = 0; k < lenB - 1; k++)
+        for (j = 0; j < blk; j++)
+            negB[k * blk + j] = nmod_neg(B[k * num + j0 + j], mod);
+
+    for (i = 0; i < lenA; i++)
+        for (j = 0; j < blk; j++)
+            W[i * blk + j] = A[i * num + j0 + j];
+
+    for (i = lenA - 1; i >= lenB - 1; i--)
+    {
+        for (j = 0; j < blk; j++)
+        {
+            NMOD_RED(r, W[i * blk + j], mod);
+            q[j] = n_mulmod2_preinv(r, linv[j], mod.n, mod.ninv);
+        }
+
+        if (Q != NULL)
+            for (j = 0; j < blk; j++)
+                Q[(i - lenB + 1) * num + j0 + j] = q[j];
+
+        for (k = 0; k < lenB - 1; k++)
+            _nmod_poly_batch_addmul_lanes(W + (i - lenB + 1 + k) * blk,
+                                                    q, negB + k * blk, blk);
+    }
+
+    for (i = 0; i < lenB - 1; i++)
+        for (j = 0; j < blk; j++)
+            NMOD_RED(R[i * num + j0 + j], W[i * blk + j], mod);
+
+    _nmod_vec_clear(linv);
+}
+
+/* divides lane j by gathering its coefficients */
+static void
+_nmod_poly_batch_divrem_lane(mp_ptr Q, mp_ptr R, mp_ptr t, mp_srcptr A,
+    slong lenA, mp_srcptr B, slong lenB, slong num, slong j, nmod_t mod)
+{
+    slong i, la, lenQ = lenA - lenB + 1;
+    mp_ptr a = t, b = t + lenA, q = b + lenB, r = q + lenQ;
+
+    for (la = lenA; la > 0 && A[(la - 1) * num + j] == 0; la--) ;
+
+    for (i = 0; i < la; i++)
+        a[i] = A[i * num + j];
+    for (i = 0; i < lenB; i++)
+        b[i] = B[i * num + j];
+
+    if (la < lenB)
+    {
+        _nmod_vec_zero(q, lenQ);
+        _nmod_vec_zero(a + la, lenB - 1 - la);
+        _nmod_vec_set(r, a, lenB - 1);
+    }
+    else
+    {
+        _nmod_poly_divrem(q, r, a, la, b, lenB, mod);
+        _nmod_vec_zero(q + la - lenB + 1, lenA - la);
+    }
+
+    if (Q != NULL)
+        for (i = 0; i < lenQ; i++)
+            Q[i * num + j] = q[i];
+
+    for (i = 0; i < lenB - 1; i++)
+        R[i * num + j] = r[i];
+}
+
+/*
+    Divides the polynomials in the rows (A, lenA) by those in (B, lenB),
+    all with num lanes, where lenA >= lenB >= 1 and the leading
+    coefficients in row lenB - 1 of B are all invertible. Sets the rows
+    (Q, lenA - lenB + 1), unless Q is NULL, and (R, lenB - 1). The outputs
+    must not overlap the inputs.
+*/
+void
+_nmod_poly_batch_divrem(mp_ptr Q, mp_ptr R, mp_srcptr A, slong lenA,
+                    mp_srcptr B, slong lenB, slong num, nmod_t mod)
+{
+    slong j, blk, lenQ = lenA - lenB + 1;
+    mp_ptr t;
+
+    if (_nmod_vec_dot_bound_limbs(FLINT_MIN(lenQ, lenB - 1) + 1, mod) == 1)
+    {
+        t = _nmod_vec_init(lenA * NMOD_POLY_BATCH_BLOCK);
+
+        for (j = 0; j < num; j += NMOD_POLY_BATCH_BLOCK)
+        {
+            blk = FLINT_MIN(NMOD_POLY_BATCH_BLOCK, num - j);
+            _nmod_poly_batch_divrem_block(Q, R, t, A, lenA, B, lenB,
+                                                        num, j, blk, mod);
+        }
+    }
+    else
+    {
+        t = _nmod_vec_init(2 * lenA + lenB);
+
+        for (j = 0; j < num; j++)
+            _nmod_poly_batch_divrem_lane(Q, R, t, A, lenA, B, lenB,
+                                                            num, j, mod);
+    }
+
+    _nmod_vec_clear(t);
+}
+
+/* returns the common length of the divisors, raising if there is none */
+static slong
+_nmod_poly_batch_divisor_length(const nmod_poly_batch_t B, const char * fn)
+{
+    slong j, lenB = (B->num == 0) ? 1 : B->length[0];
+
+    for (j = 0; j < B->num; j++)
+    {
+        if (B->length[j] != lenB || lenB == 0)
+        {
+            flint_printf("Exception (%s). Divisors must be nonzero and "
+                                                "of equal length.\n", fn);
+            flint_abort();
+        }
+    }
+
+    return lenB;
+}
+
+static void
+_nmod_poly_batch_divrem_set(nmod_poly_batch_t Q, nmod_poly_batch_t R,
+                const nmod_poly_batch_t A, const nmod_poly_batch_t B,
+                const char * fn)
+{
+    slong lenA, lenB, lenQ, num = A->num;
+    mp_ptr q, r;
+
+    lenB = _nmod_poly_batch_divisor_length(B, fn);
+    lenA = nmod_poly_batch_max_length(A);
+
+    if (lenA < lenB)
+    {
+        if (R != A)
+            nmod_poly_batch_set(R, A);
+        if (Q != NULL)
+            nmod_poly_batch_zero(Q);
+        return;
+    }
+
+    lenQ = lenA - lenB + 1;
+    q = (Q != NULL) ? _nmod_vec_init(lenQ * num) : NULL;
+    r = _nmod_vec_init((lenB - 1) * num);
+
+    _nmod_poly_batch_divrem(q, r, A->coeffs, lenA,
+                                    B->coeffs, lenB, num, A->mod);
+
+    if (Q != NULL)
+    {
+        nmod_poly_batch_zero(Q);
+        nmod_poly_batch_fit_length(Q, lenQ);
+        flint_mpn_copyi(Q->coeffs, q, lenQ * num);
+        _nmod_poly_batch_normalise(Q, lenQ);
+        _nmod_vec_clear(q);
+    }
+
+    nmod_poly_batch_zero(R);
+    nmod_poly_batch_fit_length(R, lenB - 1);
+    flint_mpn_copyi(R->coeffs, r, (lenB - 1) * num);
+    _nmod_poly_batch_normalise(R, lenB - 1);
+    _nmod_vec_clear(r);
+}
+
+void
+nmod_poly_batch_divrem(nmod_poly_batch_t Q, nmod_poly_batch_t R,
+                const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    _nmod_poly_batch_divrem_set(Q, R, A, B, "nmod_poly_batch_divrem");
+}
+
+void
+nmod_poly_batch_rem(nmod_poly_batch_t R,
+                const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    _nmod_poly_batch_divrem_set(NULL, R, A, B, "nmod_poly_batch_rem");
+}
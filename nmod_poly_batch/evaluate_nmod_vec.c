@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Horner's rule run on all lanes at once. For moduli of at most half a
+    limb, acc * x + c fits in a limb and needs a single reduction.
+*/
+void
+nmod_poly_batch_evaluate_nmod_vec(mp_ptr ys,
+                                    const nmod_poly_batch_t A, mp_srcptr xs)
+{
+    slong i, j, len, num = A->num;
+    mp_srcptr c;
+    nmod_t mod = A->mod;
+
+    len = nmod_poly_batch_max_length(A);
+
+    for (j = 0; j < num; j++)
+        ys[j] = 0;
+
+    if (mod.norm >= FLINT_BITS / 2)
+    {
+        for (i = len - 1; i >= 0; i--)
+        {
+            c = A->coeffs + i * num;
+            for (j = 0; j < num; j++)
+                NMOD_RED(ys[j], ys[j] * xs[j] + c[j], mod);
+        }
+    }
+    else
+    {
+        for (i = len - 1; i >= 0; i--)
+        {
+            c = A->coeffs + i * num;
+            for (j = 0; j < num; j++)
+                ys[j] = nmod_add(n_mulmod2_preinv(ys[j], xs[j],
+                                            mod.n, mod.ninv), c[j], mod);
+        }
+    }
+}
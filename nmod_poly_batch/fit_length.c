@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_fit_length(nmod_poly_batch_t B, slong len)
+{
+    if (len > B->alloc && B->num != 0)
+    {
+        /* coefficient-major storage grows by whole rows */
+        len = FLINT_MAX(len, 2 * B->alloc);
+
+        B->coeffs = flint_realloc(B->coeffs,
+                                    B->num * len * sizeof(mp_limb_t));
+        flint_mpn_zero(B->coeffs + B->num * B->alloc,
+                                        B->num * (len - B->alloc));
+        B->alloc = len;
+    }
+}
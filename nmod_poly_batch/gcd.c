@@ -0,0 +1,180 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Sets (g, return value) to the monic gcd of the polynomials of lengths
+    la and lb in lane j of the rows A and B, which have num lanes. The
+    buffer t needs room for la + lb coefficients.
+*/
+static slong
+_nmod_poly_batch_gcd_lane(mp_ptr g, mp_ptr t, mp_srcptr A, slong la,
+                        mp_srcptr B, slong lb, slong num, slong j, nmod_t mod)
+{
+    mp_ptr a = t, b = t + la;
+    slong i, lg;
+
+    for ( ; la > 0 && A[(la - 1) * num + j] == 0; la--) ;
+    for ( ; lb > 0 && B[(lb - 1) * num + j] == 0; lb--) ;
+
+    for (i = 0; i < la; i++)
+        a[i] = A[i * num + j];
+    for (i = 0; i < lb; i++)
+        b[i] = B[i * num + j];
+
+    if (la == 0 && lb == 0)
+        return 0;
+
+    if (lb == 0)
+    {
+        _nmod_poly_make_monic(g, a, la, mod);
+        return la;
+    }
+
+    if (la == 0)
+    {
+        _nmod_poly_make_monic(g, b, lb, mod);
+        return lb;
+    }
+
+    if (la >= lb)
+        lg = _nmod_poly_gcd(g, a, la, b, lb, mod);
+    else
+        lg = _nmod_poly_gcd(g, b, lb, a, la, mod);
+
+    _nmod_poly_make_monic(g, g, lg, mod);
+
+    return lg;
+}
+
+/*
+    Runs the Euclidean algorithm on all lanes in lockstep. For generic
+    inputs every division step lowers the degree by exactly one, so all
+    lanes share the same degree sequence and each step is a batched
+    division by the vector of leading coefficients. A lane whose remainder
+    degree drops further leaves the lockstep and is finished on its own;
+    its place is kept by a dummy remainder with leading coefficient one.
+*/
+void
+nmod_poly_batch_gcd(nmod_poly_batch_t G,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    const nmod_poly_batch_struct * X, * Y;
+    mp_ptr a, b, r, g, t, s, w;
+    slong i, j, la, lb, lg, num = A->num;
+    slong * glen;
+    char * active;
+    nmod_t mod = A->mod;
+
+    if (nmod_poly_batch_max_length(A) >= nmod_poly_batch_max_length(B))
+        X = A, Y = B;
+    else
+        X = B, Y = A;
+
+    la = nmod_poly_batch_max_length(X);
+    lb = nmod_poly_batch_max_length(Y);
+
+    if (la == 0)
+    {
+        nmod_poly_batch_zero(G);
+        return;
+    }
+
+    /* a lane of Y may be zero, in which case its gcd has length up to la */
+    lg = la;
+
+    w = _nmod_vec_init((la + 2 * lb + lg) * num + 2 * (la + lb));
+    a = w;
+    b = a + la * num;
+    r = b + lb * num;
+    g = r + lb * num;
+    t = g + lg * num;
+
+    glen = flint_malloc(sizeof(slong) * num);
+    active = flint_malloc(num);
+
+    flint_mpn_copyi(a, X->coeffs, la * num);
+    flint_mpn_copyi(b, Y->coeffs, lb * num);
+    flint_mpn_zero(g, lg * num);
+
+    for (j = 0; j < num; j++)
+    {
+        active[j] = (lb > 0 && X->length[j] == la && Y->length[j] == lb);
+
+        if (!active[j])
+        {
+            glen[j] = _nmod_poly_batch_gcd_lane(t, t + la + lb,
+                    X->coeffs, X->length[j], Y->coeffs, Y->length[j],
+                    num, j, mod);
+
+            for (i = 0; i < glen[j]; i++)
+                g[i * num + j] = t[i];
+
+            for (i = 0; i < lb; i++)
+                b[i * num + j] = (i == lb - 1);
+        }
+    }
+
+    while (lb > 1)
+    {
+        _nmod_poly_batch_divrem(NULL, r, a, la, b, lb, num, mod);
+
+        for (j = 0; j < num; j++)
+        {
+            if (active[j] && r[(lb - 2) * num + j] == 0)
+            {
+                glen[j] = _nmod_poly_batch_gcd_lane(t, t + 2 * lb - 1,
+                                        b, lb, r, lb - 1, num, j, mod);
+
+                for (i = 0; i < glen[j]; i++)
+                    g[i * num + j] = t[i];
+
+                active[j] = 0;
+            }
+
+            if (!active[j])
+                r[(lb - 2) * num + j] = 1;
+        }
+
+        s = a;
+        a = b;
+        b = r;
+        r = s;
+        la = lb;
+        lb--;
+    }
+
+    /* the surviving lanes end with a nonzero constant */
+    for (j = 0; j < num; j++)
+    {
+        if (active[j])
+        {
+            g[j] = 1;
+            glen[j] = 1;
+        }
+    }
+
+    nmod_poly_batch_zero(G);
+    nmod_poly_batch_fit_length(G, lg);
+    flint_mpn_copyi(G->coeffs, g, lg * num);
+    for (j = 0; j < num; j++)
+        G->length[j] = glen[j];
+
+    _nmod_vec_clear(w);
+    flint_free(glen);
+    flint_free(active);
+}
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_get_nmod_poly(nmod_poly_t poly,
+                                        const nmod_poly_batch_t B, slong j)
+{
+    slong i, len = B->length[j], num = B->num;
+
+    nmod_poly_fit_length(poly, len);
+
+    for (i = 0; i < len; i++)
+        poly->coeffs[i] = B->coeffs[i * num + j];
+
+    _nmod_poly_set_length(poly, len);
+}
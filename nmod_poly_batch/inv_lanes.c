@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Sets res[j] to the inverse of a[j] for 0 <= j < len, using a single
+    modular inversion. The entries of a must be invertible. Aliasing is
+    allowed.
+*/
+void
+_nmod_poly_batch_inv_lanes(mp_ptr res, mp_srcptr a, slong len, nmod_t mod)
+{
+    mp_ptr t;
+    mp_limb_t s, u;
+    slong j;
+
+    if (len == 0)
+        return;
+
+    t = _nmod_vec_init(len);
+
+    t[0] = a[0];
+    for (j = 1; j < len; j++)
+        t[j] = n_mulmod2_preinv(t[j - 1], a[j], mod.n, mod.ninv);
+
+    s = n_invmod(t[len - 1], mod.n);
+
+    for (j = len - 1; j > 0; j--)
+    {
+        u = n_mulmod2_preinv(s, t[j - 1], mod.n, mod.ninv);
+        s = n_mulmod2_preinv(s, a[j], mod.n, mod.ninv);
+        res[j] = u;
+    }
+
+    res[0] = s;
+
+    _nmod_vec_clear(t);
+}
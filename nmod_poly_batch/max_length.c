@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+slong
+nmod_poly_batch_max_length(const nmod_poly_batch_t B)
+{
+    slong j, len = 0;
+
+    for (j = 0; j < B->num; j++)
+        len = FLINT_MAX(len, B->length[j]);
+
+    return len;
+}
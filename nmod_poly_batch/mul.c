@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Multiplies the polynomials of a block of blk lanes starting at lane j0
+    when all sums of products fit in a limb: the products are accumulated
+    without reduction in W, which has room for lenA + lenB - 1 rows of blk
+    entries.
+*/
+static void
+_nmod_poly_batch_mul_block(mp_ptr C, mp_ptr W, mp_srcptr A, slong lenA,
+    mp_srcptr B, slong lenB, slong num, slong j0, slong blk, nmod_t mod)
+{
+    slong i, k, j, lenC = lenA + lenB - 1;
+
+    flint_mpn_zero(W, lenC * blk);
+
+    for (i = 0; i < lenA; i++)
+        for (k = 0; k < lenB; k++)
+            _nmod_poly_batch_addmul_lanes(W + (i + k) * blk,
+                            A + i * num + j0, B + k * num + j0, blk);
+
+    for (i = 0; i < lenC; i++)
+        for (j = 0; j < blk; j++)
+            NMOD_RED(C[i * num + j0 + j], W[i * blk + j], mod);
+}
+
+/* multiplies lane j by gathering its coefficients */
+static void
+_nmod_poly_batch_mul_lane(mp_ptr C, mp_ptr t, mp_srcptr A, slong lenA,
+                    mp_srcptr B, slong lenB, slong num, slong j, nmod_t mod)
+{
+    slong i, la, lb, lenC = lenA + lenB - 1;
+    mp_ptr a = t, b = t + lenA, c = t + lenA + lenB;
+
+    for (la = lenA; la > 0 && A[(la - 1) * num + j] == 0; la--) ;
+    for (lb = lenB; lb > 0 && B[(lb - 1) * num + j] == 0; lb--) ;
+
+    for (i = 0; i < lenC; i++)
+        C[i * num + j] = 0;
+
+    if (la == 0 || lb == 0)
+        return;
+
+    for (i = 0; i < la; i++)
+        a[i] = A[i * num + j];
+    for (i = 0; i < lb; i++)
+        b[i] = B[i * num + j];
+
+    if (la >= lb)
+        _nmod_poly_mul(c, a, la, b, lb, mod);
+    else
+        _nmod_poly_mul(c, b, lb, a, la, mod);
+
+    for (i = 0; i < la + lb - 1; i++)
+        C[i * num + j] = c[i];
+}
+
+/*
+    Sets the rows (C, lenA + lenB - 1) to the products of the polynomials
+    in the rows (A, lenA) and (B, lenB), all with num lanes. The output
+    must not overlap the inputs.
+*/
+void
+_nmod_poly_batch_mul(mp_ptr C, mp_srcptr A, slong lenA,
+                        mp_srcptr B, slong lenB, slong num, nmod_t mod)
+{
+    slong j, blk;
+    mp_ptr t;
+
+    if (_nmod_vec_dot_bound_limbs(FLINT_MIN(lenA, lenB), mod) == 1)
+    {
+        t = _nmod_vec_init((lenA + lenB - 1) * NMOD_POLY_BATCH_BLOCK);
+
+        for (j = 0; j < num; j += NMOD_POLY_BATCH_BLOCK)
+        {
+            blk = FLINT_MIN(NMOD_POLY_BATCH_BLOCK, num - j);
+            _nmod_poly_batch_mul_block(C, t, A, lenA, B, lenB,
+                                                        num, j, blk, mod);
+        }
+    }
+    else
+    {
+        t = _nmod_vec_init(2 * (lenA + lenB));
+
+        for (j = 0; j < num; j++)
+            _nmod_poly_batch_mul_lane(C, t, A, lenA, B, lenB, num, j, mod);
+    }
+
+    _nmod_vec_clear(t);
+}
+
+void
+nmod_poly_batch_mul(nmod_poly_batch_t C,
+                        const nmod_poly_batch_t A, const nmod_poly_batch_t B)
+{
+    slong lenA, lenB, lenC;
+
+    lenA = nmod_poly_batch_max_length(A);
+    lenB = nmod_poly_batch_max_length(B);
+
+    if (lenA == 0 || lenB == 0)
+    {
+        nmod_poly_batch_zero(C);
+        return;
+    }
+
+    lenC = lenA + lenB - 1;
+
+    if (C == A || C == B)
+    {
+        nmod_poly_batch_t T;
+        nmod_poly_batch_init(T, A->num, lenC, A->mod.n);
+        nmod_poly_batch_mul(T, A, B);
+        nmod_poly_batch_swap(C, T);
+        nmod_poly_batch_clear(T);
+        return;
+    }
+
+    nmod_poly_batch_zero(C);
+    nmod_poly_batch_fit_length(C, lenC);
+
+    _nmod_poly_batch_mul(C->coeffs, A->coeffs, lenA,
+                                B->coeffs, lenB, A->num, A->mod);
+
+    _nmod_poly_batch_normalise(C, lenC);
+}
@@ -0,0 +1,66 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_mulmod(nmod_poly_batch_t C, const nmod_poly_batch_t A,
+                    const nmod_poly_batch_t B, const nmod_poly_batch_t F)
+{
+    slong j, lenA, lenB, lenF, lenT, lenR, num = A->num;
+    mp_ptr t, r;
+
+    lenF = (F->num == 0) ? 1 : F->length[0];
+
+    for (j = 0; j < F->num; j++)
+    {
+        if (F->length[j] != lenF || lenF == 0)
+        {
+            flint_printf("Exception (nmod_poly_batch_mulmod). Moduli must "
+                                        "be nonzero and of equal length.\n");
+            flint_abort();
+        }
+    }
+
+    lenA = nmod_poly_batch_max_length(A);
+    lenB = nmod_poly_batch_max_length(B);
+
+    if (lenA == 0 || lenB == 0 || lenF == 1)
+    {
+        nmod_poly_batch_zero(C);
+        return;
+    }
+
+    lenT = lenA + lenB - 1;
+    lenR = FLINT_MIN(lenT, lenF - 1);
+
+    t = _nmod_vec_init(lenT * num + lenR * num);
+    r = t + lenT * num;
+
+    _nmod_poly_batch_mul(t, A->coeffs, lenA, B->coeffs, lenB, num, A->mod);
+
+    if (lenT >= lenF)
+        _nmod_poly_batch_divrem(NULL, r, t, lenT,
+                                        F->coeffs, lenF, num, A->mod);
+    else
+        flint_mpn_copyi(r, t, lenT * num);
+
+    nmod_poly_batch_zero(C);
+    nmod_poly_batch_fit_length(C, lenR);
+    flint_mpn_copyi(C->coeffs, r, lenR * num);
+    _nmod_poly_batch_normalise(C, lenR);
+
+    _nmod_vec_clear(t);
+}
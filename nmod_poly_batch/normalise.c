@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+/*
+    Sets the lengths of the polynomials, given that all coefficients of
+    x^i for i >= len are zero.
+*/
+void
+_nmod_poly_batch_normalise(nmod_poly_batch_t B, slong len)
+{
+    slong i, j, num = B->num;
+
+    for (j = 0; j < num; j++)
+    {
+        for (i = len; i > 0 && B->coeffs[(i - 1) * num + j] == 0; i--) ;
+
+        B->length[j] = i;
+    }
+}
@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_randtest(nmod_poly_batch_t B, flint_rand_t state, slong len)
+{
+    slong i, j, num = B->num;
+
+    nmod_poly_batch_zero(B);
+    nmod_poly_batch_fit_length(B, len);
+
+    for (j = 0; j < num; j++)
+        for (i = 0; i < len; i++)
+            B->coeffs[i * num + j] = n_randtest(state) % B->mod.n;
+
+    _nmod_poly_batch_normalise(B, len);
+}
+
+void
+nmod_poly_batch_randtest_monic(nmod_poly_batch_t B,
+                                            flint_rand_t state, slong len)
+{
+    slong j, num = B->num;
+
+    nmod_poly_batch_randtest(B, state, len);
+
+    if (len == 0)
+        return;
+
+    for (j = 0; j < num; j++)
+    {
+        B->coeffs[(len - 1) * num + j] = 1;
+        B->length[j] = len;
+    }
+}
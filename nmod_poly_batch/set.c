@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_set(nmod_poly_batch_t B1, const nmod_poly_batch_t B2)
+{
+    slong j, len;
+
+    if (B1 == B2)
+        return;
+
+    len = nmod_poly_batch_max_length(B2);
+
+    nmod_poly_batch_zero(B1);
+    nmod_poly_batch_fit_length(B1, len);
+
+    flint_mpn_copyi(B1->coeffs, B2->coeffs, B2->num * len);
+    for (j = 0; j < B2->num; j++)
+        B1->length[j] = B2->length[j];
+}
@@ -0,0 +1,32 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_set_nmod_poly(nmod_poly_batch_t B, slong j,
+                                                        const nmod_poly_t poly)
+{
+    slong i, num = B->num;
+
+    nmod_poly_batch_fit_length(B, poly->length);
+
+    for (i = 0; i < poly->length; i++)
+        B->coeffs[i * num + j] = poly->coeffs[i];
+
+    for ( ; i < B->length[j]; i++)
+        B->coeffs[i * num + j] = 0;
+
+    B->length[j] = poly->length;
+}
@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    int max_level;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("divrem....");
+    fflush(stdout);
+
+    max_level = nmod_vec_simd_level();
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_batch_t A, B, Q, R;
+        nmod_poly_t a, b, q, r, s, t;
+        mp_limb_t n;
+        slong j, num, lenA, lenB;
+        int which;
+
+        nmod_vec_set_simd_level(n_randint(state, NMOD_VEC_SIMD_IFMA + 1));
+
+        n = n_randtest_prime(state, 0);
+        num = n_randint(state, 200);
+        lenB = n_randint(state, 40) + 1;
+        lenA = n_randint(state, 80);
+        which = n_randint(state, 3);
+
+        nmod_poly_batch_init(A, num, 0, n);
+        nmod_poly_batch_init(B, num, 0, n);
+        nmod_poly_batch_init(Q, num, 0, n);
+        nmod_poly_batch_init(R, num, 0, n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(q, n);
+        nmod_poly_init(r, n);
+        nmod_poly_init(s, n);
+        nmod_poly_init(t, n);
+
+        nmod_poly_batch_randtest(A, state, lenA);
+        nmod_poly_batch_randtest_monic(B, state, lenB);
+
+        /* make the divisors non-monic */
+        for (j = 0; j < num; j++)
+            B->coeffs[(lenB - 1) * num + j] =
+                                    n_randint(state, n - 1) + 1;
+
+        if (which == 0)
+        {
+            nmod_poly_batch_divrem(Q, R, A, B);
+        }
+        else if (which == 1)
+        {
+            nmod_poly_batch_set(R, A);
+            nmod_poly_batch_divrem(Q, R, R, B);
+        }
+        else
+        {
+            nmod_poly_batch_set(R, A);
+            nmod_poly_batch_rem(R, R, B);
+        }
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(r, R, j);
+            nmod_poly_divrem(s, t, a, b);
+
+            if (which != 2)
+                nmod_poly_batch_get_nmod_poly(q, Q, j);
+            else
+                nmod_poly_set(q, s);
+
+            if (!nmod_poly_equal(q, s) || !nmod_poly_equal(r, t))
+            {
+                flint_printf("FAIL: n = %wu, num = %wd, j = %wd, "
+                    "which = %d\n", n, num, j, which);
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(b), flint_printf("\n\n");
+                nmod_poly_print(q), flint_printf("\n\n");
+                nmod_poly_print(r), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_vec_set_simd_level(max_level);
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(Q);
+        nmod_poly_batch_clear(R);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(q);
+        nmod_poly_clear(r);
+        nmod_poly_clear(s);
+        nmod_poly_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_nmod_vec....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_batch_t A;
+        nmod_poly_t a;
+        mp_ptr xs, ys;
+        mp_limb_t n, y;
+        slong j, num;
+
+        n = n_randtest_not_zero(state);
+        num = n_randint(state, 200);
+
+        nmod_poly_batch_init(A, num, 0, n);
+        nmod_poly_init(a, n);
+        xs = _nmod_vec_init(num);
+        ys = _nmod_vec_init(num);
+
+        nmod_poly_batch_randtest(A, state, n_randint(state, 70));
+        _nmod_vec_randtest(xs, state, num, A->mod);
+
+        nmod_poly_batch_evaluate_nmod_vec(ys, A, xs);
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            y = nmod_poly_evaluate_nmod(a, xs[j]);
+
+            if (y != ys[j])
+            {
+                flint_printf("FAIL: n = %wu, num = %wd, j = %wd\n",
+                                                                n, num, j);
+                nmod_poly_print(a), flint_printf("\n\n");
+                flint_printf("x = %wu, y = %wu, ys[j] = %wu\n",
+                                                        xs[j], y, ys[j]);
+                abort();
+            }
+        }
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_clear(a);
+        _nmod_vec_clear(xs);
+        _nmod_vec_clear(ys);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_batch.h"
+#include "ulong_extras.h"
+
+/* random polynomials of exact length len in every lane */
+static void
+_batch_randtest_full(nmod_poly_batch_t B, flint_rand_t state, slong len)
+{
+    slong i, j, num = B->num;
+
+    nmod_poly_batch_zero(B);
+    nmod_poly_batch_fit_length(B, len);
+
+    for (i = 0; i < len; i++)
+        for (j = 0; j < num; j++)
+            B->coeffs[i * num + j] = (i == len - 1) ?
+                n_randint(state, B->mod.n - 1) + 1 :
+                n_randint(state, B->mod.n);
+
+    for (j = 0; j < num; j++)
+        B->length[j] = len;
+}
+
+int
+main(void)
+{
+    slong iter;
+    int max_level;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("gcd....");
+    fflush(stdout);
+
+    max_level = nmod_vec_simd_level();
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_batch_t A, B, C, G;
+        nmod_poly_t a, b, g, h;
+        mp_limb_t n;
+        slong j, num, lenA, lenB, lenC;
+        int aliasing;
+
+        nmod_vec_set_simd_level(n_randint(state, NMOD_VEC_SIMD_IFMA + 1));
+
+        /* small primes make the degree sequences irregular */
+        n = n_randint(state, 2) ? n_randtest_prime(state, 0)
+                                : n_nth_prime(n_randint(state, 5) + 1);
+        num = n_randint(state, 200);
+        lenA = n_randint(state, 40);
+        lenB = n_randint(state, 40);
+        lenC = n_randint(state, 5) + 1;
+        aliasing = n_randint(state, 3);
+
+        nmod_poly_batch_init(A, num, 0, n);
+        nmod_poly_batch_init(B, num, 0, n);
+        nmod_poly_batch_init(C, num, 0, n);
+        nmod_poly_batch_init(G, num, 0, n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(g, n);
+        nmod_poly_init(h, n);
+
+        if (n_randint(state, 2))
+        {
+            _batch_randtest_full(A, state, lenA);
+            _batch_randtest_full(B, state, lenB);
+        }
+        else
+        {
+            nmod_poly_batch_randtest(A, state, lenA);
+            nmod_poly_batch_randtest(B, state, lenB);
+        }
+
+        /* give some lanes a nontrivial common factor */
+        if (n_randint(state, 2))
+        {
+            _batch_randtest_full(C, state, lenC);
+            nmod_poly_batch_mul(A, A, C);
+            nmod_poly_batch_mul(B, B, C);
+        }
+
+        if (aliasing == 0)
+        {
+            nmod_poly_batch_gcd(G, A, B);
+        }
+        else if (aliasing == 1)
+        {
+            nmod_poly_batch_set(G, A);
+            nmod_poly_batch_gcd(G, G, B);
+        }
+        else
+        {
+            nmod_poly_batch_set(G, B);
+            nmod_poly_batch_gcd(G, A, G);
+        }
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(g, G, j);
+            nmod_poly_gcd(h, a, b);
+
+            if (!nmod_poly_equal(g, h))
+            {
+                flint_printf("FAIL: n = %wu, num = %wd, j = %wd, "
+                    "aliasing = %d\n", n, num, j, aliasing);
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(b), flint_printf("\n\n");
+                nmod_poly_print(g), flint_printf("\n\n");
+                nmod_poly_print(h), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_vec_set_simd_level(max_level);
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(C);
+        nmod_poly_batch_clear(G);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(g);
+        nmod_poly_clear(h);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
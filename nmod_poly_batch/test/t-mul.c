@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_batch.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    int max_level;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    max_level = nmod_vec_simd_level();
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_batch_t A, B, C;
+        nmod_poly_t a, b, c, d;
+        mp_limb_t n;
+        slong j, num, lenA, lenB;
+        int aliasing;
+
+        nmod_vec_set_simd_level(n_randint(state, NMOD_VEC_SIMD_IFMA + 1));
+
+        n = n_randint(state, 2) ? n_randtest_prime(state, 0)
+                                : n_randtest_not_zero(state);
+        num = n_randint(state, 200);
+        lenA = n_randint(state, 40);
+        lenB = n_randint(state, 40);
+        aliasing = n_randint(state, 3);
+
+        nmod_poly_batch_init(A, num, 0, n);
+        nmod_poly_batch_init(B, num, 0, n);
+        nmod_poly_batch_init(C, num, 0, n);
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+
+        nmod_poly_batch_randtest(A, state, lenA);
+        nmod_poly_batch_randtest(B, state, lenB);
+        nmod_poly_batch_randtest(C, state, n_randint(state, 40));
+
+        if (aliasing == 0)
+        {
+            nmod_poly_batch_mul(C, A, B);
+        }
+        else if (aliasing == 1)
+        {
+            nmod_poly_batch_set(C, A);
+            nmod_poly_batch_mul(C, C, B);
+        }
+        else
+        {
+            nmod_poly_batch_set(C, B);
+            nmod_poly_batch_mul(C, A, C);
+        }
+
+        for (j = 0; j < num; j++)
+        {
+            nmod_poly_batch_get_nmod_poly(a, A, j);
+            nmod_poly_batch_get_nmod_poly(b, B, j);
+            nmod_poly_batch_get_nmod_poly(c, C, j);
+            nmod_poly_mul(d, a, b);
+
+            if (!nmod_poly_equal(c, d))
+            {
+                flint_printf("FAIL: n = %wu, num = %wd, j = %wd, "
+                    "aliasing = %d\n", n, num, j, aliasing);
+                nmod_poly_print(a), flint_printf("\n\n");
+                nmod_poly_print(b), flint_printf("\n\n");
+                nmod_poly_print(c), flint_printf("\n\n");
+                nmod_poly_print(d), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_vec_set_simd_level(max_level);
+
+        nmod_poly_batch_clear(A);
+        nmod_poly_batch_clear(B);
+        nmod_poly_batch_clear(C);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
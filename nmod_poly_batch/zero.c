@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_batch.h"
+
+void
+nmod_poly_batch_zero(nmod_poly_batch_t B)
+{
+    slong j, len = nmod_poly_batch_max_length(B);
+
+    flint_mpn_zero(B->coeffs, B->num * len);
+
+    for (j = 0; j < B->num; j++)
+        B->length[j] = 0;
+}
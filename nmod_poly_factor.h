@@ -4,6 +4,7 @@
     Copyright (C) 2011 Sebastian Pancratz
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2015 Tommy Hofmann
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -96,6 +97,9 @@ FLINT_DLL ulong nmod_poly_remove(nmod_poly_t f, const nmod_poly_t p);
 FLINT_DLL void nmod_poly_factor_distinct_deg_threaded(nmod_poly_factor_t res,
                                    const nmod_poly_t poly, slong * const *degs);
 
+FLINT_DLL void nmod_poly_factor_equal_deg_threaded(nmod_poly_factor_t res,
+                        const nmod_poly_factor_t dd, const slong * degs);
+
 FLINT_DLL int nmod_poly_is_irreducible(const nmod_poly_t f);
 
 FLINT_DLL int nmod_poly_is_irreducible_rabin(const nmod_poly_t f);
@@ -3,6 +3,7 @@
     Copyright (C) 2007, 2008, 2009, 2010 William Hart
     Copyright (C) 2008 Richard Howell-Peak
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -65,6 +66,14 @@ __nmod_poly_factor(nmod_poly_factor_t result,
         return input->coeffs[1];
     }
 
+    if (algorithm == KALTOFEN)
+    {
+        /* one pipeline, so that all equal-degree splits run together */
+        nmod_poly_factor_kaltofen_shoup(result, monic_input);
+        nmod_poly_clear(monic_input);
+        return leading_coeff;
+    }
+
     nmod_poly_factor_init(sqfree_factors);
     nmod_poly_factor_squarefree(sqfree_factors, monic_input);
     nmod_poly_clear(monic_input);
@@ -0,0 +1,253 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "nmod_poly.h"
+
+/*
+    Pool of splitting tasks shared by the workers. A task is a product of
+    irreducible factors of degree deg[i] dividing block block[i] of the
+    input. Tasks that are not irreducible are split in two and both halves
+    go back to the pool, so that independent factors are split
+    concurrently. The pool is empty and idle once active reaches zero.
+*/
+typedef struct
+{
+    nmod_poly_struct * poly;
+    slong * deg;
+    slong * block;
+    slong num;
+    slong alloc;
+    slong active;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+}
+equal_deg_pool_t;
+
+typedef struct
+{
+    equal_deg_pool_t * pool;
+    nmod_poly_factor_struct * out;  /* exp holds the block index */
+}
+equal_deg_arg_t;
+
+typedef struct
+{
+    const nmod_poly_struct * poly;
+    slong block;
+}
+equal_deg_entry_t;
+
+/* takes ownership of poly, must be called with the mutex held */
+static void
+_equal_deg_pool_push(equal_deg_pool_t * pool, const nmod_poly_struct * poly,
+                                                        slong d, slong block)
+{
+    if (pool->num == pool->alloc)
+    {
+        pool->alloc = FLINT_MAX(2 * pool->alloc, 8);
+        pool->poly = flint_realloc(pool->poly,
+                                    sizeof(nmod_poly_struct) * pool->alloc);
+        pool->deg = flint_realloc(pool->deg, sizeof(slong) * pool->alloc);
+        pool->block = flint_realloc(pool->block, sizeof(slong) * pool->alloc);
+    }
+
+    pool->poly[pool->num] = *poly;
+    pool->deg[pool->num] = d;
+    pool->block[pool->num] = block;
+    pool->num++;
+}
+
+static void
+_equal_deg_run(equal_deg_arg_t * arg)
+{
+    equal_deg_pool_t * pool = arg->pool;
+    nmod_poly_struct pol;
+    nmod_poly_t f, g;
+    flint_rand_t state;
+    slong d, block;
+
+    flint_randinit(state);
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while (1)
+    {
+        while (pool->num == 0 && pool->active > 0)
+            pthread_cond_wait(&pool->cond, &pool->mutex);
+
+        if (pool->num == 0)
+            break;
+
+        pool->num--;
+        pol = pool->poly[pool->num];
+        d = pool->deg[pool->num];
+        block = pool->block[pool->num];
+        pool->active++;
+
+        pthread_mutex_unlock(&pool->mutex);
+
+        if (pol.length == d + 1)
+        {
+            nmod_poly_factor_insert(arg->out, &pol, block);
+            nmod_poly_clear(&pol);
+
+            pthread_mutex_lock(&pool->mutex);
+        }
+        else
+        {
+            nmod_poly_init_preinv(f, pol.mod.n, pol.mod.ninv);
+            nmod_poly_init_preinv(g, pol.mod.n, pol.mod.ninv);
+
+            while (!nmod_poly_factor_equal_deg_prob(f, state, &pol, d)) ;
+
+            nmod_poly_div(g, &pol, f);
+            nmod_poly_clear(&pol);
+
+            pthread_mutex_lock(&pool->mutex);
+
+            _equal_deg_pool_push(pool, f, d, block);
+            _equal_deg_pool_push(pool, g, d, block);
+        }
+
+        pool->active--;
+        pthread_cond_broadcast(&pool->cond);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    flint_randclear(state);
+}
+
+static void *
+_equal_deg_worker(void * arg_ptr)
+{
+    _equal_deg_run((equal_deg_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* orders by block, then by length, then by coefficients from the top */
+static int
+_equal_deg_entry_cmp(const void * a, const void * b)
+{
+    const equal_deg_entry_t * x = a;
+    const equal_deg_entry_t * y = b;
+    slong i;
+
+    if (x->block != y->block)
+        return x->block < y->block ? -1 : 1;
+
+    if (x->poly->length != y->poly->length)
+        return x->poly->length < y->poly->length ? -1 : 1;
+
+    for (i = x->poly->length - 1; i >= 0; i--)
+        if (x->poly->coeffs[i] != y->poly->coeffs[i])
+            return x->poly->coeffs[i] < y->poly->coeffs[i] ? -1 : 1;
+
+    return 0;
+}
+
+void
+nmod_poly_factor_equal_deg_threaded(nmod_poly_factor_t res,
+                        const nmod_poly_factor_t dd, const slong * degs)
+{
+    equal_deg_pool_t pool;
+    equal_deg_arg_t * args;
+    equal_deg_entry_t * entries;
+    nmod_poly_factor_struct * out;
+    pthread_t * threads;
+    nmod_poly_t t;
+    slong i, j, k, num, num_threads;
+
+    num_threads = flint_get_num_threads();
+
+    pool.poly = NULL;
+    pool.deg = NULL;
+    pool.block = NULL;
+    pool.num = 0;
+    pool.alloc = 0;
+    pool.active = 0;
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.cond, NULL);
+
+    for (i = dd->num - 1; i >= 0; i--)
+    {
+        nmod_poly_init_preinv(t, dd->p[i].mod.n, dd->p[i].mod.ninv);
+        nmod_poly_set(t, dd->p + i);
+        _equal_deg_pool_push(&pool, t, degs[i], i);
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(equal_deg_arg_t) * num_threads);
+    out = flint_malloc(sizeof(nmod_poly_factor_struct) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        nmod_poly_factor_init(out + i);
+        args[i].pool = &pool;
+        args[i].out = out + i;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL, _equal_deg_worker, &args[i]);
+
+    _equal_deg_run(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    /* the order of the factors must not depend on the scheduling */
+    for (i = num = 0; i < num_threads; i++)
+        num += out[i].num;
+
+    entries = flint_malloc(sizeof(equal_deg_entry_t) * num);
+
+    for (i = k = 0; i < num_threads; i++)
+    {
+        for (j = 0; j < out[i].num; j++, k++)
+        {
+            entries[k].poly = out[i].p + j;
+            entries[k].block = out[i].exp[j];
+        }
+    }
+
+    qsort(entries, num, sizeof(equal_deg_entry_t), _equal_deg_entry_cmp);
+
+    for (k = 0; k < num; k++)
+        nmod_poly_factor_insert(res, entries[k].poly,
+                                                dd->exp[entries[k].block]);
+
+    for (i = 0; i < num_threads; i++)
+        nmod_poly_factor_clear(out + i);
+
+    flint_free(entries);
+    flint_free(out);
+    flint_free(args);
+    flint_free(threads);
+    flint_free(pool.poly);
+    flint_free(pool.deg);
+    flint_free(pool.block);
+    pthread_mutex_destroy(&pool.mutex);
+    pthread_cond_destroy(&pool.cond);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Lina Kulakova
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -17,8 +18,8 @@ void nmod_poly_factor_kaltofen_shoup(nmod_poly_factor_t res,
 {
     nmod_poly_t v;
     nmod_poly_factor_t sq_free, dist_deg;
-    slong i, j, k, l, res_num, dist_deg_num;
-    slong *degs;
+    slong i, j, k, res_num, dist_deg_num;
+    slong *degs, *all_degs;
 
     nmod_poly_init_preinv(v, poly->mod.n, poly->mod.ninv);
 
@@ -31,18 +32,22 @@ void nmod_poly_factor_kaltofen_shoup(nmod_poly_factor_t res,
         return;        
     }
     
-    if (!(degs = flint_malloc(nmod_poly_degree(poly) * sizeof(slong))))
+    if (!(degs = flint_malloc(2 * nmod_poly_degree(poly) * sizeof(slong))))
     {
         flint_printf("Exception (nmod_poly_factor_kaltofen_shoup): \n");
         flint_printf("Not enough memory.\n");
         flint_abort();
     }
+    all_degs = degs + nmod_poly_degree(poly);
 
     /* compute squarefree factorisation */
     nmod_poly_factor_init(sq_free);
     nmod_poly_factor_squarefree(sq_free, v);
 
-    /* compute distinct-degree factorisation */
+    /*
+        compute distinct-degree factorisation, each block inheriting
+        the multiplicity of its squarefree part
+    */
     nmod_poly_factor_init(dist_deg);
     for (i = 0; i < sq_free->num; i++)
     {
@@ -55,14 +60,27 @@ void nmod_poly_factor_kaltofen_shoup(nmod_poly_factor_t res,
         else
             nmod_poly_factor_distinct_deg(dist_deg, sq_free->p + i, &degs);
 
-        /* compute equal-degree factorisation */
-        for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
+        for (j = dist_deg_num; j < dist_deg->num; j++)
+        {
+            all_degs[j] = degs[j - dist_deg_num];
+            dist_deg->exp[j] = sq_free->exp[i];
+        }
+    }
+
+    /* compute equal-degree factorisation, splitting all blocks at once */
+    if (flint_get_num_threads() > 1)
+    {
+        nmod_poly_factor_equal_deg_threaded(res, dist_deg, all_degs);
+    }
+    else
+    {
+        for (j = 0; j < dist_deg->num; j++)
         {
             res_num = res->num;
 
-            nmod_poly_factor_equal_deg(res, dist_deg->p + j, degs[l]);
+            nmod_poly_factor_equal_deg(res, dist_deg->p + j, all_degs[j]);
             for (k = res_num; k < res->num; k++)
-                res->exp[k] = nmod_poly_remove(v, res->p + k);
+                res->exp[k] = dist_deg->exp[j];
         }
     }
 
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Martin Lee
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -11,51 +12,67 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/types.h>
-#include <time.h>
-#include <unistd.h>
 #include <gmp.h>
 
 #include "flint.h"
 #include "nmod_poly.h"
+#include "profiler.h"
 
-int main (void)
+/*
+    Factors random polynomials of increasing degree with 1, 2, 4, ...
+    threads, up to the number given on the command line (default 8), and
+    reports the wall time and the speedup over one thread.
+*/
+int main(int argc, char ** argv)
 {
+    const slong lens[] = {250, 500, 1000, 2000};
+    const mp_limb_t primes[] = {UWORD(17), UWORD(1125899906842597)};
+    slong i, j, max_threads, threads;
+    nmod_poly_t f;
+    nmod_poly_factor_t fac;
+    timeit_t timer;
+    double base;
+    FLINT_TEST_INIT(state);
+
+    max_threads = (argc > 1) ? atol(argv[1]) : 8;
+
+    flint_printf("degree\tp\tthreads\twall (ms)\tspeedup\n");
 
-    double t;
-    nmod_poly_t f, g, h;
-    for (int i= 15001;i < 16000; i++)
+    for (i = 0; i < 2; i++)
     {
-      nmod_poly_init2 (f, 17, i/2+1);
-      nmod_poly_init2 (g, 17, i+1);
-
-      nmod_poly_set_coeff_ui (f, i/2, 1);
-      nmod_poly_set_coeff_ui (f, 1, 1);
-      nmod_poly_set_coeff_ui (f, 0, ((i%17)*(i%17)+3) % 17);
-
-      nmod_poly_set_coeff_ui (g, i, 1);
-      nmod_poly_set_coeff_ui (g, i/2+1, 1);
-      nmod_poly_set_coeff_ui (g, 1, ((i % 17)+1)%17);
-      nmod_poly_set_coeff_ui (g, 0, 15);
-
-      nmod_poly_init (h, 17);
-      nmod_poly_gcd (h, f, g);
-
-      if (!nmod_poly_is_one (h))
-      {
-        flint_printf ("i= %d\n", i);
-        nmod_poly_factor_t factors;
-        nmod_poly_factor_init (factors);
-        t= clock();
-        nmod_poly_factor (factors, h);
-                    t = (clock() - t) / CLOCKS_PER_SEC;
-                flint_printf("factorization %.2lf\n", t);
-        nmod_poly_factor_clear (factors);
-      }
-
-      nmod_poly_clear (f);
-      nmod_poly_clear (g);
-      nmod_poly_clear (h);
+        for (j = 0; j < 4; j++)
+        {
+            nmod_poly_init(f, primes[i]);
+
+            do
+                nmod_poly_randtest(f, state, lens[j] + 1);
+            while (f->length != lens[j] + 1);
+
+            base = 0;
+
+            for (threads = 1; threads <= max_threads; threads *= 2)
+            {
+                flint_set_num_threads(threads);
+                nmod_poly_factor_init(fac);
+
+                timeit_start(timer);
+                nmod_poly_factor(fac, f);
+                timeit_stop(timer);
+
+                if (threads == 1)
+                    base = FLINT_MAX(timer->wall, 1);
+
+                flint_printf("%wd\t%wu\t%wd\t%wd\t%.2f\n", lens[j], primes[i],
+                    threads, timer->wall, base / FLINT_MAX(timer->wall, 1));
+
+                nmod_poly_factor_clear(fac);
+            }
+
+            nmod_poly_clear(f);
+        }
     }
+
+    flint_set_num_threads(1);
+    FLINT_TEST_CLEANUP(state);
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+#include "flint.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_equal_deg_threaded....");
+    fflush(stdout);
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+    for (iter = 0; iter < 50 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_t poly, q, r, product, expected;
+        nmod_poly_factor_t dd, res;
+        mp_limb_t modulus;
+        slong i, j, k, num_blocks, num, d;
+        slong degs[4];
+
+        modulus = n_randtest_prime(state, 0);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nmod_poly_init(poly, modulus);
+        nmod_poly_init(q, modulus);
+        nmod_poly_init(r, modulus);
+        nmod_poly_init(product, modulus);
+        nmod_poly_init(expected, modulus);
+        nmod_poly_factor_init(dd);
+        nmod_poly_factor_init(res);
+
+        /* blocks of distinct irreducible factors of equal degree */
+        num_blocks = 1 + n_randint(state, 4);
+        nmod_poly_one(expected);
+
+        for (k = 0, d = 0; k < num_blocks; k++)
+        {
+            d += 1 + n_randint(state, 2);
+            num = 1 + n_randint(state, 5);
+            degs[k] = d;
+
+            nmod_poly_one(product);
+
+            for (i = 0; i < num; i++)
+            {
+                /* skip repeated factors */
+                nmod_poly_randtest_monic_irreducible(poly, state, d + 1);
+                nmod_poly_divrem(q, r, product, poly);
+
+                if (r->length != 0)
+                    nmod_poly_mul(product, product, poly);
+            }
+
+            nmod_poly_factor_insert(dd, product, 1 + n_randint(state, 3));
+
+            for (j = 0; j < dd->exp[k]; j++)
+                nmod_poly_mul(expected, expected, product);
+        }
+
+        nmod_poly_factor_equal_deg_threaded(res, dd, degs);
+
+        flint_set_num_threads(1);
+
+        nmod_poly_one(product);
+        for (i = 0; i < res->num; i++)
+        {
+            if (!nmod_poly_is_irreducible(res->p + i))
+            {
+                flint_printf("Error: factor is reducible\n");
+                nmod_poly_print(res->p + i); flint_printf("\n");
+                abort();
+            }
+
+            for (j = 0; j < res->exp[i]; j++)
+                nmod_poly_mul(product, product, res->p + i);
+        }
+
+        if (!nmod_poly_equal(product, expected))
+        {
+            flint_printf("Error: product of factors does not equal to the original polynomial\n");
+            flint_printf("expected:\n"); nmod_poly_print(expected); flint_printf("\n");
+            flint_printf("product:\n"); nmod_poly_print(product); flint_printf("\n");
+            abort();
+        }
+
+        nmod_poly_clear(poly);
+        nmod_poly_clear(q);
+        nmod_poly_clear(r);
+        nmod_poly_clear(product);
+        nmod_poly_clear(expected);
+        nmod_poly_factor_clear(dd);
+        nmod_poly_factor_clear(res);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+
+#else
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("SKIPPED\n");
+   return 0;
+
+#endif
+
+}
@@ -4,6 +4,7 @@
     Copyright (C) 2008 Richard Howell-Peak
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2012 Lina Kulakova
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -37,6 +38,8 @@ main(void)
 
         modulus = n_randtest_prime(state, 0);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         nmod_poly_init(poly1, modulus);
         nmod_poly_init(poly, modulus);
         nmod_poly_init(q, modulus);
@@ -83,6 +86,8 @@ main(void)
         nmod_poly_factor_init(res);
         nmod_poly_factor_kaltofen_shoup(res, poly1);
 
+        flint_set_num_threads(1);
+
         if (res->num != num)
         {
             flint_printf("Error: number of factors incorrect: %wd != %wd\n", res->num, num);
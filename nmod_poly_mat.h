@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -29,6 +30,17 @@
  extern "C" {
 #endif
 
+/* Tuning parameters *********************************************************/
+
+/* minimum work, in coefficient operations, for threading over points */
+#define NMOD_POLY_MAT_THREAD_CUTOFF 65536
+
+/* maximum order for which PM-Basis calls M-Basis directly */
+#define NMOD_POLY_MAT_PMBASIS_CUTOFF 256
+
+/* maximum dimension for which det_pmbasis uses fraction-free LU */
+#define NMOD_POLY_MAT_DET_PMBASIS_CUTOFF 8
+
 /* Types *********************************************************************/
 
 typedef struct
@@ -136,6 +148,12 @@ FLINT_DLL void nmod_poly_mat_print(const nmod_poly_mat_t mat, const char * x);
 
 FLINT_DLL slong nmod_poly_mat_max_length(const nmod_poly_mat_t A);
 
+FLINT_DLL void nmod_poly_mat_row_degree(slong * rdeg,
+                            const nmod_poly_mat_t A, const slong * shift);
+
+FLINT_DLL int nmod_poly_mat_is_row_reduced(const nmod_poly_mat_t A,
+                                                    const slong * shift);
+
 /* Scalar arithmetic *********************************************************/
 
 FLINT_DLL void nmod_poly_mat_scalar_mul_nmod_poly(nmod_poly_mat_t B,
@@ -176,10 +194,26 @@ FLINT_DLL void nmod_poly_mat_sqr_interpolate(nmod_poly_mat_t B, const nmod_poly_
 
 FLINT_DLL void nmod_poly_mat_pow(nmod_poly_mat_t B, const nmod_poly_mat_t A, ulong exp);
 
+/* Truncation and shifting **************************************************/
+
+FLINT_DLL void nmod_poly_mat_truncate(nmod_poly_mat_t A, slong len);
+
+FLINT_DLL void nmod_poly_mat_shift_right(nmod_poly_mat_t B,
+                                            const nmod_poly_mat_t A, slong n);
+
 /* Evaluation ****************************************************************/
 
 FLINT_DLL void nmod_poly_mat_evaluate_nmod(nmod_mat_t B, const nmod_poly_mat_t A, mp_limb_t x);
 
+FLINT_DLL void _nmod_poly_mat_threaded(void (* fn)(void *, slong, slong),
+                                        void * arg, slong num, slong work);
+
+FLINT_DLL void _nmod_poly_mat_evaluate_interp(mp_ptr vals,
+                        const nmod_poly_mat_t A, const nmod_poly_interp_t S);
+
+FLINT_DLL void _nmod_poly_mat_interpolate_interp(nmod_poly_mat_t C,
+                            mp_srcptr vals, const nmod_poly_interp_t S);
+
 /* Row reduction *************************************************************/
 
 FLINT_DLL slong nmod_poly_mat_find_pivot_any(const nmod_poly_mat_t mat,
@@ -206,6 +240,8 @@ FLINT_DLL void nmod_poly_mat_det_fflu(nmod_poly_t det, const nmod_poly_mat_t A);
 
 FLINT_DLL void nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A);
 
+FLINT_DLL void nmod_poly_mat_det_pmbasis(nmod_poly_t det, const nmod_poly_mat_t A);
+
 FLINT_DLL slong nmod_poly_mat_rank(const nmod_poly_mat_t A);
 
 /* Inverse *******************************************************************/
@@ -213,10 +249,27 @@ FLINT_DLL slong nmod_poly_mat_rank(const nmod_poly_mat_t A);
 FLINT_DLL int nmod_poly_mat_inv(nmod_poly_mat_t Ainv, nmod_poly_t den,
     const nmod_poly_mat_t A);
 
+FLINT_DLL int nmod_poly_mat_inv_fflu(nmod_poly_mat_t Ainv, nmod_poly_t den,
+    const nmod_poly_mat_t A);
+
 /* Nullspace *****************************************************************/
 
 FLINT_DLL slong nmod_poly_mat_nullspace(nmod_poly_mat_t res, const nmod_poly_mat_t mat);
 
+FLINT_DLL slong nmod_poly_mat_nullspace_pmbasis(nmod_poly_mat_t res,
+                                                const nmod_poly_mat_t mat);
+
+/* Approximant bases *********************************************************/
+
+FLINT_DLL void nmod_poly_mat_mbasis(nmod_poly_mat_t P, slong * rdeg,
+            const nmod_poly_mat_t F, slong order, const slong * shift);
+
+FLINT_DLL void nmod_poly_mat_pmbasis(nmod_poly_mat_t P, slong * rdeg,
+            const nmod_poly_mat_t F, slong order, const slong * shift);
+
+FLINT_DLL slong nmod_poly_mat_kernel_pmbasis(nmod_poly_mat_t K,
+                                                const nmod_poly_mat_t F);
+
 /* Solving *******************************************************************/
 
 FLINT_DLL int nmod_poly_mat_solve(nmod_poly_mat_t X, nmod_poly_t den,
@@ -225,6 +278,9 @@ FLINT_DLL int nmod_poly_mat_solve(nmod_poly_mat_t X, nmod_poly_t den,
 FLINT_DLL int nmod_poly_mat_solve_fflu(nmod_poly_mat_t X, nmod_poly_t den,
                             const nmod_poly_mat_t A, const nmod_poly_mat_t B);
 
+FLINT_DLL int nmod_poly_mat_solve_interpolate(nmod_poly_mat_t X,
+    nmod_poly_t den, const nmod_poly_mat_t A, const nmod_poly_mat_t B);
+
 FLINT_DLL void nmod_poly_mat_solve_fflu_precomp(nmod_poly_mat_t X,
                     const slong * perm,
                     const nmod_poly_mat_t FFLU, const nmod_poly_mat_t B);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -43,6 +44,13 @@ nmod_poly_mat_det(nmod_poly_t det, const nmod_poly_mat_t A)
     }
     else
     {
-        nmod_poly_mat_det_interpolate(det, A);
+        slong len = n * (nmod_poly_mat_max_length(A) - 1) + 1;
+        mp_limb_t p = nmod_poly_mat_modulus(A);
+
+        /* too few evaluation points: triangularize with kernel bases */
+        if (len > 0 && (mp_limb_t) len > p && n_is_prime(p))
+            nmod_poly_mat_det_pmbasis(det, A);
+        else
+            nmod_poly_mat_det_interpolate(det, A);
     }
 }
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -15,13 +16,44 @@
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 
-void
-nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A)
+typedef struct
 {
-    slong i, l, n, len;
+    mp_ptr d;
+    mp_srcptr Avals;
+    slong n;
+    slong num;
+    nmod_t mod;
+}
+det_points_arg_t;
 
+static void
+_det_points_range(void * arg_ptr, slong start, slong stop)
+{
+    det_points_arg_t * arg = (det_points_arg_t *) arg_ptr;
+    slong i, j, t, n = arg->n, num = arg->num;
     nmod_mat_t X;
-    mp_ptr x, d;
+
+    nmod_mat_init(X, n, n, arg->mod.n);
+
+    for (t = start; t < stop; t++)
+    {
+        for (i = 0; i < n; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(X, i, j) = arg->Avals[(i * n + j) * num + t];
+
+        arg->d[t] = _nmod_mat_det(X);
+    }
+
+    nmod_mat_clear(X);
+}
+
+void
+nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A)
+{
+    slong l, n, len, num;
+    nmod_poly_interp_t S;
+    det_points_arg_t arg;
+    mp_ptr Avals, d;
 
     n = A->r;
 
@@ -43,26 +75,31 @@ nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A)
     len = n*(l - 1) + 1;
 
     /* Not enough points to interpolate */
-    if (len > nmod_poly_mat_modulus(A))
+    if (!nmod_poly_interp_init(S, len, nmod_poly_mat_modulus(A)))
     {
+        nmod_poly_interp_clear(S);
         nmod_poly_mat_det_fflu(det, A);
         return;
     }
 
-    x = _nmod_vec_init(len);
-    d = _nmod_vec_init(len);
-    nmod_mat_init(X, n, n, nmod_poly_mat_modulus(A));
+    num = nmod_poly_interp_num_points(S);
 
-    for (i = 0; i < len; i++)
-    {
-        x[i] = i;
-        nmod_poly_mat_evaluate_nmod(X, A, x[i]);
-        d[i] = nmod_mat_det(X);
-    }
+    Avals = _nmod_vec_init(n * n * num);
+    d = _nmod_vec_init(num);
+
+    _nmod_poly_mat_evaluate_interp(Avals, A, S);
+
+    arg.d = d;
+    arg.Avals = Avals;
+    arg.n = n;
+    arg.num = num;
+    arg.mod = S->mod;
 
-    nmod_poly_interpolate_nmod_vec(det, x, d, len);
+    _nmod_poly_mat_threaded(_det_points_range, &arg, num, num * n * n * n);
 
-    _nmod_vec_clear(x);
+    nmod_poly_interp_interpolate(det, d, S);
+
+    _nmod_vec_clear(Avals);
     _nmod_vec_clear(d);
-    nmod_mat_clear(X);
+    nmod_poly_interp_clear(S);
 }
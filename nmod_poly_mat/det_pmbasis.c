@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+#include "perm.h"
+
+/*
+    Finds a permutation perm of the rows of A, listing n - c rows first
+    and then c rows, such that the last c rows of the c last columns of A
+    evaluated at some point are linearly independent. Returns 0 if no
+    point tried shows the c last columns to have full rank.
+*/
+static int
+_det_pmbasis_row_perm(slong * perm, const nmod_poly_mat_t A, slong c)
+{
+    nmod_poly_mat_t AR;
+    nmod_mat_t V, T;
+    slong i, j, k, n, rank;
+    slong * piv, * P;
+    mp_limb_t p;
+
+    n = A->r;
+    p = nmod_poly_mat_modulus(A);
+
+    nmod_poly_mat_window_init(AR, A, 0, n - c, n, n);
+    nmod_mat_init(V, n, c, p);
+    nmod_mat_init(T, c, n, p);
+    piv = flint_malloc(sizeof(slong) * n);
+    P = flint_malloc(sizeof(slong) * c);
+
+    rank = 0;
+    for (k = 0; k < 3 && (mp_limb_t) k < p && rank < c; k++)
+    {
+        nmod_poly_mat_evaluate_nmod(V, AR, k);
+        nmod_mat_transpose(T, V);
+        rank = _nmod_mat_rref(T, piv, P);
+    }
+
+    if (rank == c)
+    {
+        /* the pivot rows go last */
+        for (i = 0; i < n - c; i++)
+            perm[i] = piv[c + i];
+        for (j = 0; j < c; j++)
+            perm[n - c + j] = piv[j];
+    }
+
+    nmod_poly_mat_window_clear(AR);
+    nmod_mat_clear(V);
+    nmod_mat_clear(T);
+    flint_free(piv);
+    flint_free(P);
+
+    return rank == c;
+}
+
+void
+nmod_poly_mat_det_pmbasis(nmod_poly_t det, const nmod_poly_mat_t A)
+{
+    nmod_poly_mat_t B, K, KU, K1, AL, AR, ADR, B1;
+    nmod_poly_t d;
+    slong i, j, n, n1, n2;
+    slong * perm;
+    mp_limb_t p;
+
+    n = A->r;
+    p = nmod_poly_mat_modulus(A);
+
+    if (n <= NMOD_POLY_MAT_DET_PMBASIS_CUTOFF)
+    {
+        nmod_poly_mat_det_fflu(det, A);
+        return;
+    }
+
+    n1 = n / 2;
+    n2 = n - n1;
+
+    perm = _perm_init(n);
+
+    if (!_det_pmbasis_row_perm(perm, A, n2))
+    {
+        _perm_clear(perm);
+        nmod_poly_mat_det_fflu(det, A);
+        return;
+    }
+
+    nmod_poly_mat_init(B, n, n, p);
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            nmod_poly_set(nmod_poly_mat_entry(B, i, j),
+                          nmod_poly_mat_entry(A, perm[i], j));
+
+    /*
+        With B = [AL | AR] and K = [KU | KD] a basis of the left kernel of
+        AR, [K ; 0 I] B = [K AL 0 ; * ADR], so that
+        det(KU) det(B) = det(K AL) det(ADR). Since ADR is nonsingular,
+        so is KU.
+    */
+    nmod_poly_mat_window_init(AL, B, 0, 0, n, n1);
+    nmod_poly_mat_window_init(AR, B, 0, n1, n, n);
+    nmod_poly_mat_window_init(ADR, B, n1, n1, n, n);
+
+    /* AR has full column rank, so its left kernel has dimension n1 */
+    nmod_poly_mat_init(K, n, n, p);
+    nmod_poly_mat_kernel_pmbasis(K, AR);
+
+    nmod_poly_init(d, p);
+    nmod_poly_mat_window_init(K1, K, 0, 0, n1, n);
+    nmod_poly_mat_window_init(KU, K, 0, 0, n1, n1);
+    nmod_poly_mat_init(B1, n1, n1, p);
+
+    nmod_poly_mat_mul(B1, K1, AL);
+
+    nmod_poly_mat_det(det, B1);
+
+    if (!nmod_poly_is_zero(det))
+    {
+        nmod_poly_mat_det(d, ADR);
+        nmod_poly_mul(det, det, d);
+        nmod_poly_mat_det(d, KU);
+        nmod_poly_div(det, det, d);
+
+        if (_perm_parity(perm, n))
+            nmod_poly_neg(det, det);
+    }
+
+    nmod_poly_mat_window_clear(K1);
+    nmod_poly_mat_window_clear(KU);
+    nmod_poly_mat_clear(B1);
+    nmod_poly_clear(d);
+
+    nmod_poly_mat_window_clear(AL);
+    nmod_poly_mat_window_clear(AR);
+    nmod_poly_mat_window_clear(ADR);
+    nmod_poly_mat_clear(K);
+    nmod_poly_mat_clear(B);
+    _perm_clear(perm);
+}
@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    mp_ptr vals;
+    const nmod_poly_mat_struct * A;
+    const nmod_poly_interp_struct * S;
+}
+evaluate_interp_arg_t;
+
+static void
+_evaluate_interp_range(void * arg_ptr, slong start, slong stop)
+{
+    evaluate_interp_arg_t * arg = (evaluate_interp_arg_t *) arg_ptr;
+    slong e, c = arg->A->c, num = nmod_poly_interp_num_points(arg->S);
+    const nmod_poly_struct * poly;
+
+    for (e = start; e < stop; e++)
+    {
+        poly = nmod_poly_mat_entry(arg->A, e / c, e % c);
+        _nmod_poly_interp_evaluate(arg->vals + e * num,
+                                    poly->coeffs, poly->length, arg->S);
+    }
+}
+
+void
+_nmod_poly_mat_evaluate_interp(mp_ptr vals, const nmod_poly_mat_t A,
+                                                const nmod_poly_interp_t S)
+{
+    evaluate_interp_arg_t arg;
+    slong num = nmod_poly_interp_num_points(S);
+
+    arg.vals = vals;
+    arg.A = A;
+    arg.S = S;
+
+    _nmod_poly_mat_threaded(_evaluate_interp_range, &arg,
+                                        A->r * A->c, A->r * A->c * num);
+}
@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    nmod_poly_mat_struct * C;
+    mp_srcptr vals;
+    const nmod_poly_interp_struct * S;
+}
+interpolate_interp_arg_t;
+
+static void
+_interpolate_interp_range(void * arg_ptr, slong start, slong stop)
+{
+    interpolate_interp_arg_t * arg = (interpolate_interp_arg_t *) arg_ptr;
+    slong e, c = arg->C->c, num = nmod_poly_interp_num_points(arg->S);
+    nmod_poly_struct * poly;
+
+    for (e = start; e < stop; e++)
+    {
+        poly = nmod_poly_mat_entry(arg->C, e / c, e % c);
+        nmod_poly_interp_interpolate(poly, arg->vals + e * num, arg->S);
+    }
+}
+
+void
+_nmod_poly_mat_interpolate_interp(nmod_poly_mat_t C, mp_srcptr vals,
+                                                const nmod_poly_interp_t S)
+{
+    interpolate_interp_arg_t arg;
+    slong num = nmod_poly_interp_num_points(S);
+
+    arg.C = C;
+    arg.vals = vals;
+    arg.S = S;
+
+    _nmod_poly_mat_threaded(_interpolate_interp_range, &arg,
+                                        C->r * C->c, C->r * C->c * num);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -16,6 +17,8 @@
 
 #define E nmod_poly_mat_entry
 
+#define INV_INTERPOLATE_MIN_DIM 10
+
 int
 nmod_poly_mat_inv(nmod_poly_mat_t Ainv, nmod_poly_t den,
                     const nmod_poly_mat_t A)
@@ -57,34 +60,21 @@ nmod_poly_mat_inv(nmod_poly_mat_t Ainv, nmod_poly_t den,
             return 1;
         }
     }
-    else
+    else if (n >= INV_INTERPOLATE_MIN_DIM)
     {
-        nmod_poly_mat_t LU, I;
-        slong * perm;
+        nmod_poly_mat_t I;
         int result;
 
-        perm = _perm_init(n);
-        nmod_poly_mat_init_set(LU, A);
-        result = (nmod_poly_mat_fflu(LU, den, perm, LU, 1) == n);
-
-        if (result)
-        {
-            nmod_poly_mat_init(I, n, n, nmod_poly_mat_modulus(A));
-            nmod_poly_mat_one(I);
-            nmod_poly_mat_solve_fflu_precomp(Ainv, perm, LU, I);
-            nmod_poly_mat_clear(I);
-        }
-        else
-            nmod_poly_zero(den);
-
-        if (_perm_parity(perm, n))
-        {
-            nmod_poly_mat_neg(Ainv, Ainv);
-            nmod_poly_neg(den, den);
-        }
+        /* solve_interpolate sets den = det(A), also when falling back */
+        nmod_poly_mat_init(I, n, n, nmod_poly_mat_modulus(A));
+        nmod_poly_mat_one(I);
+        result = nmod_poly_mat_solve_interpolate(Ainv, den, A, I);
+        nmod_poly_mat_clear(I);
 
-        _perm_clear(perm);
-        nmod_poly_mat_clear(LU);
         return result;
     }
+    else
+    {
+        return nmod_poly_mat_inv_fflu(Ainv, den, A);
+    }
 }
@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+#include "perm.h"
+
+int
+nmod_poly_mat_inv_fflu(nmod_poly_mat_t Ainv, nmod_poly_t den,
+                    const nmod_poly_mat_t A)
+{
+    nmod_poly_mat_t LU, I;
+    slong * perm;
+    slong n = nmod_poly_mat_nrows(A);
+    int result;
+
+    if (n == 0)
+    {
+        nmod_poly_one(den);
+        return 1;
+    }
+
+    perm = _perm_init(n);
+    nmod_poly_mat_init_set(LU, A);
+    result = (nmod_poly_mat_fflu(LU, den, perm, LU, 1) == n);
+
+    if (result)
+    {
+        nmod_poly_mat_init(I, n, n, nmod_poly_mat_modulus(A));
+        nmod_poly_mat_one(I);
+        nmod_poly_mat_solve_fflu_precomp(Ainv, perm, LU, I);
+        nmod_poly_mat_clear(I);
+    }
+    else
+        nmod_poly_zero(den);
+
+    if (_perm_parity(perm, n))
+    {
+        nmod_poly_mat_neg(Ainv, Ainv);
+        nmod_poly_neg(den, den);
+    }
+
+    _perm_clear(perm);
+    nmod_poly_mat_clear(LU);
+    return result;
+}
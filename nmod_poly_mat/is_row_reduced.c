@@ -0,0 +1,58 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+nmod_poly_mat_is_row_reduced(const nmod_poly_mat_t A, const slong * shift)
+{
+    nmod_mat_t L;
+    slong i, j, d, r, c;
+    slong * rdeg;
+    int result;
+
+    r = A->r;
+    c = A->c;
+
+    if (r > c)
+        return 0;
+
+    if (r == 0)
+        return 1;
+
+    rdeg = flint_malloc(sizeof(slong) * r);
+    nmod_poly_mat_row_degree(rdeg, A, shift);
+
+    /* the leading matrix has the coefficients of x^(rdeg_i - shift_j) */
+    nmod_mat_init(L, r, c, nmod_poly_mat_modulus(A));
+
+    for (i = 0; i < r; i++)
+    {
+        for (j = 0; j < c; j++)
+        {
+            d = rdeg[i] - (shift != NULL ? shift[j] : 0);
+
+            if (d >= 0)
+                nmod_mat_entry(L, i, j) =
+                    nmod_poly_get_coeff_ui(nmod_poly_mat_entry(A, i, j), d);
+        }
+    }
+
+    result = (nmod_mat_rank(L) == r);
+
+    nmod_mat_clear(L);
+    flint_free(rdeg);
+
+    return result;
+}
@@ -0,0 +1,112 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+slong
+nmod_poly_mat_kernel_pmbasis(nmod_poly_mat_t K, const nmod_poly_mat_t F)
+{
+    nmod_poly_mat_t P, G;
+    nmod_mat_t V;
+    slong i, j, k, m, n, rank, bound, total, order, nullity;
+    slong * s, * rdeg;
+    mp_limb_t p;
+
+    m = F->r;
+    n = F->c;
+    p = nmod_poly_mat_modulus(F);
+
+    nmod_poly_mat_zero(K);
+
+    if (m == 0)
+        return 0;
+
+    /*
+        The nullity is at most m minus the rank of F at any point, so
+        evaluating at a few points gives an upper bound which is
+        attained in all but degenerate cases.
+    */
+    nmod_mat_init(V, m, n, p);
+    rank = 0;
+    for (k = 0; k < 3 && (mp_limb_t) k < p && rank < FLINT_MIN(m, n); k++)
+    {
+        nmod_poly_mat_evaluate_nmod(V, F, k);
+        rank = FLINT_MAX(rank, nmod_mat_rank(V));
+    }
+    nmod_mat_clear(V);
+
+    bound = m - rank;
+
+    if (bound == 0)
+        return 0;
+
+    /*
+        With the shift s = rdeg(F), an approximant p of order sigma with
+        rdeg_s(p) < sigma satisfies deg(p F) < sigma, so p F = 0. The
+        s-minimal kernel basis has s-degrees summing to at most |s|, so
+        order |s| + 1 always finds all of it; smaller orders are tried
+        first and accepted once they find bound kernel vectors.
+    */
+    s = flint_malloc(sizeof(slong) * m);
+    rdeg = flint_malloc(sizeof(slong) * m);
+
+    nmod_poly_mat_row_degree(s, F, NULL);
+
+    total = 0;
+    order = 0;
+    for (i = 0; i < m; i++)
+    {
+        s[i] = FLINT_MAX(s[i], 0);
+        total += s[i];
+        order = FLINT_MAX(order, s[i]);
+    }
+
+    order = FLINT_MIN(2 * order + 1, total + 1);
+
+    nmod_poly_mat_init(P, m, m, p);
+    nmod_poly_mat_init(G, m, n, p);
+
+    while (1)
+    {
+        nmod_poly_mat_set(G, F);
+        nmod_poly_mat_truncate(G, order);
+        nmod_poly_mat_pmbasis(P, rdeg, G, order, s);
+
+        for (i = nullity = 0; i < m; i++)
+            nullity += (rdeg[i] < order);
+
+        if (nullity >= bound || order > total)
+            break;
+
+        order = FLINT_MIN(2 * order, total + 1);
+    }
+
+    for (i = k = 0; i < m; i++)
+    {
+        if (rdeg[i] < order)
+        {
+            for (j = 0; j < m; j++)
+                nmod_poly_swap(nmod_poly_mat_entry(K, k, j),
+                               nmod_poly_mat_entry(P, i, j));
+            k++;
+        }
+    }
+
+    nmod_poly_mat_clear(P);
+    nmod_poly_mat_clear(G);
+    flint_free(s);
+    flint_free(rdeg);
+
+    return nullity;
+}
@@ -0,0 +1,154 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+/* sets row i of A to row i plus c times row q, entrywise */
+static void
+_nmod_poly_mat_row_addmul(nmod_poly_mat_t A, slong i, slong q, mp_limb_t c)
+{
+    nmod_poly_struct * a, * b;
+    slong j, len;
+
+    for (j = 0; j < A->c; j++)
+    {
+        a = nmod_poly_mat_entry(A, i, j);
+        b = nmod_poly_mat_entry(A, q, j);
+
+        if (b->length == 0)
+            continue;
+
+        len = FLINT_MAX(a->length, b->length);
+        nmod_poly_fit_length(a, len);
+        _nmod_vec_zero(a->coeffs + a->length, len - a->length);
+        _nmod_vec_scalar_addmul_nmod(a->coeffs, b->coeffs, b->length, c,
+                                                                    a->mod);
+        a->length = len;
+        _nmod_poly_normalise(a);
+    }
+}
+
+/* orders row indices by increasing shift, breaking ties by index */
+static void
+_sort_by_shift(slong * perm, const slong * s, slong m)
+{
+    slong i, j, t;
+
+    for (i = 0; i < m; i++)
+        perm[i] = i;
+
+    for (i = 1; i < m; i++)
+    {
+        t = perm[i];
+        for (j = i; j > 0 && s[perm[j - 1]] > s[t]; j--)
+            perm[j] = perm[j - 1];
+        perm[j] = t;
+    }
+}
+
+void
+nmod_poly_mat_mbasis(nmod_poly_mat_t P, slong * rdeg,
+            const nmod_poly_mat_t F, slong order, const slong * shift)
+{
+    nmod_poly_mat_t R;
+    nmod_mat_t C;
+    nmod_t mod;
+    slong i, j, k, t, m, n, rank;
+    slong * perm, * piv, * rperm, * s;
+    mp_limb_t c;
+
+    m = F->r;
+    n = F->c;
+    nmod_init(&mod, nmod_poly_mat_modulus(F));
+
+    s = flint_malloc(sizeof(slong) * m);
+    for (i = 0; i < m; i++)
+        s[i] = (shift != NULL) ? shift[i] : 0;
+
+    /* residual x^-k P F mod x^(order - k) */
+    nmod_poly_mat_init_set(R, F);
+    nmod_poly_mat_truncate(R, order);
+
+    nmod_poly_mat_one(P);
+
+    perm = flint_malloc(sizeof(slong) * m);
+    piv = flint_malloc(sizeof(slong) * m);
+    rperm = flint_malloc(sizeof(slong) * n);
+    nmod_mat_init(C, n, m, mod.n);
+
+    for (k = 0; k < order && !nmod_poly_mat_is_zero(R); k++)
+    {
+        /*
+            The order one basis for the constant term of R: with the rows
+            sorted by shift, each row that depends on the previous ones
+            gives a constant kernel vector and the others are multiplied
+            by x. The pivots of the rref of the transpose give the
+            dependencies.
+        */
+        _sort_by_shift(perm, s, m);
+
+        for (j = 0; j < m; j++)
+            for (i = 0; i < n; i++)
+                nmod_mat_entry(C, i, j) = nmod_poly_get_coeff_ui(
+                                    nmod_poly_mat_entry(R, perm[j], i), 0);
+
+        rank = _nmod_mat_rref(C, piv, rperm);
+
+        for (j = rank; j < m; j++)
+        {
+            i = perm[piv[j]];
+
+            for (t = 0; t < rank && piv[t] < piv[j]; t++)
+            {
+                c = nmod_mat_entry(C, t, piv[j]);
+
+                if (c != 0)
+                {
+                    c = nmod_neg(c, mod);
+                    _nmod_poly_mat_row_addmul(P, i, perm[piv[t]], c);
+                    _nmod_poly_mat_row_addmul(R, i, perm[piv[t]], c);
+                }
+            }
+
+            for (t = 0; t < n; t++)
+                nmod_poly_shift_right(nmod_poly_mat_entry(R, i, t),
+                                        nmod_poly_mat_entry(R, i, t), 1);
+        }
+
+        for (j = 0; j < rank; j++)
+        {
+            i = perm[piv[j]];
+            s[i]++;
+
+            for (t = 0; t < m; t++)
+                if (!nmod_poly_is_zero(nmod_poly_mat_entry(P, i, t)))
+                    nmod_poly_shift_left(nmod_poly_mat_entry(P, i, t),
+                                        nmod_poly_mat_entry(P, i, t), 1);
+        }
+
+        nmod_poly_mat_truncate(R, order - k - 1);
+    }
+
+    for (i = 0; i < m; i++)
+        rdeg[i] = s[i];
+
+    nmod_mat_clear(C);
+    nmod_poly_mat_clear(R);
+    flint_free(s);
+    flint_free(perm);
+    flint_free(piv);
+    flint_free(rperm);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -15,6 +16,8 @@
 
 #define KS_MIN_DIM 10
 #define INTERPOLATE_MIN_DIM 60
+#define INTERPOLATE_NTT_MIN_LENGTH 16
+#define INTERPOLATE_NTT_MIN_DIM 4
 #define KS_MAX_LENGTH 128
 
 void
@@ -29,7 +32,7 @@ nmod_poly_mat_mul(nmod_poly_mat_t C, const nmod_poly_mat_t A,
 
     dim = FLINT_MIN(FLINT_MIN(ar, br), bc);
 
-    if (dim < KS_MIN_DIM)
+    if (dim < INTERPOLATE_NTT_MIN_DIM)
     {
         nmod_poly_mat_mul_classical(C, A, B);
     }
@@ -41,7 +44,16 @@ nmod_poly_mat_mul(nmod_poly_mat_t C, const nmod_poly_mat_t A,
         Alen = nmod_poly_mat_max_length(A);
         Blen = nmod_poly_mat_max_length(B);
 
-        if ((FLINT_BIT_COUNT(mod) > FLINT_BITS / 4)
+        /* evaluation at transform points wins early, even for small dim */
+        if (FLINT_MIN(Alen, Blen) >= INTERPOLATE_NTT_MIN_LENGTH
+            && _nmod_poly_interp_ntt_available(Alen + Blen - 1, mod)
+            && n_is_prime(mod))
+            nmod_poly_mat_mul_interpolate(C, A, B);
+
+        else if (dim < KS_MIN_DIM)
+            nmod_poly_mat_mul_classical(C, A, B);
+
+        else if ((FLINT_BIT_COUNT(mod) > FLINT_BITS / 4)
             && (dim > INTERPOLATE_MIN_DIM + n_sqrt(FLINT_MIN(Alen, Blen)))
             && (mod >= Alen + Blen - 1) && n_is_prime(mod))
             nmod_poly_mat_mul_interpolate(C, A, B);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,24 +10,67 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
 #include "flint.h"
+#include "nmod_vec.h"
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 
+typedef struct
+{
+    mp_ptr Cvals;
+    mp_srcptr Avals;
+    mp_srcptr Bvals;
+    slong m;
+    slong n;
+    slong k;
+    slong num;
+    nmod_t mod;
+}
+mul_points_arg_t;
+
+/* C(x_t) = A(x_t) B(x_t) for start <= t < stop */
+static void
+_mul_points_range(void * arg_ptr, slong start, slong stop)
+{
+    mul_points_arg_t * arg = (mul_points_arg_t *) arg_ptr;
+    slong i, j, t, m = arg->m, n = arg->n, k = arg->k, num = arg->num;
+    nmod_mat_t a, b, c;
+
+    nmod_mat_init(a, m, n, arg->mod.n);
+    nmod_mat_init(b, n, k, arg->mod.n);
+    nmod_mat_init(c, m, k, arg->mod.n);
+
+    for (t = start; t < stop; t++)
+    {
+        for (i = 0; i < m; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(a, i, j) = arg->Avals[(i * n + j) * num + t];
+
+        for (i = 0; i < n; i++)
+            for (j = 0; j < k; j++)
+                nmod_mat_entry(b, i, j) = arg->Bvals[(i * k + j) * num + t];
+
+        nmod_mat_mul(c, a, b);
+
+        for (i = 0; i < m; i++)
+            for (j = 0; j < k; j++)
+                arg->Cvals[(i * k + j) * num + t] = nmod_mat_entry(c, i, j);
+    }
+
+    nmod_mat_clear(a);
+    nmod_mat_clear(b);
+    nmod_mat_clear(c);
+}
+
 void
 nmod_poly_mat_mul_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     const nmod_poly_mat_t B)
 {
-    slong i, j, k;
-    slong A_len, B_len, len;
-
-    nmod_mat_t *C_mod, *A_mod, *B_mod;
-
-    mp_ptr xs;
-    mp_ptr tt, uu;
-    mp_ptr * tree;
-    mp_ptr weights;
-    nmod_t mod;
+    slong A_len, B_len, len, num;
+    nmod_poly_interp_t S;
+    mul_points_arg_t arg;
+    mp_ptr Avals, Bvals, Cvals;
 
     if (B->r == 0)
     {
@@ -44,100 +88,40 @@ nmod_poly_mat_mul_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     }
 
     len = A_len + B_len - 1;
-    nmod_init(&mod, nmod_poly_mat_modulus(A));
 
-    if (mod.n < len)
+    if (!nmod_poly_interp_init(S, len, nmod_poly_mat_modulus(A)))
     {
+        nmod_poly_interp_clear(S);
         flint_printf("Exception (nmod_poly_mat_mul_interpolate). \n"
                "Characteristic is too small.\n");
         flint_abort();
     }
 
-    xs = _nmod_vec_init(len);
-    tt = _nmod_vec_init(len);
-    uu = _nmod_vec_init(len);
-    weights = _nmod_vec_init(len);
-
-    A_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-    B_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-    C_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-
-    for (i = 0; i < len; i++)
-    {
-        xs[i] = i;
-        nmod_mat_init(A_mod[i], A->r, A->c, mod.n);
-        nmod_mat_init(B_mod[i], B->r, B->c, mod.n);
-        nmod_mat_init(C_mod[i], C->r, C->c, mod.n);
-    }
-
-    tree = _nmod_poly_tree_alloc(len);
-    _nmod_poly_tree_build(tree, xs, len, mod);
-    _nmod_poly_interpolation_weights(weights, tree, len, mod);
-
-    for (i = 0; i < A->r; i++)
-    {
-        for (j = 0; j < A->c; j++)
-        {
-            _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
-                nmod_poly_mat_entry(A, i, j)->coeffs, 
-                nmod_poly_mat_entry(A, i, j)->length,
-                tree, len, mod);
-
-            for (k = 0; k < len; k++)
-                A_mod[k]->rows[i][j] = tt[k];
-        }
-    }
-
-    for (i = 0; i < B->r; i++)
-    {
-        for (j = 0; j < B->c; j++)
-        {
-            _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
-                nmod_poly_mat_entry(B, i, j)->coeffs, 
-                nmod_poly_mat_entry(B, i, j)->length,
-                tree, len, mod);
-
-            for (k = 0; k < len; k++)
-                B_mod[k]->rows[i][j] = tt[k];
-        }
-    }
+    num = nmod_poly_interp_num_points(S);
 
-    for (i = 0; i < len; i++)
-        nmod_mat_mul(C_mod[i], A_mod[i], B_mod[i]);
+    Avals = _nmod_vec_init(A->r * A->c * num);
+    Bvals = _nmod_vec_init(B->r * B->c * num);
+    Cvals = _nmod_vec_init(A->r * B->c * num);
 
-    for (i = 0; i < C->r; i++)
-    {
-        for (j = 0; j < C->c; j++)
-        {
-            nmod_poly_struct * poly;
-
-            for (k = 0; k < len; k++)
-                tt[k] = C_mod[k]->rows[i][j];
-
-            poly = nmod_poly_mat_entry(C, i, j);
-            nmod_poly_fit_length(poly, len);
-            _nmod_poly_interpolate_nmod_vec_fast_precomp(poly->coeffs,
-                tt, tree, weights, len, mod);
-            poly->length = len;
-            _nmod_poly_normalise(poly);
-        }
-    }
+    _nmod_poly_mat_evaluate_interp(Avals, A, S);
+    _nmod_poly_mat_evaluate_interp(Bvals, B, S);
 
-    _nmod_poly_tree_free(tree, len);
+    arg.Cvals = Cvals;
+    arg.Avals = Avals;
+    arg.Bvals = Bvals;
+    arg.m = A->r;
+    arg.n = A->c;
+    arg.k = B->c;
+    arg.num = num;
+    arg.mod = S->mod;
 
-    for (i = 0; i < len; i++)
-    {
-        nmod_mat_clear(A_mod[i]);
-        nmod_mat_clear(B_mod[i]);
-        nmod_mat_clear(C_mod[i]);
-    }
+    _nmod_poly_mat_threaded(_mul_points_range, &arg, num,
+                                                num * A->r * A->c * B->c);
 
-    flint_free(A_mod);
-    flint_free(B_mod);
-    flint_free(C_mod);
+    _nmod_poly_mat_interpolate_interp(C, Cvals, S);
 
-    _nmod_vec_clear(xs);
-    _nmod_vec_clear(tt);
-    _nmod_vec_clear(uu);
-    _nmod_vec_clear(weights);
+    _nmod_vec_clear(Avals);
+    _nmod_vec_clear(Bvals);
+    _nmod_vec_clear(Cvals);
+    nmod_poly_interp_clear(S);
 }
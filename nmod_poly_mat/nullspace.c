@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -13,6 +14,8 @@
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 
+#define NULLSPACE_PMBASIS_MIN_DIM 10
+
 slong
 nmod_poly_mat_nullspace(nmod_poly_mat_t res, const nmod_poly_mat_t mat)
 {
@@ -24,6 +27,10 @@ nmod_poly_mat_nullspace(nmod_poly_mat_t res, const nmod_poly_mat_t mat)
 
     n = mat->c;
 
+    if (n >= NULLSPACE_PMBASIS_MIN_DIM
+            && n_is_prime(nmod_poly_mat_modulus(mat)))
+        return nmod_poly_mat_nullspace_pmbasis(res, mat);
+
     nmod_poly_init(den, nmod_poly_mat_modulus(mat));
     nmod_poly_mat_init_set(tmp, mat);
     rank = nmod_poly_mat_rref(tmp, den, tmp);
@@ -0,0 +1,47 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+slong
+nmod_poly_mat_nullspace_pmbasis(nmod_poly_mat_t res, const nmod_poly_mat_t mat)
+{
+    nmod_poly_mat_t T, K;
+    slong i, j, r, c, nullity;
+
+    r = mat->r;
+    c = mat->c;
+
+    /* the right nullspace of mat is the left kernel of its transpose */
+    nmod_poly_mat_init(T, c, r, nmod_poly_mat_modulus(mat));
+    nmod_poly_mat_init(K, c, c, nmod_poly_mat_modulus(mat));
+
+    for (i = 0; i < r; i++)
+        for (j = 0; j < c; j++)
+            nmod_poly_set(nmod_poly_mat_entry(T, j, i),
+                          nmod_poly_mat_entry(mat, i, j));
+
+    nullity = nmod_poly_mat_kernel_pmbasis(K, T);
+
+    nmod_poly_mat_zero(res);
+
+    for (i = 0; i < nullity; i++)
+        for (j = 0; j < c; j++)
+            nmod_poly_swap(nmod_poly_mat_entry(res, j, i),
+                           nmod_poly_mat_entry(K, i, j));
+
+    nmod_poly_mat_clear(T);
+    nmod_poly_mat_clear(K);
+
+    return nullity;
+}
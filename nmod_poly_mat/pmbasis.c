@@ -0,0 +1,59 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+void
+nmod_poly_mat_pmbasis(nmod_poly_mat_t P, slong * rdeg,
+            const nmod_poly_mat_t F, slong order, const slong * shift)
+{
+    nmod_poly_mat_t F1, G, P1, P2;
+    slong m, order1;
+    mp_limb_t n;
+
+    if (order <= NMOD_POLY_MAT_PMBASIS_CUTOFF)
+    {
+        nmod_poly_mat_mbasis(P, rdeg, F, order, shift);
+        return;
+    }
+
+    m = F->r;
+    n = nmod_poly_mat_modulus(F);
+    order1 = order / 2;
+
+    nmod_poly_mat_init(P1, m, m, n);
+    nmod_poly_mat_init(P2, m, m, n);
+
+    /* P1 F = 0 mod x^order1 */
+    nmod_poly_mat_init_set(F1, F);
+    nmod_poly_mat_truncate(F1, order1);
+    nmod_poly_mat_pmbasis(P1, rdeg, F1, order1, shift);
+    nmod_poly_mat_clear(F1);
+
+    /* the residual x^-order1 P1 F mod x^(order - order1) */
+    nmod_poly_mat_init_set(F1, F);
+    nmod_poly_mat_truncate(F1, order);
+    nmod_poly_mat_init(G, m, F->c, n);
+    nmod_poly_mat_mul(G, P1, F1);
+    nmod_poly_mat_truncate(G, order);
+    nmod_poly_mat_shift_right(G, G, order1);
+    nmod_poly_mat_clear(F1);
+
+    nmod_poly_mat_pmbasis(P2, rdeg, G, order - order1, rdeg);
+
+    nmod_poly_mat_mul(P, P2, P1);
+
+    nmod_poly_mat_clear(G);
+    nmod_poly_mat_clear(P1);
+    nmod_poly_mat_clear(P2);
+}
@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+void
+nmod_poly_mat_row_degree(slong * rdeg, const nmod_poly_mat_t A,
+                                                        const slong * shift)
+{
+    slong i, j, d, min;
+
+    min = 0;
+    if (shift != NULL)
+    {
+        for (j = 0; j < A->c; j++)
+            min = (j == 0 || shift[j] < min) ? shift[j] : min;
+    }
+
+    for (i = 0; i < A->r; i++)
+    {
+        rdeg[i] = min - 1;
+
+        for (j = 0; j < A->c; j++)
+        {
+            d = nmod_poly_degree(nmod_poly_mat_entry(A, i, j));
+
+            if (d < 0)
+                continue;
+
+            if (shift != NULL)
+                d += shift[j];
+
+            rdeg[i] = FLINT_MAX(rdeg[i], d);
+        }
+    }
+}
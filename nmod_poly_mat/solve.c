@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -14,9 +15,14 @@
 #include "nmod_poly_mat.h"
 #include "perm.h"
 
+#define INTERPOLATE_MIN_DIM 10
+
 int
 nmod_poly_mat_solve(nmod_poly_mat_t X, nmod_poly_t den,
                     const nmod_poly_mat_t A, const nmod_poly_mat_t B)
 {
-    return nmod_poly_mat_solve_fflu(X, den, A, B);
+    if (A->r < INTERPOLATE_MIN_DIM)
+        return nmod_poly_mat_solve_fflu(X, den, A, B);
+    else
+        return nmod_poly_mat_solve_interpolate(X, den, A, B);
 }
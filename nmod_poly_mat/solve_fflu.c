@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -34,7 +35,16 @@ nmod_poly_mat_solve_fflu(nmod_poly_mat_t X, nmod_poly_t den,
     result = (nmod_poly_mat_fflu(LU, den, perm, LU, 1) == dim);
 
     if (result)
+    {
         nmod_poly_mat_solve_fflu_precomp(X, perm, LU, B);
+
+        /* make den = det(A) */
+        if (_perm_parity(perm, dim))
+        {
+            nmod_poly_mat_neg(X, X);
+            nmod_poly_neg(den, den);
+        }
+    }
     else
         nmod_poly_zero(den);
 
@@ -0,0 +1,183 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+#include "perm.h"
+
+typedef struct
+{
+    mp_ptr Xvals;
+    mp_ptr d;
+    mp_srcptr Avals;
+    mp_srcptr Bvals;
+    slong n;
+    slong k;
+    slong num;
+    nmod_t mod;
+}
+solve_points_arg_t;
+
+/*
+    Sets d[t] = det(A(x_t)) and X(x_t) = d[t] A(x_t)^-1 B(x_t), which is
+    adj(A(x_t)) B(x_t), for start <= t < stop, using a single PLUQ
+    decomposition per point. Sets d[t] = 0 if A(x_t) is singular.
+*/
+static void
+_solve_points_range(void * arg_ptr, slong start, slong stop)
+{
+    solve_points_arg_t * arg = (solve_points_arg_t *) arg_ptr;
+    slong i, j, t, n = arg->n, k = arg->k, num = arg->num;
+    slong * P, * Q;
+    nmod_mat_t LU, B, PB, X;
+    nmod_t mod = arg->mod;
+    mp_limb_t d;
+
+    nmod_mat_init(LU, n, n, mod.n);
+    nmod_mat_init(B, n, k, mod.n);
+    nmod_mat_init(X, n, k, mod.n);
+    nmod_mat_window_init(PB, B, 0, 0, n, k);
+    P = flint_malloc(sizeof(slong) * n);
+    Q = flint_malloc(sizeof(slong) * n);
+
+    for (t = start; t < stop; t++)
+    {
+        for (i = 0; i < n; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(LU, i, j) = arg->Avals[(i * n + j) * num + t];
+
+        if (nmod_mat_pluq(P, Q, LU) < n)
+        {
+            arg->d[t] = 0;
+            continue;
+        }
+
+        d = UWORD(1);
+        for (i = 0; i < n; i++)
+            d = nmod_mul(d, nmod_mat_entry(LU, i, i), mod);
+
+        if (_perm_parity(P, n) != _perm_parity(Q, n))
+            d = nmod_neg(d, mod);
+
+        arg->d[t] = d;
+
+        /* when A is nonsingular, every column is a pivot and Q is trivial */
+        for (i = 0; i < n; i++)
+            for (j = 0; j < k; j++)
+                nmod_mat_entry(B, i, j) = arg->Bvals[(i * k + j) * num + t];
+
+        for (i = 0; i < n; i++)
+            PB->rows[i] = B->rows[P[i]];
+
+        nmod_mat_solve_tril(X, LU, PB, 1);
+        nmod_mat_solve_triu(X, LU, X, 0);
+
+        for (i = 0; i < n; i++)
+            for (j = 0; j < k; j++)
+                arg->Xvals[(i * k + j) * num + t] =
+                                    nmod_mul(nmod_mat_entry(X, i, j), d, mod);
+    }
+
+    flint_free(P);
+    flint_free(Q);
+    nmod_mat_window_clear(PB);
+    nmod_mat_clear(LU);
+    nmod_mat_clear(B);
+    nmod_mat_clear(X);
+}
+
+int
+nmod_poly_mat_solve_interpolate(nmod_poly_mat_t X, nmod_poly_t den,
+                    const nmod_poly_mat_t A, const nmod_poly_mat_t B)
+{
+    slong n, k, t, A_len, B_len, len, num;
+    nmod_poly_interp_t S;
+    solve_points_arg_t arg;
+    mp_ptr Avals, Bvals, Xvals, d;
+    int result;
+
+    n = A->r;
+    k = B->c;
+
+    if (n != A->c)
+    {
+        flint_printf("Exception (nmod_poly_mat_solve_interpolate). "
+               "Non-square system matrix.\n");
+        flint_abort();
+    }
+
+    A_len = nmod_poly_mat_max_length(A);
+    B_len = nmod_poly_mat_max_length(B);
+
+    if (n == 0 || k == 0 || A_len == 0 || B_len == 0)
+        return nmod_poly_mat_solve_fflu(X, den, A, B);
+
+    /* deg det(A) <= n (A_len - 1), deg adj(A) B <= (n - 1)(A_len - 1) + B_len - 1 */
+    len = FLINT_MAX(n * (A_len - 1) + 1, (n - 1) * (A_len - 1) + B_len);
+
+    if (!nmod_poly_interp_init(S, len, nmod_poly_mat_modulus(A)))
+    {
+        nmod_poly_interp_clear(S);
+        return nmod_poly_mat_solve_fflu(X, den, A, B);
+    }
+
+    num = nmod_poly_interp_num_points(S);
+
+    Avals = _nmod_vec_init(n * n * num);
+    Bvals = _nmod_vec_init(n * k * num);
+    Xvals = _nmod_vec_init(n * k * num);
+    d = _nmod_vec_init(num);
+
+    _nmod_poly_mat_evaluate_interp(Avals, A, S);
+    _nmod_poly_mat_evaluate_interp(Bvals, B, S);
+
+    arg.Xvals = Xvals;
+    arg.d = d;
+    arg.Avals = Avals;
+    arg.Bvals = Bvals;
+    arg.n = n;
+    arg.k = k;
+    arg.num = num;
+    arg.mod = S->mod;
+
+    _nmod_poly_mat_threaded(_solve_points_range, &arg, num,
+                                                        num * n * n * (n + k));
+
+    for (t = 0; t < num && d[t] != 0; t++) ;
+
+    if (t == num)
+    {
+        _nmod_poly_mat_interpolate_interp(X, Xvals, S);
+        nmod_poly_interp_interpolate(den, d, S);
+        result = 1;
+    }
+    else
+    {
+        /* unlucky point, or A is singular */
+        result = -1;
+    }
+
+    _nmod_vec_clear(Avals);
+    _nmod_vec_clear(Bvals);
+    _nmod_vec_clear(Xvals);
+    _nmod_vec_clear(d);
+    nmod_poly_interp_clear(S);
+
+    if (result == -1)
+        result = nmod_poly_mat_solve_fflu(X, den, A, B);
+
+    return result;
+}
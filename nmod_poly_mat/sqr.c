@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -16,6 +17,8 @@
 
 #define KS_MIN_DIM 10
 #define INTERPOLATE_MIN_DIM 80
+#define INTERPOLATE_NTT_MIN_LENGTH 16
+#define INTERPOLATE_NTT_MIN_DIM 4
 #define KS_MAX_LENGTH 128
 
 void
@@ -23,7 +26,7 @@ nmod_poly_mat_sqr(nmod_poly_mat_t C, const nmod_poly_mat_t A)
 {
     slong dim = A->r;
 
-    if (dim < KS_MIN_DIM)
+    if (dim < INTERPOLATE_NTT_MIN_DIM)
     {
         nmod_poly_mat_sqr_classical(C, A);
     }
@@ -34,12 +37,21 @@ nmod_poly_mat_sqr(nmod_poly_mat_t C, const nmod_poly_mat_t A)
 
         Alen = nmod_poly_mat_max_length(A);
 
-        if ((FLINT_BIT_COUNT(mod) > FLINT_BITS / 4)
+        /* evaluation at transform points wins early, even for small dim */
+        if (Alen >= INTERPOLATE_NTT_MIN_LENGTH
+            && _nmod_poly_interp_ntt_available(2 * Alen - 1, mod)
+            && n_is_prime(mod))
+            nmod_poly_mat_sqr_interpolate(C, A);
+
+        else if (dim < KS_MIN_DIM)
+            nmod_poly_mat_sqr_classical(C, A);
+
+        else if ((FLINT_BIT_COUNT(mod) > FLINT_BITS / 4)
             && (dim > INTERPOLATE_MIN_DIM + n_sqrt(Alen))
             && (mod >= 2 * Alen - 1) && n_is_prime(mod))
             nmod_poly_mat_sqr_interpolate(C, A);
 
-        if (Alen > KS_MAX_LENGTH)
+        else if (Alen > KS_MAX_LENGTH)
             nmod_poly_mat_sqr_classical(C, A);
         else
             nmod_poly_mat_sqr_KS(C, A);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,23 +10,58 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
 #include "flint.h"
+#include "nmod_vec.h"
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 
-void
-nmod_poly_mat_sqr_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A)
+typedef struct
+{
+    mp_ptr Cvals;
+    mp_srcptr Avals;
+    slong n;
+    slong num;
+    nmod_t mod;
+}
+sqr_points_arg_t;
+
+/* C(x_t) = A(x_t)^2 for start <= t < stop */
+static void
+_sqr_points_range(void * arg_ptr, slong start, slong stop)
 {
-    slong i, j, k;
-    slong A_len, len;
+    sqr_points_arg_t * arg = (sqr_points_arg_t *) arg_ptr;
+    slong i, j, t, n = arg->n, num = arg->num;
+    nmod_mat_t a, c;
 
-    nmod_mat_t *C_mod, *A_mod;
+    nmod_mat_init(a, n, n, arg->mod.n);
+    nmod_mat_init(c, n, n, arg->mod.n);
 
-    mp_ptr xs;
-    mp_ptr tt, uu;
-    mp_ptr * tree;
-    mp_ptr weights;
-    nmod_t mod;
+    for (t = start; t < stop; t++)
+    {
+        for (i = 0; i < n; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(a, i, j) = arg->Avals[(i * n + j) * num + t];
+
+        /* should be nmod_mat_sqr */
+        nmod_mat_mul(c, a, a);
+
+        for (i = 0; i < n; i++)
+            for (j = 0; j < n; j++)
+                arg->Cvals[(i * n + j) * num + t] = nmod_mat_entry(c, i, j);
+    }
+
+    nmod_mat_clear(a);
+    nmod_mat_clear(c);
+}
+
+void
+nmod_poly_mat_sqr_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A)
+{
+    slong A_len, len, num;
+    nmod_poly_interp_t S;
+    sqr_points_arg_t arg;
+    mp_ptr Avals, Cvals;
 
     if (A->c == 0)
     {
@@ -42,83 +78,34 @@ nmod_poly_mat_sqr_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A)
     }
 
     len = 2 * A_len - 1;
-    nmod_init(&mod, nmod_poly_mat_modulus(A));
 
-    if (mod.n < len)
+    if (!nmod_poly_interp_init(S, len, nmod_poly_mat_modulus(A)))
     {
+        nmod_poly_interp_clear(S);
         flint_printf("Exception (nmod_poly_mat_sqr_interpolate). \n"
                "Characteristic is too small.\n");
         flint_abort();
     }
 
-    xs = _nmod_vec_init(len);
-    tt = _nmod_vec_init(len);
-    uu = _nmod_vec_init(len);
-    weights = _nmod_vec_init(len);
-
-    A_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-    C_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-
-    for (i = 0; i < len; i++)
-    {
-        xs[i] = i;
-        nmod_mat_init(A_mod[i], A->r, A->c, mod.n);
-        nmod_mat_init(C_mod[i], C->r, C->c, mod.n);
-    }
-
-    tree = _nmod_poly_tree_alloc(len);
-    _nmod_poly_tree_build(tree, xs, len, mod);
-    _nmod_poly_interpolation_weights(weights, tree, len, mod);
+    num = nmod_poly_interp_num_points(S);
 
-    for (i = 0; i < A->r; i++)
-    {
-        for (j = 0; j < A->c; j++)
-        {
-            _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
-                nmod_poly_mat_entry(A, i, j)->coeffs, 
-                nmod_poly_mat_entry(A, i, j)->length,
-                tree, len, mod);
-
-            for (k = 0; k < len; k++)
-                A_mod[k]->rows[i][j] = tt[k];
-        }
-    }
+    Avals = _nmod_vec_init(A->r * A->c * num);
+    Cvals = _nmod_vec_init(A->r * A->c * num);
 
-    /* should be nmod_mat_sqr */
-    for (i = 0; i < len; i++)
-        nmod_mat_mul(C_mod[i], A_mod[i], A_mod[i]);
+    _nmod_poly_mat_evaluate_interp(Avals, A, S);
 
-    for (i = 0; i < C->r; i++)
-    {
-        for (j = 0; j < C->c; j++)
-        {
-            nmod_poly_struct * poly;
-
-            for (k = 0; k < len; k++)
-                tt[k] = C_mod[k]->rows[i][j];
-
-            poly = nmod_poly_mat_entry(C, i, j);
-            nmod_poly_fit_length(poly, len);
-            _nmod_poly_interpolate_nmod_vec_fast_precomp(poly->coeffs,
-                tt, tree, weights, len, mod);
-            poly->length = len;
-            _nmod_poly_normalise(poly);
-        }
-    }
+    arg.Cvals = Cvals;
+    arg.Avals = Avals;
+    arg.n = A->r;
+    arg.num = num;
+    arg.mod = S->mod;
 
-    _nmod_poly_tree_free(tree, len);
-
-    for (i = 0; i < len; i++)
-    {
-        nmod_mat_clear(A_mod[i]);
-        nmod_mat_clear(C_mod[i]);
-    }
+    _nmod_poly_mat_threaded(_sqr_points_range, &arg, num,
+                                                num * A->r * A->r * A->r);
 
-    flint_free(A_mod);
-    flint_free(C_mod);
+    _nmod_poly_mat_interpolate_interp(C, Cvals, S);
 
-    _nmod_vec_clear(xs);
-    _nmod_vec_clear(tt);
-    _nmod_vec_clear(uu);
-    _nmod_vec_clear(weights);
+    _nmod_vec_clear(Avals);
+    _nmod_vec_clear(Cvals);
+    nmod_poly_interp_clear(S);
 }
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -84,7 +85,7 @@ main(void)
         mp_limb_t mod;
 
         mod = n_randtest_prime(state, 0);
-        n = n_randint(state, 10);
+        n = n_randint(state, 16);
         deg = 1 + n_randint(state, 5);
         density = n_randint(state, 100) * 0.01;
 
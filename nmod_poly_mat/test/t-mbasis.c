@@ -0,0 +1,136 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mbasis....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_mat_t F, P, PF;
+        nmod_poly_t d;
+        slong i, m, n, order, deg, sum;
+        slong * shift, * rdeg, * rdeg2;
+        mp_limb_t p;
+
+        p = n_randtest_prime(state, 0);
+        m = 1 + n_randint(state, 6);
+        n = 1 + n_randint(state, 5);
+        order = n_randint(state, 20);
+        deg = n_randint(state, 25);
+
+        nmod_poly_mat_init(F, m, n, p);
+        nmod_poly_mat_init(P, m, m, p);
+        nmod_poly_mat_init(PF, m, n, p);
+        nmod_poly_init(d, p);
+
+        shift = flint_malloc(sizeof(slong) * m);
+        rdeg = flint_malloc(sizeof(slong) * m);
+        rdeg2 = flint_malloc(sizeof(slong) * m);
+
+        for (i = 0; i < m; i++)
+            shift[i] = n_randint(state, 10) - 5;
+
+        nmod_poly_mat_randtest_sparse(F, state, deg,
+                                            n_randint(state, 101) * 0.01);
+
+        if (n_randint(state, 2))
+            nmod_poly_mat_mbasis(P, rdeg, F, order, shift);
+        else
+        {
+            for (i = 0; i < m; i++)
+                shift[i] = 0;
+            nmod_poly_mat_mbasis(P, rdeg, F, order, NULL);
+        }
+
+        nmod_poly_mat_mul(PF, P, F);
+        nmod_poly_mat_truncate(PF, order);
+
+        if (!nmod_poly_mat_is_zero(PF))
+        {
+            flint_printf("FAIL: P F != 0 mod x^order\n");
+            nmod_poly_mat_print(F, "x");
+            nmod_poly_mat_print(P, "x");
+            abort();
+        }
+
+        nmod_poly_mat_row_degree(rdeg2, P, shift);
+
+        for (i = 0; i < m; i++)
+        {
+            if (rdeg[i] != rdeg2[i])
+            {
+                flint_printf("FAIL: wrong shifted row degrees\n");
+                nmod_poly_mat_print(F, "x");
+                nmod_poly_mat_print(P, "x");
+                abort();
+            }
+        }
+
+        if (!nmod_poly_mat_is_row_reduced(P, shift))
+        {
+            flint_printf("FAIL: P is not reduced\n");
+            nmod_poly_mat_print(F, "x");
+            nmod_poly_mat_print(P, "x");
+            abort();
+        }
+
+        /* det P is a monomial whose degree matches the row degrees */
+        nmod_poly_mat_det(d, P);
+
+        for (i = sum = 0; i < m; i++)
+            sum += rdeg[i] - shift[i];
+
+        if (nmod_poly_degree(d) != sum || sum > n * order)
+        {
+            flint_printf("FAIL: wrong degree of det P\n");
+            nmod_poly_mat_print(F, "x");
+            nmod_poly_mat_print(P, "x");
+            abort();
+        }
+
+        for (i = 0; i < sum; i++)
+        {
+            if (nmod_poly_get_coeff_ui(d, i) != 0)
+            {
+                flint_printf("FAIL: det P is not a monomial\n");
+                nmod_poly_mat_print(F, "x");
+                nmod_poly_mat_print(P, "x");
+                abort();
+            }
+        }
+
+        nmod_poly_mat_clear(F);
+        nmod_poly_mat_clear(P);
+        nmod_poly_mat_clear(PF);
+        nmod_poly_clear(d);
+        flint_free(shift);
+        flint_free(rdeg);
+        flint_free(rdeg2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -35,6 +36,8 @@ main(void)
         mp_limb_t mod, x;
         slong m, n, k, deg;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         mod = n_randtest_prime(state, 0);
         m = n_randint(state, 20);
         n = n_randint(state, 20);
@@ -181,6 +184,8 @@ main(void)
         nmod_poly_mat_clear(C);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
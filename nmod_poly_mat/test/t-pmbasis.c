@@ -0,0 +1,119 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("pmbasis....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_mat_t F, P, Q, PF;
+        slong i, m, n, order, deg;
+        slong * shift, * rdeg, * rdeg2;
+        mp_limb_t p;
+
+        p = n_randtest_prime(state, 0);
+        m = 1 + n_randint(state, 6);
+        n = 1 + n_randint(state, 5);
+        /* exercise the recursion */
+        order = n_randint(state, 3 * NMOD_POLY_MAT_PMBASIS_CUTOFF);
+        deg = n_randint(state, order + 10);
+
+        nmod_poly_mat_init(F, m, n, p);
+        nmod_poly_mat_init(P, m, m, p);
+        nmod_poly_mat_init(Q, m, m, p);
+        nmod_poly_mat_init(PF, m, n, p);
+
+        shift = flint_malloc(sizeof(slong) * m);
+        rdeg = flint_malloc(sizeof(slong) * m);
+        rdeg2 = flint_malloc(sizeof(slong) * m);
+
+        for (i = 0; i < m; i++)
+            shift[i] = n_randint(state, 20) - 10;
+
+        nmod_poly_mat_randtest_sparse(F, state, deg,
+                                            n_randint(state, 101) * 0.01);
+
+        nmod_poly_mat_pmbasis(P, rdeg, F, order, shift);
+
+        nmod_poly_mat_mul(PF, P, F);
+        nmod_poly_mat_truncate(PF, order);
+
+        if (!nmod_poly_mat_is_zero(PF))
+        {
+            flint_printf("FAIL: P F != 0 mod x^order\n");
+            nmod_poly_mat_print(F, "x");
+            nmod_poly_mat_print(P, "x");
+            abort();
+        }
+
+        if (!nmod_poly_mat_is_row_reduced(P, shift))
+        {
+            flint_printf("FAIL: P is not reduced\n");
+            nmod_poly_mat_print(F, "x");
+            nmod_poly_mat_print(P, "x");
+            abort();
+        }
+
+        /* minimal bases have the same shifted row degrees */
+        nmod_poly_mat_mbasis(Q, rdeg2, F, order, shift);
+
+        for (i = 0; i < m; i++)
+        {
+            if (rdeg[i] != rdeg2[i])
+            {
+                flint_printf("FAIL: row degrees differ from mbasis\n");
+                nmod_poly_mat_print(F, "x");
+                nmod_poly_mat_print(P, "x");
+                nmod_poly_mat_print(Q, "x");
+                abort();
+            }
+        }
+
+        nmod_poly_mat_row_degree(rdeg2, P, shift);
+
+        for (i = 0; i < m; i++)
+        {
+            if (rdeg[i] != rdeg2[i])
+            {
+                flint_printf("FAIL: wrong shifted row degrees\n");
+                nmod_poly_mat_print(F, "x");
+                nmod_poly_mat_print(P, "x");
+                abort();
+            }
+        }
+
+        nmod_poly_mat_clear(F);
+        nmod_poly_mat_clear(P);
+        nmod_poly_mat_clear(Q);
+        nmod_poly_mat_clear(PF);
+        flint_free(shift);
+        flint_free(rdeg);
+        flint_free(rdeg2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
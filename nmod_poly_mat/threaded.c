@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    void (* fn)(void *, slong, slong);
+    void * arg;
+    slong start;
+    slong stop;
+}
+poly_mat_threaded_arg_t;
+
+static void *
+_nmod_poly_mat_threaded_worker(void * arg_ptr)
+{
+    poly_mat_threaded_arg_t * arg = (poly_mat_threaded_arg_t *) arg_ptr;
+
+    arg->fn(arg->arg, arg->start, arg->stop);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_nmod_poly_mat_threaded(void (* fn)(void *, slong, slong),
+                                        void * arg, slong num, slong work)
+{
+    pthread_t * threads;
+    poly_mat_threaded_arg_t * args;
+    slong k, num_threads, max_threads;
+
+    max_threads = num_threads = flint_get_num_threads();
+
+    if (work < NMOD_POLY_MAT_THREAD_CUTOFF)
+        num_threads = 1;
+
+    num_threads = FLINT_MIN(num_threads, num);
+
+    if (num_threads <= 1)
+    {
+        fn(arg, 0, num);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(poly_mat_threaded_arg_t) * num_threads);
+
+    for (k = 0; k < num_threads; k++)
+    {
+        args[k].fn = fn;
+        args[k].arg = arg;
+        args[k].start = (k * num) / num_threads;
+        args[k].stop = ((k + 1) * num) / num_threads;
+    }
+
+    for (k = 0; k < num_threads - 1; k++)
+        pthread_create(&threads[k], NULL,
+            _nmod_poly_mat_threaded_worker, &args[k]);
+
+    /* like the workers, the main thread must not spawn threads of its own */
+    flint_set_num_threads(1);
+
+    args[num_threads - 1].fn(args[num_threads - 1].arg,
+        args[num_threads - 1].start, args[num_threads - 1].stop);
+
+    flint_set_num_threads(max_threads);
+
+    for (k = 0; k < num_threads - 1; k++)
+        pthread_join(threads[k], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2015 Elena Sergeicheva
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -26,4 +27,5 @@ nmod_poly_mat_window_init(nmod_poly_mat_t window, const nmod_poly_mat_t mat, slo
 
     window->r = r2 - r1;
     window->c = c2 - c1;
+    window->modulus = mat->modulus;
 }
@@ -0,0 +1,154 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Compressed sparse row layout: the nonzero entries of row i are
+    entries[k] in column cols[k] for row_start[i] <= k < row_start[i + 1],
+    with strictly increasing column indices.
+*/
+typedef struct
+{
+    mp_ptr entries;
+    slong * cols;
+    slong * row_start;
+    slong r;
+    slong c;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+/* Memory management  ********************************************************/
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t M,
+                                        slong rows, slong cols, mp_limb_t n);
+
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t M);
+
+FLINT_DLL void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t M, slong nnz);
+
+FLINT_DLL void nmod_sparse_mat_swap(nmod_sparse_mat_t M1, nmod_sparse_mat_t M2);
+
+FLINT_DLL void nmod_sparse_mat_set(nmod_sparse_mat_t M1,
+                                                const nmod_sparse_mat_t M2);
+
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t M);
+
+/* Basic properties **********************************************************/
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t M)
+{
+    return M->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t M)
+{
+    return M->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t M)
+{
+    return M->row_start[M->r];
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_row_length(const nmod_sparse_mat_t M, slong i)
+{
+    return M->row_start[i + 1] - M->row_start[i];
+}
+
+FLINT_DLL int nmod_sparse_mat_equal(const nmod_sparse_mat_t M1,
+                                                const nmod_sparse_mat_t M2);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void nmod_sparse_mat_set_triplets(nmod_sparse_mat_t M,
+    const slong * rows, const slong * cols, mp_srcptr vals, slong len);
+
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t M,
+                                                        const nmod_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t A,
+                                                const nmod_sparse_mat_t M);
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t M,
+                                    flint_rand_t state, slong row_nnz);
+
+FLINT_DLL void nmod_sparse_mat_randtest_square(nmod_sparse_mat_t M,
+                                                        flint_rand_t state);
+
+/* Transpose and matrix-vector multiplication ********************************/
+
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                                const nmod_sparse_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y,
+                                const nmod_sparse_mat_t A, mp_srcptr x);
+
+/* Solving *******************************************************************/
+
+FLINT_DLL void nmod_sparse_mat_minpoly_projection(nmod_poly_t f,
+            const nmod_sparse_mat_t A, mp_srcptr u, mp_srcptr v);
+
+FLINT_DLL int nmod_sparse_mat_solve_minpoly(mp_ptr x,
+        const nmod_sparse_mat_t A, const nmod_poly_t f, mp_srcptr b);
+
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+                                const nmod_sparse_mat_t A, mp_srcptr b);
+
+FLINT_DLL int nmod_sparse_mat_solve_lanczos(mp_ptr x,
+                                const nmod_sparse_mat_t A, mp_srcptr b);
+
+FLINT_DLL int nmod_sparse_mat_solve_gauss(mp_ptr x,
+                                const nmod_sparse_mat_t A, mp_srcptr b);
+
+/* Tuning parameters *********************************************************/
+
+/*
+    Structured Gaussian elimination hands the remaining system to dense
+    elimination once it has at most this many rows, or once its density
+    exceeds 1 / NMOD_SPARSE_MAT_GAUSS_DENSE_RATIO.
+*/
+#define NMOD_SPARSE_MAT_GAUSS_DENSE_CUTOFF 64
+#define NMOD_SPARSE_MAT_GAUSS_DENSE_RATIO 16
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t M, slong nnz)
+{
+    if (nnz > M->alloc)
+    {
+        nnz = FLINT_MAX(nnz, 2 * M->alloc);
+
+        M->entries = flint_realloc(M->entries, nnz * sizeof(mp_limb_t));
+        M->cols = flint_realloc(M->cols, nnz * sizeof(slong));
+        M->alloc = nnz;
+    }
+}
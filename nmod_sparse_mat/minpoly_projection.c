@@ -0,0 +1,74 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod_poly.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_minpoly_projection(nmod_poly_t f, const nmod_sparse_mat_t A,
+                                                    mp_srcptr u, mp_srcptr v)
+{
+    slong i, n, len, flen;
+    mp_ptr w, t;
+    fmpz * seq, * poly;
+    fmpz_t p;
+    int nlimbs;
+
+    n = A->r;
+    len = 2 * n;
+
+    if (n == 0)
+    {
+        nmod_poly_one(f);
+        return;
+    }
+
+    w = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+    seq = _fmpz_vec_init(len);
+    poly = _fmpz_vec_init(len + 1);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
+
+    /* the sequence u^T A^i v for i < 2n is generated by the minimal
+       polynomial of v, and its minimal generator divides it */
+    _nmod_vec_set(w, v, n);
+    for (i = 0; i < len; i++)
+    {
+        fmpz_set_ui(seq + i, _nmod_vec_dot(u, w, n, A->mod, nlimbs));
+
+        if (i + 1 < len)
+        {
+            nmod_sparse_mat_mul_vec(t, A, w);
+            MP_PTR_SWAP(w, t);
+        }
+    }
+
+    fmpz_init_set_ui(p, A->mod.n);
+    flen = _fmpz_mod_poly_minpoly(poly, seq, len, p);
+
+    nmod_poly_fit_length(f, flen);
+    for (i = 0; i < flen; i++)
+        f->coeffs[i] = fmpz_get_ui(poly + i);
+    _nmod_poly_set_length(f, flen);
+    _nmod_poly_normalise(f);
+
+    fmpz_clear(p);
+    _fmpz_vec_clear(seq, len);
+    _fmpz_vec_clear(poly, len + 1);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(t);
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    slong i, j, len, maxlen;
+    int nlimbs;
+
+    maxlen = 1;
+    for (i = 0; i < A->r; i++)
+        maxlen = FLINT_MAX(maxlen, nmod_sparse_mat_row_length(A, i));
+
+    /* each row is a dot product with delayed reduction */
+    nlimbs = _nmod_vec_dot_bound_limbs(maxlen, A->mod);
+
+    for (i = 0; i < A->r; i++)
+    {
+        mp_srcptr Ai = A->entries + A->row_start[i];
+        const slong * ci = A->cols + A->row_start[i];
+
+        len = nmod_sparse_mat_row_length(A, i);
+        NMOD_VEC_DOT(y[i], j, len, Ai[j], x[ci[j]], A->mod, nlimbs);
+    }
+}
@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest_square(nmod_sparse_mat_t M, flint_rand_t state)
+{
+    slong n = M->r, k, len, row_nnz, * rows, * cols;
+    mp_ptr vals;
+
+    if (n == 0)
+    {
+        nmod_sparse_mat_zero(M);
+        return;
+    }
+
+    row_nnz = n_randint(state, 6);
+    len = n * (row_nnz + 1);
+
+    rows = flint_malloc(len * sizeof(slong));
+    cols = flint_malloc(len * sizeof(slong));
+    vals = _nmod_vec_init(len);
+
+    /* the first n triplets usually lie on the diagonal */
+    for (k = 0; k < len; k++)
+    {
+        rows[k] = k % n;
+        cols[k] = (k < n && n_randint(state, 8)) ? k : n_randint(state, n);
+        vals[k] = n_randint(state, M->mod.n);
+    }
+
+    nmod_sparse_mat_set_triplets(M, rows, cols, vals, len);
+
+    flint_free(rows);
+    flint_free(cols);
+    _nmod_vec_clear(vals);
+}
@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t M1, const nmod_sparse_mat_t M2)
+{
+    slong i, nnz;
+
+    if (M1 == M2)
+        return;
+
+    nnz = nmod_sparse_mat_nnz(M2);
+    nmod_sparse_mat_fit_nnz(M1, nnz);
+
+    for (i = 0; i <= M2->r; i++)
+        M1->row_start[i] = M2->row_start[i];
+
+    for (i = 0; i < nnz; i++)
+    {
+        M1->entries[i] = M2->entries[i];
+        M1->cols[i] = M2->cols[i];
+    }
+}
@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t M, const nmod_mat_t A)
+{
+    slong i, j, nnz;
+
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            nnz += (nmod_mat_entry(A, i, j) != 0);
+
+    nmod_sparse_mat_fit_nnz(M, nnz);
+
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        M->row_start[i] = nnz;
+
+        for (j = 0; j < A->c; j++)
+        {
+            if (nmod_mat_entry(A, i, j) != 0)
+            {
+                M->cols[nnz] = j;
+                M->entries[nnz] = nmod_mat_entry(A, i, j);
+                nnz++;
+            }
+        }
+    }
+
+    M->row_start[A->r] = nnz;
+}
@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+}
+nmod_sparse_entry_t;
+
+static int
+_nmod_sparse_entry_cmp(const void * a, const void * b)
+{
+    slong c1 = ((const nmod_sparse_entry_t *) a)->col;
+    slong c2 = ((const nmod_sparse_entry_t *) b)->col;
+
+    return (c1 > c2) - (c1 < c2);
+}
+
+void
+nmod_sparse_mat_set_triplets(nmod_sparse_mat_t M, const slong * rows,
+                        const slong * cols, mp_srcptr vals, slong len)
+{
+    nmod_sparse_entry_t * T;
+    slong * pos;
+    slong i, j, k, nnz;
+
+    /* bucket the entries by row */
+    pos = flint_calloc(M->r + 1, sizeof(slong));
+
+    for (k = 0; k < len; k++)
+        pos[rows[k] + 1]++;
+    for (i = 0; i < M->r; i++)
+        pos[i + 1] += pos[i];
+
+    T = flint_malloc(len * sizeof(nmod_sparse_entry_t));
+
+    for (k = 0; k < len; k++)
+    {
+        j = pos[rows[k]]++;
+        T[j].col = cols[k];
+        NMOD_RED(T[j].val, vals[k], M->mod);
+    }
+
+    /* pos[i] is now the end of row i, sort each row and merge duplicates */
+    nmod_sparse_mat_fit_nnz(M, len);
+
+    nnz = 0;
+    for (i = 0, j = 0; i < M->r; i++)
+    {
+        M->row_start[i] = nnz;
+
+        qsort(T + j, pos[i] - j, sizeof(nmod_sparse_entry_t),
+                                                    _nmod_sparse_entry_cmp);
+
+        while (j < pos[i])
+        {
+            mp_limb_t v = T[j].val;
+
+            for (k = j + 1; k < pos[i] && T[k].col == T[j].col; k++)
+                v = nmod_add(v, T[k].val, M->mod);
+
+            if (v != 0)
+            {
+                M->cols[nnz] = T[j].col;
+                M->entries[nnz] = v;
+                nnz++;
+            }
+
+            j = k;
+        }
+    }
+
+    M->row_start[M->r] = nnz;
+
+    flint_free(T);
+    flint_free(pos);
+}
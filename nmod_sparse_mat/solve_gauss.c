@@ -0,0 +1,424 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong * cols;
+    mp_ptr vals;
+    slong len;
+}
+sge_row_struct;
+
+typedef struct
+{
+    slong * rows;
+    slong len;
+    slong alloc;
+}
+sge_col_struct;
+
+/*
+    Columns are kept in buckets indexed by their number of entries in the
+    active rows, as doubly linked lists, so that a column of minimal count
+    is always at hand.
+*/
+typedef struct
+{
+    slong * head;
+    slong * next;
+    slong * prev;
+    slong * count;
+    slong min;
+}
+sge_buckets_struct;
+
+static void
+_bucket_remove(sge_buckets_struct * B, slong j)
+{
+    if (B->prev[j] == -1)
+        B->head[B->count[j]] = B->next[j];
+    else
+        B->next[B->prev[j]] = B->next[j];
+
+    if (B->next[j] != -1)
+        B->prev[B->next[j]] = B->prev[j];
+}
+
+static void
+_bucket_insert(sge_buckets_struct * B, slong j)
+{
+    slong c = B->count[j];
+
+    B->prev[j] = -1;
+    B->next[j] = B->head[c];
+    if (B->head[c] != -1)
+        B->prev[B->head[c]] = j;
+    B->head[c] = j;
+
+    if (c < B->min)
+        B->min = c;
+}
+
+static void
+_bucket_update(sge_buckets_struct * B, slong j, slong delta)
+{
+    _bucket_remove(B, j);
+    B->count[j] += delta;
+    _bucket_insert(B, j);
+}
+
+static void
+_col_push(sge_col_struct * C, slong i)
+{
+    if (C->len == C->alloc)
+    {
+        C->alloc = FLINT_MAX(4, 2 * C->alloc);
+        C->rows = flint_realloc(C->rows, C->alloc * sizeof(slong));
+    }
+
+    C->rows[C->len++] = i;
+}
+
+/* returns the position of column j in row R, or -1 */
+static slong
+_row_find(const sge_row_struct * R, slong j)
+{
+    slong lo = 0, hi = R->len - 1, mid;
+
+    while (lo <= hi)
+    {
+        mid = (lo + hi) / 2;
+
+        if (R->cols[mid] == j)
+            return mid;
+        else if (R->cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return -1;
+}
+
+/*
+    Replaces row R by R + f P with the entries in column c dropped, updating
+    the column counts and lists for fill-in and cancellation. Returns the
+    change in the number of entries of R.
+*/
+static slong
+_row_addmul(sge_row_struct * R, slong i, const sge_row_struct * P,
+    mp_limb_t f, slong c, sge_col_struct * cols, sge_buckets_struct * B,
+    nmod_t mod)
+{
+    slong * nc;
+    mp_ptr nv;
+    slong a, b, k, oldlen;
+    mp_limb_t v;
+
+    nc = flint_malloc((R->len + P->len) * sizeof(slong));
+    nv = flint_malloc((R->len + P->len) * sizeof(mp_limb_t));
+
+    a = b = k = 0;
+    while (a < R->len || b < P->len)
+    {
+        if (b == P->len || (a < R->len && R->cols[a] < P->cols[b]))
+        {
+            if (R->cols[a] != c)
+            {
+                nc[k] = R->cols[a];
+                nv[k++] = R->vals[a];
+            }
+            a++;
+        }
+        else if (a == R->len || P->cols[b] < R->cols[a])
+        {
+            if (P->cols[b] != c)
+            {
+                /* fill-in */
+                nc[k] = P->cols[b];
+                nv[k++] = nmod_mul(f, P->vals[b], mod);
+                _bucket_update(B, P->cols[b], 1);
+                _col_push(cols + P->cols[b], i);
+            }
+            b++;
+        }
+        else
+        {
+            if (R->cols[a] != c)
+            {
+                v = nmod_add(R->vals[a], nmod_mul(f, P->vals[b], mod), mod);
+
+                if (v != 0)
+                {
+                    nc[k] = R->cols[a];
+                    nv[k++] = v;
+                }
+                else
+                    _bucket_update(B, R->cols[a], -1);  /* cancellation */
+            }
+            a++;
+            b++;
+        }
+    }
+
+    oldlen = R->len;
+
+    flint_free(R->cols);
+    flint_free(R->vals);
+    R->cols = nc;
+    R->vals = nv;
+    R->len = k;
+
+    return k - oldlen;
+}
+
+int
+nmod_sparse_mat_solve_gauss(mp_ptr x, const nmod_sparse_mat_t A, mp_srcptr b)
+{
+    sge_row_struct * rows;
+    sge_col_struct * cols;
+    sge_buckets_struct B[1];
+    slong * piv_row, * piv_col, * stamp, * cand;
+    char * row_active, * col_active;
+    mp_ptr rhs;
+    slong n, i, j, k, r, c, num_piv, num_cand, remaining, active_nnz;
+    nmod_t mod = A->mod;
+    int result = 1;
+
+    n = A->r;
+
+    if (n == 0)
+        return 1;
+
+    rows = flint_malloc(n * sizeof(sge_row_struct));
+    cols = flint_calloc(n, sizeof(sge_col_struct));
+    B->head = flint_malloc((n + 1) * sizeof(slong));
+    B->next = flint_malloc(n * sizeof(slong));
+    B->prev = flint_malloc(n * sizeof(slong));
+    B->count = flint_calloc(n, sizeof(slong));
+    piv_row = flint_malloc(n * sizeof(slong));
+    piv_col = flint_malloc(n * sizeof(slong));
+    stamp = flint_malloc(n * sizeof(slong));
+    cand = flint_malloc(n * sizeof(slong));
+    row_active = flint_malloc(n);
+    col_active = flint_malloc(n);
+    rhs = _nmod_vec_init(n);
+
+    for (i = 0; i < n; i++)
+    {
+        slong len = nmod_sparse_mat_row_length(A, i);
+
+        rows[i].len = len;
+        rows[i].cols = flint_malloc(len * sizeof(slong));
+        rows[i].vals = flint_malloc(len * sizeof(mp_limb_t));
+
+        for (k = 0; k < len; k++)
+        {
+            j = A->cols[A->row_start[i] + k];
+            rows[i].cols[k] = j;
+            rows[i].vals[k] = A->entries[A->row_start[i] + k];
+            B->count[j]++;
+            _col_push(cols + j, i);
+        }
+
+        row_active[i] = col_active[i] = 1;
+        stamp[i] = -1;
+    }
+
+    for (i = 0; i <= n; i++)
+        B->head[i] = -1;
+    B->min = n;
+    for (j = 0; j < n; j++)
+        _bucket_insert(B, j);
+
+    _nmod_vec_set(rhs, b, n);
+
+    active_nnz = nmod_sparse_mat_nnz(A);
+    remaining = n;
+    num_piv = 0;
+
+    /*
+        Markowitz-style elimination: pivot in a column of minimal count,
+        using its shortest row, while the active part stays sparse.
+    */
+    while (remaining > NMOD_SPARSE_MAT_GAUSS_DENSE_CUTOFF &&
+        (double) active_nnz * NMOD_SPARSE_MAT_GAUSS_DENSE_RATIO
+                                        <= (double) remaining * remaining)
+    {
+        mp_limb_t inv, f;
+
+        while (B->head[B->min] == -1)
+            B->min++;
+
+        c = B->head[B->min];
+
+        if (B->count[c] == 0)
+        {
+            result = 0;
+            goto cleanup;
+        }
+
+        /* collect the active rows containing c, skipping stale entries */
+        num_cand = 0;
+        r = -1;
+        for (k = 0; k < cols[c].len; k++)
+        {
+            i = cols[c].rows[k];
+
+            if (!row_active[i] || stamp[i] == c || _row_find(rows + i, c) == -1)
+                continue;
+
+            stamp[i] = c;
+            cand[num_cand++] = i;
+
+            if (r == -1 || rows[i].len < rows[r].len)
+                r = i;
+        }
+
+        k = _row_find(rows + r, c);
+        inv = n_invmod(rows[r].vals[k], mod.n);
+
+        row_active[r] = 0;
+        col_active[c] = 0;
+        _bucket_remove(B, c);
+        active_nnz -= rows[r].len;
+
+        for (k = 0; k < rows[r].len; k++)
+            if (rows[r].cols[k] != c)
+                _bucket_update(B, rows[r].cols[k], -1);
+
+        for (k = 0; k < num_cand; k++)
+        {
+            i = cand[k];
+
+            if (i == r)
+                continue;
+
+            f = rows[i].vals[_row_find(rows + i, c)];
+            f = nmod_neg(nmod_mul(f, inv, mod), mod);
+
+            active_nnz += _row_addmul(rows + i, i, rows + r, f, c,
+                                                            cols, B, mod);
+            rhs[i] = nmod_add(rhs[i], nmod_mul(f, rhs[r], mod), mod);
+        }
+
+        flint_free(cols[c].rows);
+        cols[c].rows = NULL;
+        cols[c].len = cols[c].alloc = 0;
+
+        piv_row[num_piv] = r;
+        piv_col[num_piv] = c;
+        num_piv++;
+        remaining--;
+    }
+
+    /* solve the remaining system densely */
+    if (remaining > 0)
+    {
+        nmod_mat_t D;
+        mp_ptr y, z;
+        slong * ridx, * cidx, * cpos;
+
+        nmod_mat_init(D, remaining, remaining, mod.n);
+        y = _nmod_vec_init(remaining);
+        z = _nmod_vec_init(remaining);
+        ridx = flint_malloc(remaining * sizeof(slong));
+        cidx = flint_malloc(remaining * sizeof(slong));
+        cpos = stamp;
+
+        for (i = k = 0; i < n; i++)
+            if (row_active[i])
+                ridx[k++] = i;
+
+        for (j = k = 0; j < n; j++)
+        {
+            if (col_active[j])
+            {
+                cpos[j] = k;
+                cidx[k++] = j;
+            }
+        }
+
+        for (i = 0; i < remaining; i++)
+        {
+            sge_row_struct * R = rows + ridx[i];
+
+            for (k = 0; k < R->len; k++)
+                nmod_mat_entry(D, i, cpos[R->cols[k]]) = R->vals[k];
+
+            z[i] = rhs[ridx[i]];
+        }
+
+        result = nmod_mat_solve_vec(y, D, z);
+
+        for (j = 0; j < remaining; j++)
+            x[cidx[j]] = y[j];
+
+        nmod_mat_clear(D);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+        flint_free(ridx);
+        flint_free(cidx);
+
+        if (!result)
+            goto cleanup;
+    }
+
+    /* back substitution through the sparse pivots */
+    for (k = num_piv - 1; k >= 0; k--)
+    {
+        sge_row_struct * R = rows + piv_row[k];
+        mp_limb_t s = rhs[piv_row[k]], d = 0;
+
+        c = piv_col[k];
+
+        for (j = 0; j < R->len; j++)
+        {
+            if (R->cols[j] == c)
+                d = R->vals[j];
+            else
+                s = nmod_sub(s, nmod_mul(R->vals[j], x[R->cols[j]], mod), mod);
+        }
+
+        x[c] = nmod_mul(s, n_invmod(d, mod.n), mod);
+    }
+
+cleanup:
+
+    for (i = 0; i < n; i++)
+    {
+        flint_free(rows[i].cols);
+        flint_free(rows[i].vals);
+        flint_free(cols[i].rows);
+    }
+
+    flint_free(rows);
+    flint_free(cols);
+    flint_free(B->head);
+    flint_free(B->next);
+    flint_free(B->prev);
+    flint_free(B->count);
+    flint_free(piv_row);
+    flint_free(piv_col);
+    flint_free(stamp);
+    flint_free(cand);
+    flint_free(row_active);
+    flint_free(col_active);
+    _nmod_vec_clear(rhs);
+
+    return result;
+}
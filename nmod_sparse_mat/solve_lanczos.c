@@ -0,0 +1,162 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+/* bound on the number of random preconditioners tried */
+#define LANCZOS_MAX_ATTEMPTS 4
+
+/* sets y = A^T D A w, using t as scratch space */
+static void
+_nmod_sparse_mat_mul_vec_sym(mp_ptr y, const nmod_sparse_mat_t A,
+        const nmod_sparse_mat_t AT, mp_srcptr D, mp_srcptr w, mp_ptr t)
+{
+    slong i;
+
+    nmod_sparse_mat_mul_vec(t, A, w);
+    for (i = 0; i < A->r; i++)
+        t[i] = nmod_mul(t[i], D[i], A->mod);
+    nmod_sparse_mat_mul_vec(y, AT, t);
+}
+
+/*
+    Runs the Lanczos iteration on the symmetric system B x = c with
+    B = A^T D A, c = A^T D b. Returns 0 on a self-orthogonal breakdown.
+*/
+static int
+_nmod_sparse_mat_lanczos(mp_ptr x, const nmod_sparse_mat_t A,
+        const nmod_sparse_mat_t AT, mp_srcptr D, mp_srcptr b)
+{
+    slong i, n = A->c;
+    mp_ptr c, w, wprev, v, vprev, t;
+    mp_limb_t wv, wvprev, alpha, beta, gamma;
+    nmod_t mod = A->mod;
+    int nlimbs, result;
+
+    c = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    wprev = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    vprev = _nmod_vec_init(n);
+    t = _nmod_vec_init(A->r);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    for (i = 0; i < A->r; i++)
+        t[i] = nmod_mul(b[i], D[i], mod);
+    nmod_sparse_mat_mul_vec(c, AT, t);
+
+    _nmod_vec_zero(x, n);
+    _nmod_vec_set(w, c, n);
+    _nmod_vec_zero(wprev, n);
+    _nmod_vec_zero(vprev, n);
+    wvprev = 1;
+    result = 1;
+
+    /*
+        w_{i+1} = B w_i - (v_i, v_i) / (w_i, v_i) w_i
+                        - (v_i, v_{i-1}) / (w_{i-1}, v_{i-1}) w_{i-1}
+        with v_i = B w_i. The w_i are B-orthogonal, so the iteration ends
+        with w = 0 after at most n steps, unless (w_i, B w_i) = 0 earlier.
+    */
+    while (!_nmod_vec_is_zero(w, n))
+    {
+        _nmod_sparse_mat_mul_vec_sym(v, A, AT, D, w, t);
+
+        wv = _nmod_vec_dot(w, v, n, mod, nlimbs);
+
+        if (wv == 0)
+        {
+            result = 0;
+            break;
+        }
+
+        wv = n_invmod(wv, mod.n);
+
+        /* x += (w, c) / (w, v) w */
+        alpha = nmod_mul(_nmod_vec_dot(w, c, n, mod, nlimbs), wv, mod);
+        _nmod_vec_scalar_addmul_nmod(x, w, n, alpha, mod);
+
+        beta = nmod_mul(_nmod_vec_dot(v, v, n, mod, nlimbs), wv, mod);
+        gamma = nmod_mul(_nmod_vec_dot(v, vprev, n, mod, nlimbs), wvprev, mod);
+
+        /* wprev <- v - beta w - gamma wprev, then swap it into w */
+        _nmod_vec_scalar_mul_nmod(wprev, wprev, n, nmod_neg(gamma, mod), mod);
+        _nmod_vec_scalar_addmul_nmod(wprev, w, n, nmod_neg(beta, mod), mod);
+        _nmod_vec_add(wprev, wprev, v, n, mod);
+
+        MP_PTR_SWAP(w, wprev);
+        MP_PTR_SWAP(v, vprev);
+        wvprev = wv;
+    }
+
+    _nmod_vec_clear(c);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(wprev);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(vprev);
+    _nmod_vec_clear(t);
+
+    return result;
+}
+
+int
+nmod_sparse_mat_solve_lanczos(mp_ptr x, const nmod_sparse_mat_t A,
+                                                                mp_srcptr b)
+{
+    nmod_sparse_mat_t AT;
+    mp_ptr D, t;
+    flint_rand_t state;
+    slong i, attempt, n;
+    int result;
+
+    n = A->r;
+
+    _nmod_vec_zero(x, n);
+
+    if (_nmod_vec_is_zero(b, n))
+        return 1;
+
+    nmod_sparse_mat_init(AT, A->c, A->r, A->mod.n);
+    nmod_sparse_mat_transpose(AT, A);
+
+    D = _nmod_vec_init(n);
+    t = _nmod_vec_init(n);
+    flint_randinit(state);
+
+    /*
+        For nonsingular A and D, A^T D A x = A^T D b is equivalent to
+        A x = b. The random diagonal D makes breakdowns unlikely when the
+        modulus is large, and a final check catches the rest.
+    */
+    result = 0;
+    for (attempt = 0; attempt < LANCZOS_MAX_ATTEMPTS && !result; attempt++)
+    {
+        for (i = 0; i < n; i++)
+            D[i] = 1 + n_randint(state, A->mod.n - 1);
+
+        if (!_nmod_sparse_mat_lanczos(x, A, AT, D, b))
+            continue;
+
+        nmod_sparse_mat_mul_vec(t, A, x);
+        result = _nmod_vec_equal(t, b, n);
+    }
+
+    nmod_sparse_mat_clear(AT);
+    _nmod_vec_clear(D);
+    _nmod_vec_clear(t);
+    flint_randclear(state);
+
+    return result;
+}
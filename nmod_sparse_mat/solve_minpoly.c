@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+int
+nmod_sparse_mat_solve_minpoly(mp_ptr x, const nmod_sparse_mat_t A,
+                                        const nmod_poly_t f, mp_srcptr b)
+{
+    slong k, n, d;
+    mp_ptr t;
+    mp_limb_t c;
+
+    n = A->r;
+    d = f->length - 1;
+
+    if (d < 1 || f->coeffs[0] == 0)
+        return 0;
+
+    /*
+        From f(A) b = 0 and f(0) != 0 we get A x = b for
+        x = -f(0)^(-1) sum_{k >= 1} f_k A^(k-1) b, evaluated by Horner's rule.
+    */
+    t = _nmod_vec_init(n);
+
+    _nmod_vec_scalar_mul_nmod(x, b, n, f->coeffs[d], A->mod);
+
+    for (k = d - 1; k >= 1; k--)
+    {
+        nmod_sparse_mat_mul_vec(t, A, x);
+        _nmod_vec_scalar_addmul_nmod(t, b, n, f->coeffs[k], A->mod);
+        _nmod_vec_swap(x, t, n);
+    }
+
+    c = n_invmod(f->coeffs[0], A->mod.n);
+    c = nmod_neg(c, A->mod);
+    _nmod_vec_scalar_mul_nmod(x, x, n, c, A->mod);
+
+    _nmod_vec_clear(t);
+
+    return 1;
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+/* number of consecutive unlucky projections before giving up */
+#define WIEDEMANN_MAX_UNLUCKY 64
+
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                                mp_srcptr b)
+{
+    slong i, n, steps, unlucky;
+    mp_ptr r, u, y;
+    nmod_poly_t f;
+    flint_rand_t state;
+    int result;
+
+    n = A->r;
+
+    _nmod_vec_zero(x, n);
+
+    if (_nmod_vec_is_zero(b, n))
+        return 1;
+
+    r = _nmod_vec_init(n);
+    u = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+    nmod_poly_init_preinv(f, A->mod.n, A->mod.ninv);
+    flint_randinit(state);
+
+    /*
+        A projection u gives a divisor of the minimal polynomial of the
+        residual. If it is proper, the solution is only partial and we
+        continue with the new residual, whose minimal polynomial has
+        smaller degree, so there are at most n such steps. If u is
+        orthogonal to the whole Krylov space, which happens with
+        probability at most 1/p, the divisor is trivial and we retry.
+    */
+    _nmod_vec_set(r, b, n);
+    result = 0;
+    steps = unlucky = 0;
+
+    while (steps <= n && unlucky < WIEDEMANN_MAX_UNLUCKY)
+    {
+        for (i = 0; i < n; i++)
+            u[i] = n_randint(state, A->mod.n);
+
+        nmod_sparse_mat_minpoly_projection(f, A, u, r);
+
+        if (f->length < 2)
+        {
+            unlucky++;
+            continue;
+        }
+
+        /* a root at zero proves that A is singular */
+        if (f->coeffs[0] == 0)
+            break;
+
+        nmod_sparse_mat_solve_minpoly(y, A, f, r);
+        steps++;
+        unlucky = 0;
+
+        _nmod_vec_add(x, x, y, n, A->mod);
+
+        nmod_sparse_mat_mul_vec(y, A, x);
+        _nmod_vec_sub(r, b, y, n, A->mod);
+
+        if (_nmod_vec_is_zero(r, n))
+        {
+            result = 1;
+            break;
+        }
+    }
+
+    _nmod_vec_clear(r);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(y);
+    nmod_poly_clear(f);
+    flint_randclear(state);
+
+    return result;
+}
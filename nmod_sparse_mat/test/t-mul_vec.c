@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_mat_t A, x, y;
+        nmod_sparse_mat_t M;
+        mp_ptr z;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(x, n, 1, mod);
+        nmod_mat_init(y, m, 1, mod);
+        nmod_sparse_mat_init(M, m, n, mod);
+        z = _nmod_vec_init(m);
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, n + 1));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(x, state);
+        else
+            nmod_mat_randfull(x, state);
+
+        nmod_mat_mul(y, A, x);
+        nmod_sparse_mat_mul_vec(z, M, x->entries);
+
+        if (!_nmod_vec_equal(y->entries, z, m))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(x);
+        nmod_mat_clear(y);
+        nmod_sparse_mat_clear(M);
+        _nmod_vec_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
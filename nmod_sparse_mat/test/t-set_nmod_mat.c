@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_mat_t A, B;
+        nmod_sparse_mat_t M, N;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_sparse_mat_init(M, m, n, mod);
+        nmod_sparse_mat_init(N, m, n, mod);
+
+        nmod_mat_randtest(A, state);
+        nmod_sparse_mat_set_nmod_mat(M, A);
+        nmod_sparse_mat_get_nmod_mat(B, M);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL: dense -> sparse -> dense\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_sparse_mat_randtest(M, state, n_randint(state, 10));
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        nmod_sparse_mat_set_nmod_mat(N, A);
+
+        if (!nmod_sparse_mat_equal(M, N))
+        {
+            flint_printf("FAIL: sparse -> dense -> sparse\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_sparse_mat_clear(M);
+        nmod_sparse_mat_clear(N);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
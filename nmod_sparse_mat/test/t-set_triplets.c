@@ -0,0 +1,96 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_triplets....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_mat_t A, B;
+        nmod_sparse_mat_t M;
+        slong m, n, len, k, * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t mod;
+
+        m = 1 + n_randint(state, 20);
+        n = 1 + n_randint(state, 20);
+        len = n_randint(state, 3 * m * n);
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_sparse_mat_init(M, m, n, mod);
+
+        rows = flint_malloc(len * sizeof(slong));
+        cols = flint_malloc(len * sizeof(slong));
+        vals = _nmod_vec_init(len);
+
+        /* repeated positions are summed */
+        for (k = 0; k < len; k++)
+        {
+            rows[k] = n_randint(state, m);
+            cols[k] = n_randint(state, n);
+            vals[k] = n_randtest(state);
+
+            nmod_mat_entry(A, rows[k], cols[k]) =
+                nmod_add(nmod_mat_entry(A, rows[k], cols[k]),
+                         n_mod2_preinv(vals[k], A->mod.n, A->mod.ninv),
+                         A->mod);
+        }
+
+        nmod_sparse_mat_set_triplets(M, rows, cols, vals, len);
+        nmod_sparse_mat_get_nmod_mat(B, M);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        for (k = 0; k < nmod_sparse_mat_nnz(M); k++)
+        {
+            if (M->entries[k] == 0)
+            {
+                flint_printf("FAIL: zero entry stored\n");
+                abort();
+            }
+        }
+
+        flint_free(rows);
+        flint_free(cols);
+        _nmod_vec_clear(vals);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_sparse_mat_clear(M);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_sparse_mat_t M;
+        nmod_mat_t A;
+        mp_ptr x, b, y;
+        slong n, rank;
+        mp_limb_t mod;
+        int result;
+
+        n = 1 + n_randint(state, 100);
+        /* unlucky projections are most likely for tiny moduli */
+        if (n_randint(state, 2))
+            mod = n_nth_prime(1 + n_randint(state, 4));
+        else
+            mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(M, n, n, mod);
+        nmod_mat_init(A, n, n, mod);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+        y = _nmod_vec_init(n);
+
+        nmod_sparse_mat_randtest_square(M, state);
+        nmod_sparse_mat_get_nmod_mat(A, M);
+        rank = nmod_mat_rank(A);
+
+        /* consistent right hand side */
+        _nmod_vec_randtest(y, state, n, M->mod);
+        nmod_sparse_mat_mul_vec(b, M, y);
+
+        result = nmod_sparse_mat_solve_wiedemann(x, M, b);
+
+        if (result)
+        {
+            nmod_sparse_mat_mul_vec(y, M, x);
+
+            if (!_nmod_vec_equal(y, b, n))
+            {
+                flint_printf("FAIL: Ax != b\n");
+                nmod_mat_print_pretty(A);
+                abort();
+            }
+        }
+
+        if (!result && rank == n)
+        {
+            flint_printf("FAIL: result = %d, rank = %wd, n = %wd\n",
+                                                            result, rank, n);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(M);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -248,6 +248,9 @@ FLINT_DLL void _nmod_vec_scalar_mul_nmod_shoup(mp_ptr res, mp_srcptr vec,
 FLINT_DLL void _nmod_vec_scalar_addmul_nmod(mp_ptr res, mp_srcptr vec, 
                             slong len, mp_limb_t c, nmod_t mod);
 
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_shoup(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
 FLINT_DLL int _nmod_vec_dot_bound_limbs(slong len, nmod_t mod);
 
 
@@ -303,6 +306,59 @@ FLINT_DLL mp_limb_t _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2,
 FLINT_DLL mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong offset,
     slong len, nmod_t mod, int nlimbs);
 
+/* Runtime dispatch of SIMD kernels  *****************************************/
+
+/*
+    On x86-64 the dot product and scalar multiplication kernels have AVX2
+    versions for moduli of at most 32 bits and AVX-512 IFMA versions for
+    moduli of at most 51 bits; addition uses AVX2 for moduli below 2^63.
+    The instruction set is detected at runtime, so the library does not
+    need to be built with -mavx2. nmod_vec_set_simd_level lowers the level
+    in use, e.g. for testing the fallbacks.
+*/
+#if FLINT_BITS == 64 && defined(__x86_64__) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 6))
+#define NMOD_VEC_HAVE_SIMD 1
+#else
+#define NMOD_VEC_HAVE_SIMD 0
+#endif
+
+#define NMOD_VEC_SIMD_NONE 0
+#define NMOD_VEC_SIMD_AVX2 1
+#define NMOD_VEC_SIMD_IFMA 2
+
+/* vectors shorter than this are handled by the scalar code */
+#define NMOD_VEC_SIMD_CUTOFF 16
+
+FLINT_DLL int nmod_vec_simd_level(void);
+
+FLINT_DLL void nmod_vec_set_simd_level(int level);
+
+#if NMOD_VEC_HAVE_SIMD
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+    slong len, nmod_t mod, int nlimbs);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_ifma(mp_srcptr vec1, mp_srcptr vec2,
+    slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+    mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+    slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_ifma(mp_ptr res, mp_srcptr vec,
+    slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+    slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_ifma(mp_ptr res, mp_srcptr vec,
+    slong len, mp_limb_t c, nmod_t mod);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+/*
+    Requires mod.n < 2^63, so that the sums do not overflow. AVX2 only has
+    signed comparisons, so both sides are offset by 2^63.
+*/
+__attribute__((target("avx2")))
+void
+_nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1, mp_srcptr vec2,
+                                                    slong len, nmod_t mod)
+{
+    const __m256i sign = _mm256_set1_epi64x(WORD_MIN);
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i nsign = _mm256_xor_si256(n, sign);
+    __m256i a, b, s, t, lt;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+        b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+        s = _mm256_add_epi64(a, b);
+        t = _mm256_sub_epi64(s, n);
+        lt = _mm256_cmpgt_epi64(nsign, _mm256_xor_si256(s, sign));
+        _mm256_storeu_si256((__m256i *) (res + i),
+                                        _mm256_blendv_epi8(t, s, lt));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+#endif
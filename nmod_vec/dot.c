@@ -20,6 +20,21 @@ _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
 {
     mp_limb_t res;
     slong i;
+
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF && mod.norm >= 13)
+    {
+        int level = nmod_vec_simd_level();
+
+        /* for small moduli the AVX2 kernel is the faster one */
+        if (level >= NMOD_VEC_SIMD_AVX2 && mod.norm >= 32)
+            return _nmod_vec_dot_avx2(vec1, vec2, len, mod, nlimbs);
+
+        if (level >= NMOD_VEC_SIMD_IFMA)
+            return _nmod_vec_dot_ifma(vec1, vec2, len, mod);
+    }
+#endif
+
     NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i], mod, nlimbs);
     return res;
 }
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+/* per-lane sums of 32-bit halves stay below 2^64 for this many steps */
+#define DOT_AVX2_CHUNK (WORD(1) << 30)
+
+/* adds the four lanes of x, shifted left by sh bits, to (s2, s1, s0) */
+#define DOT_AVX2_ACCUM(s2, s1, s0, x, sh)                                   \
+    do {                                                                    \
+        mp_limb_t __t[4];                                                   \
+        int __k;                                                            \
+        _mm256_storeu_si256((__m256i *) __t, x);                            \
+        for (__k = 0; __k < 4; __k++)                                       \
+            add_sssaaaaaa(s2, s1, s0, s2, s1, s0, UWORD(0),                 \
+                (sh) ? __t[__k] >> (FLINT_BITS - (sh)) : UWORD(0),          \
+                __t[__k] << (sh));                                          \
+    } while (0)
+
+/*
+    Requires mod.n <= 2^32, so that mul_epu32 computes the products of the
+    entries exactly. Each product is split into 32-bit halves that are
+    summed separately, which cannot overflow a lane.
+*/
+__attribute__((target("avx2")))
+mp_limb_t
+_nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2, slong len,
+                                                    nmod_t mod, int nlimbs)
+{
+    const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i a0, a1, b0, b1, p0, p1, lo, hi;
+    mp_limb_t s0, s1, s2, t0, t1;
+    slong i, stop;
+
+    s0 = s1 = s2 = UWORD(0);
+    i = 0;
+
+    if (nlimbs == 1)
+    {
+        /* the whole sum fits in a limb */
+        lo = hi = _mm256_setzero_si256();
+
+        for ( ; i + 8 <= len; i += 8)
+        {
+            a0 = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+            a1 = _mm256_loadu_si256((const __m256i *) (vec1 + i + 4));
+            b0 = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+            b1 = _mm256_loadu_si256((const __m256i *) (vec2 + i + 4));
+            lo = _mm256_add_epi64(lo, _mm256_mul_epu32(a0, b0));
+            hi = _mm256_add_epi64(hi, _mm256_mul_epu32(a1, b1));
+        }
+
+        DOT_AVX2_ACCUM(s2, s1, s0, _mm256_add_epi64(lo, hi), 0);
+
+        for ( ; i < len; i++)
+            s0 += vec1[i] * vec2[i];
+
+        NMOD_RED(s0, s0, mod);
+        return s0;
+    }
+
+    while (i + 8 <= len)
+    {
+        lo = hi = _mm256_setzero_si256();
+        stop = FLINT_MIN(len, i + DOT_AVX2_CHUNK);
+
+        for ( ; i + 8 <= stop; i += 8)
+        {
+            a0 = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+            a1 = _mm256_loadu_si256((const __m256i *) (vec1 + i + 4));
+            b0 = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+            b1 = _mm256_loadu_si256((const __m256i *) (vec2 + i + 4));
+            p0 = _mm256_mul_epu32(a0, b0);
+            p1 = _mm256_mul_epu32(a1, b1);
+            lo = _mm256_add_epi64(lo, _mm256_and_si256(p0, mask));
+            hi = _mm256_add_epi64(hi, _mm256_srli_epi64(p0, 32));
+            lo = _mm256_add_epi64(lo, _mm256_and_si256(p1, mask));
+            hi = _mm256_add_epi64(hi, _mm256_srli_epi64(p1, 32));
+        }
+
+        DOT_AVX2_ACCUM(s2, s1, s0, lo, 0);
+        DOT_AVX2_ACCUM(s2, s1, s0, hi, 32);
+    }
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_sssaaaaaa(s2, s1, s0, s2, s1, s0, UWORD(0), t1, t0);
+    }
+
+    NMOD_RED(s2, s2, mod);
+    NMOD_RED3(s0, s2, s1, s0, mod);
+
+    return s0;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+/*
+    Both halves of a product of 52-bit numbers have at most 52 bits, so a
+    lane can take 2^11 of them; each step below adds two to every lane.
+*/
+#define DOT_IFMA_CHUNK (WORD(1) << 13)
+
+/* adds the eight lanes of x, shifted left by sh bits, to (s2, s1, s0) */
+#define DOT_IFMA_ACCUM(s2, s1, s0, x, sh)                                   \
+    do {                                                                    \
+        mp_limb_t __t[8];                                                   \
+        int __k;                                                            \
+        _mm512_storeu_si512((void *) __t, x);                               \
+        for (__k = 0; __k < 8; __k++)                                       \
+            add_sssaaaaaa(s2, s1, s0, s2, s1, s0, UWORD(0),                 \
+                (sh) ? __t[__k] >> (FLINT_BITS - (sh)) : UWORD(0),          \
+                __t[__k] << (sh));                                          \
+    } while (0)
+
+/*
+    Requires mod.n < 2^51. The 104-bit products are formed by the 52-bit
+    multiply-add instructions as a low and a high half, summed separately.
+*/
+__attribute__((target("avx512f,avx512ifma")))
+mp_limb_t
+_nmod_vec_dot_ifma(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod)
+{
+    __m512i a0, a1, b0, b1, lo, hi;
+    mp_limb_t s0, s1, s2, t0, t1;
+    slong i, stop;
+
+    s0 = s1 = s2 = UWORD(0);
+    i = 0;
+
+    while (i + 16 <= len)
+    {
+        lo = hi = _mm512_setzero_si512();
+        stop = FLINT_MIN(len, i + DOT_IFMA_CHUNK);
+
+        for ( ; i + 16 <= stop; i += 16)
+        {
+            a0 = _mm512_loadu_si512((const void *) (vec1 + i));
+            a1 = _mm512_loadu_si512((const void *) (vec1 + i + 8));
+            b0 = _mm512_loadu_si512((const void *) (vec2 + i));
+            b1 = _mm512_loadu_si512((const void *) (vec2 + i + 8));
+            lo = _mm512_madd52lo_epu64(lo, a0, b0);
+            hi = _mm512_madd52hi_epu64(hi, a0, b0);
+            lo = _mm512_madd52lo_epu64(lo, a1, b1);
+            hi = _mm512_madd52hi_epu64(hi, a1, b1);
+        }
+
+        DOT_IFMA_ACCUM(s2, s1, s0, lo, 0);
+        DOT_IFMA_ACCUM(s2, s1, s0, hi, 52);
+    }
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_sssaaaaaa(s2, s1, s0, s2, s1, s0, UWORD(0), t1, t0);
+    }
+
+    NMOD_RED(s2, s2, mod);
+    NMOD_RED3(s0, s2, s1, s0, mod);
+
+    return s0;
+}
+
+#endif
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -18,11 +19,34 @@
 void _nmod_vec_scalar_addmul_nmod(mp_ptr res, mp_srcptr vec, 
 				             slong len, mp_limb_t c, nmod_t mod)
 {
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF && mod.norm >= 13)
+    {
+        int level = nmod_vec_simd_level();
+
+        if (level >= NMOD_VEC_SIMD_IFMA)
+        {
+            _nmod_vec_scalar_addmul_nmod_ifma(res, vec, len, c, mod);
+            return;
+        }
+
+        if (level >= NMOD_VEC_SIMD_AVX2 && mod.norm >= 32)
+        {
+            _nmod_vec_scalar_addmul_nmod_avx2(res, vec, len, c, mod);
+            return;
+        }
+    }
+#endif
+
     if (mod.norm >= FLINT_BITS/2) /* addmul will fit in a limb */
     {
         mpn_addmul_1(res, vec, len, c);
         _nmod_vec_reduce(res, res, len, mod);
     }
+    else if (len > 10 && mod.n < UWORD_HALF)
+    {
+        _nmod_vec_scalar_addmul_nmod_shoup(res, vec, len, c, mod);
+    }
     else /* products may take two limbs */
     {
         slong i;
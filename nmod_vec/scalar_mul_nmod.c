@@ -18,6 +18,25 @@
 void _nmod_vec_scalar_mul_nmod(mp_ptr res, mp_srcptr vec, 
                                slong len, mp_limb_t c, nmod_t mod)
 {
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF && mod.norm >= 13)
+    {
+        int level = nmod_vec_simd_level();
+
+        if (level >= NMOD_VEC_SIMD_IFMA)
+        {
+            _nmod_vec_scalar_mul_nmod_ifma(res, vec, len, c, mod);
+            return;
+        }
+
+        if (level >= NMOD_VEC_SIMD_AVX2 && mod.norm >= 32)
+        {
+            _nmod_vec_scalar_mul_nmod_avx2(res, vec, len, c, mod);
+            return;
+        }
+    }
+#endif
+
     if (len > 10 && mod.n < UWORD_HALF)
     {
         _nmod_vec_scalar_mul_nmod_shoup(res, vec, len, c, mod);
@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+/*
+    Requires mod.n < 2^32. Uses Shoup's method with the 32-bit precomputed
+    quotient floor(c 2^32 / n), so that every product is computed exactly
+    by mul_epu32 and the remainder lies in [0, 2n).
+*/
+__attribute__((target("avx2")))
+void
+_nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                                    slong len, mp_limb_t c, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i w = _mm256_set1_epi64x(c);
+    const __m256i wpre = _mm256_set1_epi64x((c << 32) / mod.n);
+    __m256i a, q, r;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec + i));
+        q = _mm256_srli_epi64(_mm256_mul_epu32(a, wpre), 32);
+        r = _mm256_sub_epi64(_mm256_mul_epu32(a, w), _mm256_mul_epu32(q, n));
+        r = _mm256_blendv_epi8(_mm256_sub_epi64(r, n), r,
+                                            _mm256_cmpgt_epi64(n, r));
+        _mm256_storeu_si256((__m256i *) (res + i), r);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = n_mulmod2_preinv(vec[i], c, mod.n, mod.ninv);
+}
+
+#endif
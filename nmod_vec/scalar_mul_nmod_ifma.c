@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+/*
+    Requires mod.n < 2^51. Uses Shoup's method with the 52-bit precomputed
+    quotient floor(c 2^52 / n); the remainder lies in [0, 2n), so it is
+    determined by the low 52 bits of the products.
+*/
+__attribute__((target("avx512f,avx512ifma")))
+void
+_nmod_vec_scalar_mul_nmod_ifma(mp_ptr res, mp_srcptr vec,
+                                    slong len, mp_limb_t c, nmod_t mod)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64((WORD(1) << 52) - 1);
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    const __m512i w = _mm512_set1_epi64(c);
+    __m512i wpre, a, q, r;
+    mp_limb_t pre, rem;
+    slong i;
+
+    udiv_qrnnd(pre, rem, c >> 12, c << 52, mod.n);
+    wpre = _mm512_set1_epi64(pre);
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512((const void *) (vec + i));
+        q = _mm512_madd52hi_epu64(zero, a, wpre);
+        r = _mm512_sub_epi64(_mm512_madd52lo_epu64(zero, a, w),
+                             _mm512_madd52lo_epu64(zero, q, n));
+        r = _mm512_and_si512(r, mask);
+        r = _mm512_min_epu64(r, _mm512_sub_epi64(r, n));
+        _mm512_storeu_si512((void *) (res + i), r);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = n_mulmod2_preinv(vec[i], c, mod.n, mod.ninv);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+static int _nmod_vec_simd_level_max = -1;
+static int _nmod_vec_simd_level = -1;
+
+static void
+_nmod_vec_simd_level_detect(void)
+{
+    int level = NMOD_VEC_SIMD_NONE;
+
+#if NMOD_VEC_HAVE_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        level = NMOD_VEC_SIMD_AVX2;
+
+    if (level == NMOD_VEC_SIMD_AVX2 && __builtin_cpu_supports("avx512f")
+                                    && __builtin_cpu_supports("avx512ifma"))
+        level = NMOD_VEC_SIMD_IFMA;
+#endif
+
+    _nmod_vec_simd_level_max = level;
+    _nmod_vec_simd_level = level;
+}
+
+int
+nmod_vec_simd_level(void)
+{
+    if (_nmod_vec_simd_level < 0)
+        _nmod_vec_simd_level_detect();
+
+    return _nmod_vec_simd_level;
+}
+
+void
+nmod_vec_set_simd_level(int level)
+{
+    if (_nmod_vec_simd_level_max < 0)
+        _nmod_vec_simd_level_detect();
+
+    _nmod_vec_simd_level = FLINT_MAX(NMOD_VEC_SIMD_NONE,
+                            FLINT_MIN(level, _nmod_vec_simd_level_max));
+}
@@ -36,6 +36,8 @@ main(void)
         mpz_t s, t;
         slong j;
 
+        nmod_vec_set_simd_level(n_randint(state, NMOD_VEC_SIMD_IFMA + 1));
+
         len = n_randint(state, 1000) + 1;
         m = n_randtest_not_zero(state);
 
@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+/* compares the kernels at every supported SIMD level with the scalar code */
+int
+main(void)
+{
+    int i, level, max_level;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("simd_level....");
+    fflush(stdout);
+
+    max_level = nmod_vec_simd_level();
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len;
+        nmod_t mod;
+        mp_limb_t n, c, d1, d2;
+        mp_ptr x, y, r1, r2;
+        int nlimbs;
+
+        /* occasionally long enough to flush the dot product accumulators */
+        if (n_randint(state, 50) == 0)
+            len = n_randint(state, 40000) + 1;
+        else
+            len = n_randint(state, 300) + 1;
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                n = n_randtest_bits(state, 1 + n_randint(state, 32));
+                break;
+            case 1:
+                n = n_randtest_bits(state, 1 + n_randint(state, 51));
+                break;
+            case 2:
+                n = (UWORD(1) << (1 + n_randint(state, FLINT_BITS - 1))) - 1;
+                break;
+            default:
+                n = n_randtest_not_zero(state);
+        }
+
+        nmod_init(&mod, n);
+        c = n_randint(state, n);
+
+        x = _nmod_vec_init(len);
+        y = _nmod_vec_init(len);
+        r1 = _nmod_vec_init(len);
+        r2 = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(x, state, len, mod);
+        _nmod_vec_randtest(y, state, len, mod);
+        nlimbs = _nmod_vec_dot_bound_limbs(len, mod);
+
+        for (level = NMOD_VEC_SIMD_AVX2; level <= max_level; level++)
+        {
+            nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            d1 = _nmod_vec_dot(x, y, len, mod, nlimbs);
+            nmod_vec_set_simd_level(level);
+            d2 = _nmod_vec_dot(x, y, len, mod, nlimbs);
+
+            if (d1 != d2)
+            {
+                flint_printf("FAIL (dot):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_add(r1, x, y, len, mod);
+            nmod_vec_set_simd_level(level);
+            _nmod_vec_add(r2, x, y, len, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (add):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_scalar_mul_nmod(r1, x, len, c, mod);
+            nmod_vec_set_simd_level(level);
+            _nmod_vec_scalar_mul_nmod(r2, x, len, c, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (scalar_mul_nmod):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            _nmod_vec_set(r1, y, len);
+            _nmod_vec_set(r2, y, len);
+            nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_scalar_addmul_nmod(r1, x, len, c, mod);
+            nmod_vec_set_simd_level(level);
+            _nmod_vec_scalar_addmul_nmod(r2, x, len, c, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (scalar_addmul_nmod):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+        }
+
+        nmod_vec_set_simd_level(max_level);
+
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(r1);
+        _nmod_vec_clear(r2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
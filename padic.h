@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011, 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -42,6 +43,10 @@
 #define PADIC_TEST_PREC_MIN WORD(-100)
 #define PADIC_TEST_PREC_MAX  WORD(100)
 
+/* Number of series terms below which the binary splitting trees of 
+   exp and log are no longer divided between threads */
+#define PADIC_BSPLIT_THREAD_CUTOFF 64
+
 typedef struct {
     fmpz u;
     slong v;
@@ -177,6 +182,12 @@ FLINT_DLL void _padic_reduce(padic_t rop, const padic_ctx_t ctx);
 
 FLINT_DLL void padic_reduce(padic_t rop, const padic_ctx_t ctx);
 
+FLINT_DLL void _padic_vec_reduce(fmpz * vec, slong * val, slong len, 
+                                 slong N, const padic_ctx_t ctx);
+
+FLINT_DLL void _padic_vec_reduce_lazy(fmpz * vec, slong * val, slong len, 
+                                      slong N, const padic_ctx_t ctx);
+
 /* Randomisation *************************************************************/
 
 FLINT_DLL void padic_randtest(padic_t rop, flint_rand_t state, const padic_ctx_t ctx);
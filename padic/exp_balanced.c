@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -10,6 +11,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "padic.h"
 
 /*
@@ -79,27 +81,26 @@ _padic_exp_bsplit_series(fmpz_t P, fmpz_t Q, fmpz_t T,
     Assumes that $v = \ord_p(x)$ with $v < N$, 
     which also forces $N$ to positive.
 
-    The result $y$ might not be reduced modulo $p^N$.
-
-    Supports aliasing between $x$ and $y$.
+    Sets $(T, Q)$ to a fraction equal to $\exp(x)$ modulo $p^N$, 
+    where $T$ and $Q$ are units which might not be reduced modulo $p^N$.
  */
 
 static void
-_padic_exp_bsplit(fmpz_t y, const fmpz_t x, slong v, const fmpz_t p, slong N)
+_padic_exp_bsplit(fmpz_t T, fmpz_t Q, const fmpz_t x, slong v, 
+                  const fmpz_t p, slong N)
 {
     const slong n = _padic_exp_bound(v, N, p);
 
     if (n == 1)
     {
-        fmpz_one(y);
+        fmpz_one(T);
+        fmpz_one(Q);
     }
     else
     {
-        fmpz_t P, Q, T;
+        fmpz_t P;
 
         fmpz_init(P);
-        fmpz_init(Q);
-        fmpz_init(T);
 
         _padic_exp_bsplit_series(P, Q, T, x, 1, n);
 
@@ -109,93 +110,196 @@ _padic_exp_bsplit(fmpz_t y, const fmpz_t x, slong v, const fmpz_t p, slong N)
         if (fmpz_remove(T, T, p))
             fmpz_remove(Q, Q, p);
 
-        _padic_inv(Q, Q, p, N);
-        fmpz_mul(y, T, Q);
-
         fmpz_clear(P);
-        fmpz_clear(Q);
-        fmpz_clear(T);
     }
 }
 
+typedef struct
+{
+    fmpz * T;
+    fmpz * Q;
+    const fmpz * r;
+    const slong * w;
+    slong num;
+    slong start;
+    slong step;
+    const fmpz * p;
+    const fmpz * pN;
+    slong N;
+}
+padic_exp_arg_t;
+
+static void
+_padic_exp_blocks(padic_exp_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->start; i < arg->num; i += arg->step)
+    {
+        _padic_exp_bsplit(arg->T + i, arg->Q + i, arg->r + i, arg->w[i], 
+                          arg->p, arg->N);
+        fmpz_mod(arg->T + i, arg->T + i, arg->pN);
+        fmpz_mod(arg->Q + i, arg->Q + i, arg->pN);
+    }
+}
+
+static void *
+_padic_exp_blocks_worker(void * arg_ptr)
+{
+    _padic_exp_blocks((padic_exp_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Sets rop to the product of $\exp(r_i)$ modulo $p^N$ for the 
+    num blocks $r_i$ of valuation at least $w_i$.
+
+    The blocks are independent, so their series are evaluated in 
+    parallel, and only the product of the denominators is inverted.
+ */
+
+static void
+_padic_exp_product(fmpz_t rop, const fmpz * r, const slong * w, slong num, 
+                   const fmpz_t p, slong N, const fmpz_t pN)
+{
+    pthread_t * threads;
+    padic_exp_arg_t * args;
+    fmpz * T, * Q;
+    slong i, num_threads;
+
+    if (num == 0)
+    {
+        fmpz_one(rop);
+        return;
+    }
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num);
+
+    T = _fmpz_vec_init(num);
+    Q = _fmpz_vec_init(num);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(padic_exp_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].T = T;
+        args[i].Q = Q;
+        args[i].r = r;
+        args[i].w = w;
+        args[i].num = num;
+        args[i].start = i;
+        args[i].step = num_threads;
+        args[i].p = p;
+        args[i].pN = pN;
+        args[i].N = N;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL, _padic_exp_blocks_worker, &args[i]);
+
+    _padic_exp_blocks(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    for (i = 1; i < num; i++)
+    {
+        fmpz_mul(T + 0, T + 0, T + i);
+        fmpz_mod(T + 0, T + 0, pN);
+        fmpz_mul(Q + 0, Q + 0, Q + i);
+        fmpz_mod(Q + 0, Q + 0, pN);
+    }
+
+    _padic_inv(Q + 0, Q + 0, p, N);
+    fmpz_mul(rop, T + 0, Q + 0);
+    fmpz_mod(rop, rop, pN);
+
+    _fmpz_vec_clear(T, num);
+    _fmpz_vec_clear(Q, num);
+    flint_free(threads);
+    flint_free(args);
+}
+
 void _padic_exp_balanced_2(fmpz_t rop, const fmpz_t xu, slong xv, slong N)
 {
     const fmpz_t p = {WORD(2)};
 
-    fmpz_t r, t;
-    slong w;
+    fmpz_t t, pN;
+    fmpz r[FLINT_BITS];
+    slong w[FLINT_BITS];
+    slong i, num;
 
-    fmpz_init(r);
     fmpz_init(t);
+    fmpz_init(pN);
+    for (i = 0; i < FLINT_BITS; i++)
+        fmpz_init(r + i);
 
-    w = 1;
+    fmpz_one(pN);
+    fmpz_mul_2exp(pN, pN, N);
 
     fmpz_mul_2exp(t, xu, xv);
     fmpz_fdiv_r_2exp(t, t, N);
 
-    fmpz_one(rop);
-
-    while (!fmpz_is_zero(t))
+    /* split x into blocks of valuation w and 2 w digits */
+    for (i = 1, num = 0; !fmpz_is_zero(t); i *= 2)
     {
-        fmpz_fdiv_r_2exp(r, t, 2*w);
-        fmpz_sub(t, t, r);
+        fmpz_fdiv_r_2exp(r + num, t, 2*i);
+        fmpz_sub(t, t, r + num);
 
-        if (!fmpz_is_zero(r))
-        {
-            _padic_exp_bsplit(r, r, w, p, N);
-            fmpz_mul(rop, rop, r);
-            fmpz_fdiv_r_2exp(rop, rop, N);
-        }
-
-        w *= 2;
+        if (!fmpz_is_zero(r + num))
+            w[num++] = i;
     }
 
-    fmpz_clear(r);
+    _padic_exp_product(rop, r, w, num, p, N, pN);
+
     fmpz_clear(t);
+    fmpz_clear(pN);
+    for (i = 0; i < FLINT_BITS; i++)
+        fmpz_clear(r + i);
 }
 
 void _padic_exp_balanced_p(fmpz_t rop, const fmpz_t xu, slong xv, 
                                        const fmpz_t p, slong N)
 {
-    fmpz_t r, t, pw, pN;
-    slong w;
+    fmpz_t t, pw, pN;
+    fmpz r[FLINT_BITS];
+    slong w[FLINT_BITS];
+    slong i, num;
 
-    fmpz_init(r);
     fmpz_init(t);
     fmpz_init(pw);
     fmpz_init(pN);
+    for (i = 0; i < FLINT_BITS; i++)
+        fmpz_init(r + i);
 
     fmpz_set(pw, p);
     fmpz_pow_ui(pN, p, N);
-    w = 1;
 
     fmpz_pow_ui(t, p, xv);
     fmpz_mul(t, t, xu);
     fmpz_mod(t, t, pN);
 
-    fmpz_one(rop);
-
-    while (!fmpz_is_zero(t))
+    /* split x into blocks of valuation w and 2 w digits */
+    for (i = 1, num = 0; !fmpz_is_zero(t); i *= 2)
     {
         fmpz_mul(pw, pw, pw);
 
-        fmpz_fdiv_r(r, t, pw);
-        fmpz_sub(t, t, r);
-
-        if (!fmpz_is_zero(r))
-        {
-            _padic_exp_bsplit(r, r, w, p, N);
-            fmpz_mul(rop, rop, r);
-            fmpz_mod(rop, rop, pN);
-        }
+        fmpz_fdiv_r(r + num, t, pw);
+        fmpz_sub(t, t, r + num);
 
-        w *= 2;
+        if (!fmpz_is_zero(r + num))
+            w[num++] = i;
     }
 
-    fmpz_clear(r);
+    _padic_exp_product(rop, r, w, num, p, N, pN);
+
     fmpz_clear(t);
     fmpz_clear(pw);
     fmpz_clear(pN);
+    for (i = 0; i < FLINT_BITS; i++)
+        fmpz_clear(r + i);
 }
 
 /*
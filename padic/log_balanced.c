@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -10,12 +11,49 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "padic.h"
 #include "ulong_extras.h"
 
 static void
 _padic_log_bsplit_series(fmpz_t P, fmpz_t B, fmpz_t T, 
-                         const fmpz_t x, slong a, slong b)
+                         const fmpz_t x, slong a, slong b, slong thread_limit);
+
+typedef struct
+{
+    fmpz * P;
+    fmpz * B;
+    fmpz * T;
+    const fmpz * x;
+    slong a;
+    slong b;
+    slong thread_limit;
+}
+padic_log_bsplit_arg_t;
+
+static void *
+_padic_log_bsplit_series_worker(void * arg_ptr)
+{
+    padic_log_bsplit_arg_t * arg = (padic_log_bsplit_arg_t *) arg_ptr;
+
+    _padic_log_bsplit_series(arg->P, arg->B, arg->T, arg->x, 
+                             arg->a, arg->b, arg->thread_limit);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Evaluates the series over $a \leq i < b$ by binary splitting.
+
+    While thread_limit is larger than one and the range is long 
+    enough, the left half of the product tree is evaluated in 
+    a separate thread.
+ */
+
+static void
+_padic_log_bsplit_series(fmpz_t P, fmpz_t B, fmpz_t T, 
+                         const fmpz_t x, slong a, slong b, slong thread_limit)
 {
     if (b - a == 1)
     {
@@ -37,13 +75,36 @@ _padic_log_bsplit_series(fmpz_t P, fmpz_t B, fmpz_t T,
 
         fmpz_t RP, RB, RT;
 
-        _padic_log_bsplit_series(P, B, T, x, a, m);
-
         fmpz_init(RP);
         fmpz_init(RB);
         fmpz_init(RT);
 
-        _padic_log_bsplit_series(RP, RB, RT, x, m, b);
+        if (thread_limit > 1 && b - a >= PADIC_BSPLIT_THREAD_CUTOFF)
+        {
+            pthread_t thread;
+            padic_log_bsplit_arg_t arg;
+
+            arg.P = P;
+            arg.B = B;
+            arg.T = T;
+            arg.x = x;
+            arg.a = a;
+            arg.b = m;
+            arg.thread_limit = thread_limit / 2;
+
+            pthread_create(&thread, NULL, _padic_log_bsplit_series_worker, 
+                           &arg);
+
+            _padic_log_bsplit_series(RP, RB, RT, x, m, b, 
+                                     thread_limit - thread_limit / 2);
+
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            _padic_log_bsplit_series(P, B, T, x, a, m, 1);
+            _padic_log_bsplit_series(RP, RB, RT, x, m, b, 1);
+        }
 
         fmpz_mul(RT, RT, P);
         fmpz_mul(T, T, RB);
@@ -66,11 +127,14 @@ _padic_log_bsplit_series(fmpz_t P, fmpz_t B, fmpz_t T,
 
     The result $z$ might not be reduced modulo $p^N$.
 
+    Uses the precomputed data $S$ for inversion modulo $p^N$.
+
     Supports aliasing between $y$ and $z$.
  */
 
 static void 
-_padic_log_bsplit(fmpz_t z, const fmpz_t y, slong v, const fmpz_t p, slong N)
+_padic_log_bsplit(fmpz_t z, const fmpz_t y, slong v, const fmpz_t p, slong N, 
+                  const padic_inv_t S)
 {
     fmpz_t P, B, T;
     slong k, n;
@@ -82,13 +146,13 @@ _padic_log_bsplit(fmpz_t z, const fmpz_t y, slong v, const fmpz_t p, slong N)
     fmpz_init(B);
     fmpz_init(T);
 
-    _padic_log_bsplit_series(P, B, T, y, 1, n);
+    _padic_log_bsplit_series(P, B, T, y, 1, n, flint_get_num_threads());
 
     k = fmpz_remove(B, B, p);
     fmpz_pow_ui(P, p, k);
     fmpz_divexact(T, T, P);
 
-    _padic_inv(B, B, p, N);
+    _padic_inv_precomp(B, B, S);
     fmpz_mul(z, T, B);
 
     fmpz_clear(P);
@@ -133,7 +197,7 @@ _padic_log_balanced(fmpz_t z, const fmpz_t y, slong v, const fmpz_t p, slong N)
 
         if (!fmpz_is_zero(r))
         {
-            _padic_log_bsplit(r, r, w, p, N);
+            _padic_log_bsplit(r, r, w, p, N, S);
             fmpz_sub(z, z, r);
         }
         w *= 2;
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Benchmarks for the balanced p-adic exponential and logarithm 
+    with several threads.
+
+    We consider the set-up with p = 17, N = 2^i, i = 10, ..., 17, 
+    and compute the exponential of d = 17 a and the logarithm of 
+    1 + d, where a = 3^{3 N} mod p^N.  Wall times are reported in 
+    milliseconds for 1, 2, 4 and 8 threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "flint.h"
+#include "fmpz.h"
+#include "padic.h"
+#include "profiler.h"
+
+int
+main(void)
+{
+    slong i, k, n;
+    slong threads[] = {1, 2, 4, 8};
+    fmpz_t p;
+
+    fmpz_init_set_ui(p, 17);
+
+    flint_printf("Benchmark for p-adic exp and log (balanced), threaded.\n");
+    flint_printf("     N  threads      exp      log\n");
+    fflush(stdout);
+
+    for (i = 10; i <= 17; i++)
+    {
+        padic_ctx_t ctx;
+        padic_t d, e, z;
+        fmpz_t f, pow;
+
+        n = WORD(1) << i;
+
+        padic_ctx_init(ctx, p, 0, 0, PADIC_SERIES);
+
+        padic_init2(d, n);
+        padic_init2(e, n);
+        padic_init2(z, n);
+        fmpz_init_set_ui(f, 3);
+        fmpz_init(pow);
+
+        fmpz_pow_ui(pow, p, n - 1);
+        fmpz_pow_ui(padic_unit(d), f, 3 * n);
+        fmpz_mod(padic_unit(d), padic_unit(d), pow);
+        padic_val(d) = 1;
+        padic_reduce(d, ctx);
+
+        padic_one(e);
+        padic_add(e, e, d, ctx);
+
+        for (k = 0; k < 4; k++)
+        {
+            timeit_t t0, t1;
+
+            flint_set_num_threads(threads[k]);
+
+            timeit_start(t0);
+            padic_exp_balanced(z, d, ctx);
+            timeit_stop(t0);
+
+            timeit_start(t1);
+            padic_log_balanced(z, e, ctx);
+            timeit_stop(t1);
+
+            flint_printf("%6wd  %7wd  %7wd  %7wd\n", n, threads[k], 
+                         t0->wall, t1->wall);
+        }
+
+        padic_clear(d);
+        padic_clear(e);
+        padic_clear(z);
+        fmpz_clear(f);
+        fmpz_clear(pow);
+        padic_ctx_clear(ctx);
+    }
+
+    fmpz_clear(p);
+    flint_cleanup();
+    return 0;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011, 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -235,6 +236,59 @@ main(void)
         padic_ctx_clear(ctx);
     }
 
+    /* Compare with rectangular at larger precision, using threads */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, pN;
+        slong N;
+        padic_ctx_t ctx;
+
+        padic_t a, b, c;
+        int ans1, ans2;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 4), 1));
+        fmpz_init(pN);
+
+        N = n_randint(state, 1000) + 100;
+
+        padic_ctx_init(ctx, p, 0, 0, PADIC_SERIES);
+
+        padic_init2(a, N);
+        padic_init2(b, N);
+        padic_init2(c, N);
+
+        fmpz_pow_ui(pN, p, N);
+        fmpz_randm(padic_unit(a), state, pN);
+        padic_val(a) = fmpz_equal_ui(p, 2) ? 2 : 1;
+        padic_reduce(a, ctx);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        ans1 = padic_exp_balanced(b, a, ctx);
+        ans2 = padic_exp_rectangular(c, a, ctx);
+
+        flint_set_num_threads(1);
+
+        result = (ans1 && ans2 && padic_equal(b, c));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n\n");
+            flint_printf("N = %wd\n", N);
+            flint_printf("a = "), padic_print(a, ctx), flint_printf("\n");
+            flint_printf("b = "), padic_print(b, ctx), flint_printf("\n");
+            flint_printf("c = "), padic_print(c, ctx), flint_printf("\n");
+            abort();
+        }
+
+        padic_clear(a);
+        padic_clear(b);
+        padic_clear(c);
+
+        fmpz_clear(p);
+        fmpz_clear(pN);
+        padic_ctx_clear(ctx);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
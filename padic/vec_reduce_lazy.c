@@ -0,0 +1,65 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod.h"
+#include "padic.h"
+
+void _padic_vec_reduce_lazy(fmpz * vec, slong * val, slong len, 
+                            slong N, const padic_ctx_t ctx)
+{
+    if (*val >= N)
+    {
+        _fmpz_vec_zero(vec, len);
+        *val = 0;
+    }
+    else
+    {
+        fmpz_t pow;
+        int alloc;
+        slong bits, limit;
+
+        alloc = _padic_ctx_pow_ui(pow, N - *val, ctx);
+
+        /*
+            Entries are left alone while they fit into twice the size 
+            of the modulus, or into a small fmpz, so that sums and 
+            products of lazy operands can still be reduced cheaply
+        */
+        bits  = FLINT_ABS(_fmpz_vec_max_bits(vec, len));
+        limit = FLINT_MAX(2 * fmpz_bits(pow), FLINT_BITS - 2);
+
+        if (bits > limit)
+        {
+            if (_fmpz_mod_use_ctx(pow, len))
+            {
+                fmpz_mod_ctx_t mod;
+
+                fmpz_mod_ctx_init(mod, pow);
+                _fmpz_mod_vec_set_fmpz_vec(vec, vec, len, mod);
+                fmpz_mod_ctx_clear(mod);
+            }
+            else
+            {
+                _fmpz_vec_scalar_mod_fmpz(vec, vec, len, pow);
+            }
+
+            if (_fmpz_vec_is_zero(vec, len))
+                *val = 0;
+        }
+        else if (bits == 0)
+        {
+            *val = 0;
+        }
+
+        if (alloc)
+            fmpz_clear(pow);
+    }
+}
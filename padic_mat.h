@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011, 2012, 2013 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -249,6 +250,12 @@ FLINT_DLL void _padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_ma
 FLINT_DLL void padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_mat_t B, 
                                   const padic_ctx_t ctx);
 
+FLINT_DLL void padic_mat_add_lazy(padic_mat_t C, const padic_mat_t A, 
+                                  const padic_mat_t B, const padic_ctx_t ctx);
+
+FLINT_DLL void padic_mat_sub_lazy(padic_mat_t C, const padic_mat_t A, 
+                                  const padic_mat_t B, const padic_ctx_t ctx);
+
 FLINT_DLL void _padic_mat_neg(padic_mat_t B, const padic_mat_t A);
 FLINT_DLL void padic_mat_neg(padic_mat_t B, const padic_mat_t A, const padic_ctx_t ctx);
 
@@ -277,6 +284,9 @@ FLINT_DLL void padic_mat_scalar_div_fmpz(padic_mat_t B,
 FLINT_DLL void padic_mat_mul(padic_mat_t C, const padic_mat_t A, const padic_mat_t B, 
                                   const padic_ctx_t ctx);
 
+FLINT_DLL void padic_mat_mul_lazy(padic_mat_t C, const padic_mat_t A, 
+                                  const padic_mat_t B, const padic_ctx_t ctx);
+
 #ifdef __cplusplus
 }
 #endif
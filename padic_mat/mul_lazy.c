@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+#include "padic_mat.h"
+
+void padic_mat_mul_lazy(padic_mat_t C, const padic_mat_t A, 
+                        const padic_mat_t B, const padic_ctx_t ctx)
+{
+    if (padic_mat_is_empty(C))
+    {
+        return;
+    }
+
+    if (padic_mat_is_zero(A) || padic_mat_is_zero(B) || 
+        padic_mat_val(A) + padic_mat_val(B) >= padic_mat_prec(C))
+    {
+        padic_mat_zero(C);
+    }
+    else
+    {
+        const slong val = padic_mat_val(A) + padic_mat_val(B);
+
+        fmpz_mat_mul(padic_mat(C), padic_mat(A), padic_mat(B));
+        padic_mat_val(C) = val;
+
+        _padic_vec_reduce_lazy(padic_mat(C)->entries, &(padic_mat_val(C)), 
+                               padic_mat_nrows(C) * padic_mat_ncols(C), 
+                               padic_mat_prec(C), ctx);
+    }
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -16,35 +17,18 @@ void _padic_mat_reduce(padic_mat_t mat, const padic_ctx_t ctx)
 {
     if (!padic_mat_is_empty(mat) && !padic_mat_is_zero(mat))
     {
-        if (mat->val >= padic_mat_prec(mat))
-        {
-            padic_mat_zero(mat);
-        }
-        else
-        {
-            slong i;
-            fmpz_t pow;
-
-            fmpz_init(pow);
-            fmpz_pow_ui(pow, ctx->p, padic_mat_prec(mat) - mat->val);
-            for (i = 0; i < padic_mat(mat)->r * padic_mat(mat)->c; i++)
-            {
-                fmpz_mod(padic_mat(mat)->entries + i, 
-                         padic_mat(mat)->entries + i, pow);
-            }
-            fmpz_clear(pow);
-
-            if (padic_mat_is_zero(mat))
-            {
-                mat->val = 0;
-            }
-        }
+        _padic_vec_reduce(padic_mat(mat)->entries, &(mat->val), 
+                          padic_mat(mat)->r * padic_mat(mat)->c, 
+                          padic_mat_prec(mat), ctx);
     }
 }
 
 void padic_mat_reduce(padic_mat_t mat, const padic_ctx_t ctx)
 {
-    _padic_mat_canonicalise(mat, ctx);
+    /*
+        Reducing modulo p^{N-v} for a non-canonical v is still exact, 
+        and makes the divisibility tests of the canonicalisation cheap
+    */
     _padic_mat_reduce(mat, ctx);
+    _padic_mat_canonicalise(mat, ctx);
 }
-
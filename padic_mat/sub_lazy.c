@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mat.h"
+#include "padic_mat.h"
+
+void padic_mat_sub_lazy(padic_mat_t C, const padic_mat_t A, 
+                        const padic_mat_t B, const padic_ctx_t ctx)
+{
+    if (padic_mat_is_empty(C))
+    {
+        return;
+    }
+
+    if (padic_mat_is_zero(B))
+    {
+        if (C != A)
+        {
+            fmpz_mat_set(padic_mat(C), padic_mat(A));
+            padic_mat_val(C) = padic_mat_val(A);
+        }
+    }
+    else if (padic_mat_is_zero(A))
+    {
+        fmpz_mat_neg(padic_mat(C), padic_mat(B));
+        padic_mat_val(C) = padic_mat_val(B);
+    }
+    else if (padic_mat_val(A) == padic_mat_val(B))
+    {
+        fmpz_mat_sub(padic_mat(C), padic_mat(A), padic_mat(B));
+        padic_mat_val(C) = padic_mat_val(A);
+    }
+    else
+    {
+        fmpz_t x;
+
+        fmpz_init(x);
+
+        if (padic_mat_val(A) < padic_mat_val(B))  /* C := A - p^{w-v} B */
+        {
+            fmpz_pow_ui(x, ctx->p, padic_mat_val(B) - padic_mat_val(A));
+
+            if (C == B)
+            {
+                fmpz_mat_scalar_mul_fmpz(padic_mat(C), padic_mat(B), x);
+                fmpz_mat_sub(padic_mat(C), padic_mat(A), padic_mat(C));
+            }
+            else
+            {
+                if (C != A)
+                    fmpz_mat_set(padic_mat(C), padic_mat(A));
+                fmpz_mat_scalar_submul_fmpz(padic_mat(C), padic_mat(B), x);
+            }
+            padic_mat_val(C) = padic_mat_val(A);
+        }
+        else  /* C := p^{v-w} A - B */
+        {
+            fmpz_pow_ui(x, ctx->p, padic_mat_val(A) - padic_mat_val(B));
+
+            if (C == B)
+            {
+                fmpz_mat_scalar_submul_fmpz(padic_mat(C), padic_mat(A), x);
+                fmpz_mat_neg(padic_mat(C), padic_mat(C));
+            }
+            else
+            {
+                fmpz_mat_scalar_mul_fmpz(padic_mat(C), padic_mat(A), x);
+                fmpz_mat_sub(padic_mat(C), padic_mat(C), padic_mat(B));
+            }
+            padic_mat_val(C) = padic_mat_val(B);
+        }
+
+        fmpz_clear(x);
+    }
+
+    _padic_vec_reduce_lazy(padic_mat(C)->entries, &(padic_mat_val(C)), 
+                           padic_mat_nrows(C) * padic_mat_ncols(C), 
+                           padic_mat_prec(C), ctx);
+}
@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+#include "padic.h"
+#include "padic_mat.h"
+
+int
+main(void)
+{
+    int i, result;
+
+    fmpz_t p;
+    slong N;
+    padic_ctx_t ctx;
+    slong m, n;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("sub_lazy... ");
+    fflush(stdout);    
+
+    /* Compare with padic_mat_sub, with aliasing */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        padic_mat_t a, b, c, d;
+        int alias;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_VAL_UNIT);
+
+        m = n_randint(state, 10);
+        n = n_randint(state, 10);
+
+        padic_mat_init2(a, m, n, N);
+        padic_mat_init2(b, m, n, N);
+        padic_mat_init2(c, m, n, N);
+        padic_mat_init2(d, m, n, N);
+
+        padic_mat_randtest(a, state, ctx);
+        padic_mat_randtest(b, state, ctx);
+
+        padic_mat_sub(d, a, b, ctx);
+
+        alias = n_randint(state, 3);
+        if (alias == 0)
+        {
+            padic_mat_sub_lazy(c, a, b, ctx);
+        }
+        else if (alias == 1)
+        {
+            padic_mat_sub_lazy(a, a, b, ctx);
+            padic_mat_set(c, a, ctx);
+        }
+        else
+        {
+            padic_mat_sub_lazy(b, a, b, ctx);
+            padic_mat_set(c, b, ctx);
+        }
+        padic_mat_reduce(c, ctx);
+
+        result = (padic_mat_equal(c, d) && padic_mat_is_reduced(c, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL (alias = %d):\n\n", alias);
+            flint_printf("c = "), padic_mat_print(c, ctx), flint_printf("\n");
+            flint_printf("d = "), padic_mat_print(d, ctx), flint_printf("\n");
+            abort();
+        }
+
+        padic_mat_clear(a);
+        padic_mat_clear(b);
+        padic_mat_clear(c);
+        padic_mat_clear(d);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    /* Check a chain of lazy operations against the reduced ones */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        padic_mat_t a, b, c, d;
+        slong j;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_VAL_UNIT);
+
+        m = n_randint(state, 10);
+        n = m;
+
+        padic_mat_init2(a, m, n, N);
+        padic_mat_init2(b, m, n, N);
+        padic_mat_init2(c, m, n, N);
+        padic_mat_init2(d, m, n, N);
+
+        padic_mat_randtest(a, state, ctx);
+        padic_mat_set(c, a, ctx);
+        padic_mat_set(d, a, ctx);
+
+        for (j = 0; j < 10; j++)
+        {
+            padic_mat_randtest(b, state, ctx);
+
+            if (n_randint(state, 2))
+            {
+                padic_mat_sub_lazy(c, c, b, ctx);
+                padic_mat_sub(d, d, b, ctx);
+            }
+            else
+            {
+                padic_mat_sub_lazy(c, b, c, ctx);
+                padic_mat_sub(d, b, d, ctx);
+            }
+        }
+        padic_mat_reduce(c, ctx);
+
+        result = (padic_mat_equal(c, d) && padic_mat_is_reduced(c, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL (chain):\n\n");
+            flint_printf("c = "), padic_mat_print(c, ctx), flint_printf("\n");
+            flint_printf("d = "), padic_mat_print(d, ctx), flint_printf("\n");
+            abort();
+        }
+
+        padic_mat_clear(a);
+        padic_mat_clear(b);
+        padic_mat_clear(c);
+        padic_mat_clear(d);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011, 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -260,6 +261,14 @@ FLINT_DLL void padic_poly_sub(padic_poly_t f,
                     const padic_poly_t g, const padic_poly_t h, 
                     const padic_ctx_t ctx);
 
+FLINT_DLL void padic_poly_add_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx);
+
+FLINT_DLL void padic_poly_sub_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx);
+
 FLINT_DLL void padic_poly_neg(padic_poly_t f, const padic_poly_t g, 
                     const padic_ctx_t ctx);
 
@@ -283,6 +292,10 @@ FLINT_DLL void padic_poly_mul(padic_poly_t f,
                     const padic_poly_t g, const padic_poly_t h, 
                     const padic_ctx_t ctx);
 
+FLINT_DLL void padic_poly_mul_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx);
+
 /*  Powering  ****************************************************************/
 
 FLINT_DLL void _padic_poly_pow(fmpz *rop, slong *rval, slong N, 
@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_poly.h"
+
+void padic_poly_add_lazy(padic_poly_t f, 
+                         const padic_poly_t g, const padic_poly_t h, 
+                         const padic_ctx_t ctx)
+{
+    slong lenF;
+
+    /* Ensure that ord_p(g) <= ord_p(h) for non-zero operands */
+    if (h->length != 0 && (g->length == 0 || g->val > h->val))
+    {
+        const padic_poly_struct *t = g;
+        g = h;
+        h = t;
+    }
+
+    lenF = FLINT_MAX(g->length, h->length);
+
+    if (lenF == 0)
+    {
+        padic_poly_zero(f);
+        return;
+    }
+
+    padic_poly_fit_length(f, lenF);
+
+    if (h->length == 0)
+    {
+        if (f != g)
+        {
+            _fmpz_vec_set(f->coeffs, g->coeffs, lenF);
+            f->val = g->val;
+        }
+    }
+    else if (g->val == h->val)
+    {
+        _fmpz_poly_add(f->coeffs, g->coeffs, g->length, h->coeffs, h->length);
+        f->val = g->val;
+    }
+    else  /* f := g + p^{w-v} h */
+    {
+        const slong val = g->val;
+        fmpz_t x;
+
+        fmpz_init(x);
+        fmpz_pow_ui(x, ctx->p, h->val - g->val);
+
+        if (f == h)
+        {
+            _fmpz_vec_scalar_mul_fmpz(f->coeffs, h->coeffs, h->length, x);
+            _fmpz_poly_add(f->coeffs, g->coeffs, g->length, 
+                                      f->coeffs, h->length);
+        }
+        else
+        {
+            if (f != g)
+                _fmpz_vec_set(f->coeffs, g->coeffs, g->length);
+            _fmpz_vec_zero(f->coeffs + g->length, lenF - g->length);
+            _fmpz_vec_scalar_addmul_fmpz(f->coeffs, h->coeffs, h->length, x);
+        }
+        f->val = val;
+
+        fmpz_clear(x);
+    }
+
+    _padic_vec_reduce_lazy(f->coeffs, &(f->val), lenF, f->N, ctx);
+
+    _padic_poly_set_length(f, lenF);
+    _padic_poly_normalise(f);
+}
@@ -0,0 +1,59 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_poly.h"
+
+void padic_poly_mul_lazy(padic_poly_t f, 
+                         const padic_poly_t g, const padic_poly_t h, 
+                         const padic_ctx_t ctx)
+{
+    const slong lenG = g->length;
+    const slong lenH = h->length;
+    const slong lenF = lenG + lenH - 1;
+
+    if (lenG == 0 || lenH == 0 || g->val + h->val >= f->N)
+    {
+        padic_poly_zero(f);
+    }
+    else
+    {
+        const slong val = g->val + h->val;
+        fmpz *t;
+
+        if (f == g || f == h)
+        {
+            t = _fmpz_vec_init(lenF);
+        }
+        else
+        {
+            padic_poly_fit_length(f, lenF);
+            t = f->coeffs;
+        }
+
+        if (lenG >= lenH)
+            _fmpz_poly_mul(t, g->coeffs, lenG, h->coeffs, lenH);
+        else
+            _fmpz_poly_mul(t, h->coeffs, lenH, g->coeffs, lenG);
+
+        if (f == g || f == h)
+        {
+            _fmpz_vec_clear(f->coeffs, f->alloc);
+            f->coeffs = t;
+            f->alloc  = lenF;
+        }
+        f->val = val;
+
+        _padic_vec_reduce_lazy(f->coeffs, &(f->val), lenF, f->N, ctx);
+
+        _padic_poly_set_length(f, lenF);
+        _padic_poly_normalise(f);
+    }
+}
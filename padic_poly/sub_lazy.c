@@ -0,0 +1,99 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_poly.h"
+
+void padic_poly_sub_lazy(padic_poly_t f, 
+                         const padic_poly_t g, const padic_poly_t h, 
+                         const padic_ctx_t ctx)
+{
+    const slong lenG = g->length;
+    const slong lenH = h->length;
+    const slong lenF = FLINT_MAX(lenG, lenH);
+
+    if (lenF == 0)
+    {
+        padic_poly_zero(f);
+        return;
+    }
+
+    padic_poly_fit_length(f, lenF);
+
+    if (lenH == 0)
+    {
+        if (f != g)
+        {
+            _fmpz_vec_set(f->coeffs, g->coeffs, lenG);
+            f->val = g->val;
+        }
+    }
+    else if (lenG == 0)
+    {
+        _fmpz_vec_neg(f->coeffs, h->coeffs, lenH);
+        f->val = h->val;
+    }
+    else if (g->val == h->val)
+    {
+        _fmpz_poly_sub(f->coeffs, g->coeffs, lenG, h->coeffs, lenH);
+        f->val = g->val;
+    }
+    else
+    {
+        slong val;
+        fmpz_t x;
+
+        fmpz_init(x);
+
+        if (g->val < h->val)  /* f := g - p^{w-v} h */
+        {
+            val = g->val;
+            fmpz_pow_ui(x, ctx->p, h->val - g->val);
+
+            if (f == h)
+            {
+                _fmpz_vec_scalar_mul_fmpz(f->coeffs, h->coeffs, lenH, x);
+                _fmpz_poly_sub(f->coeffs, g->coeffs, lenG, f->coeffs, lenH);
+            }
+            else
+            {
+                if (f != g)
+                    _fmpz_vec_set(f->coeffs, g->coeffs, lenG);
+                _fmpz_vec_zero(f->coeffs + lenG, lenF - lenG);
+                _fmpz_vec_scalar_submul_fmpz(f->coeffs, h->coeffs, lenH, x);
+            }
+        }
+        else  /* f := p^{v-w} g - h */
+        {
+            val = h->val;
+            fmpz_pow_ui(x, ctx->p, g->val - h->val);
+
+            if (f == h)
+            {
+                _fmpz_vec_neg(f->coeffs, h->coeffs, lenH);
+                _fmpz_vec_zero(f->coeffs + lenH, lenF - lenH);
+                _fmpz_vec_scalar_addmul_fmpz(f->coeffs, g->coeffs, lenG, x);
+            }
+            else
+            {
+                _fmpz_vec_scalar_mul_fmpz(f->coeffs, g->coeffs, lenG, x);
+                _fmpz_poly_sub(f->coeffs, f->coeffs, lenG, h->coeffs, lenH);
+            }
+        }
+        f->val = val;
+
+        fmpz_clear(x);
+    }
+
+    _padic_vec_reduce_lazy(f->coeffs, &(f->val), lenF, f->N, ctx);
+
+    _padic_poly_set_length(f, lenF);
+    _padic_poly_normalise(f);
+}
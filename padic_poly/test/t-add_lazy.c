@@ -0,0 +1,146 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "padic_poly.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+
+    padic_ctx_t ctx;
+    fmpz_t p;
+    slong N, M;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("add_lazy... ");
+    fflush(stdout);    
+
+    /* Compare with padic_poly_add, with aliasing */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        padic_poly_t a, b, c, d;
+        int alias;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        M = N + n_randint(state, 21) - 10;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        alias = n_randint(state, 3);
+
+        padic_poly_init2(a, 0, alias == 1 ? M : N);
+        padic_poly_init2(b, 0, alias == 2 ? M : N);
+        padic_poly_init2(c, 0, M);
+        padic_poly_init2(d, 0, M);
+
+        padic_poly_randtest(a, state, n_randint(state, 50), ctx);
+        padic_poly_randtest(b, state, n_randint(state, 50), ctx);
+
+        padic_poly_add(d, a, b, ctx);
+
+        if (alias == 0)
+        {
+            padic_poly_add_lazy(c, a, b, ctx);
+        }
+        else if (alias == 1)
+        {
+            padic_poly_add_lazy(a, a, b, ctx);
+            padic_poly_swap(a, c);
+        }
+        else
+        {
+            padic_poly_add_lazy(b, a, b, ctx);
+            padic_poly_swap(b, c);
+        }
+        padic_poly_reduce(c, ctx);
+        padic_poly_canonicalise(c, ctx->p);
+
+        result = (padic_poly_equal(c, d) && padic_poly_is_reduced(c, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL (alias = %d):\n\n", alias);
+            flint_printf("c = "), padic_poly_print(c, ctx), flint_printf("\n\n");
+            flint_printf("d = "), padic_poly_print(d, ctx), flint_printf("\n\n");
+            abort();
+        }
+
+        padic_poly_clear(a);
+        padic_poly_clear(b);
+        padic_poly_clear(c);
+        padic_poly_clear(d);
+
+        padic_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    /* Check a chain of lazy operations against the reduced ones */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        padic_poly_t a, b, c, d;
+        slong j;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        padic_poly_init2(a, 0, N);
+        padic_poly_init2(b, 0, N);
+        padic_poly_init2(c, 0, N);
+        padic_poly_init2(d, 0, N);
+
+        padic_poly_randtest(a, state, n_randint(state, 50), ctx);
+        padic_poly_set(c, a, ctx);
+        padic_poly_set(d, a, ctx);
+
+        for (j = 0; j < 10; j++)
+        {
+            padic_poly_randtest(b, state, n_randint(state, 50), ctx);
+
+            padic_poly_add_lazy(c, c, b, ctx);
+            padic_poly_add(d, d, b, ctx);
+        }
+        padic_poly_reduce(c, ctx);
+        padic_poly_canonicalise(c, ctx->p);
+
+        result = (padic_poly_equal(c, d) && padic_poly_is_reduced(c, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL (chain):\n\n");
+            flint_printf("c = "), padic_poly_print(c, ctx), flint_printf("\n\n");
+            flint_printf("d = "), padic_poly_print(d, ctx), flint_printf("\n\n");
+            abort();
+        }
+
+        padic_poly_clear(a);
+        padic_poly_clear(b);
+        padic_poly_clear(c);
+        padic_poly_clear(d);
+
+        padic_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
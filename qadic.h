@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011, 2012, 2013 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -34,6 +35,7 @@
 #include "ulong_extras.h"
 #include "padic.h"
 #include "padic_poly.h"
+#include "fmpz_mat.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -404,6 +406,10 @@ FLINT_DLL void _qadic_log(fmpz *z, const fmpz *y, slong v, slong len,
 
 FLINT_DLL int qadic_log(qadic_t rop, const qadic_t op, const qadic_ctx_t ctx);
 
+FLINT_DLL void _qadic_frobenius_a(fmpz *rop, slong exp, 
+                  const fmpz *a, const slong *j, slong lena, 
+                  const fmpz_t p, slong N);
+
 FLINT_DLL void _qadic_frobenius(fmpz *rop, const fmpz *op, slong len, slong e, 
                   const fmpz *a, const slong *j, slong lena, 
                   const fmpz_t p, slong N);
@@ -438,6 +444,45 @@ FLINT_DLL void qadic_norm_resultant(padic_t rop, const qadic_t op, const qadic_c
 
 FLINT_DLL int qadic_sqrt(qadic_t rop, const qadic_t op, const qadic_ctx_t ctx);
 
+/* Batch operations **********************************************************/
+
+/*
+    Precomputed data for applying the Frobenius $\Sigma^e$ modulo $p^N$: 
+    row $i$ of the $d \times d$ matrix \code{mat} holds the coefficients 
+    of $\Sigma^e(X^i)$, so that $\Sigma^e$ acts on coefficient vectors 
+    by multiplication on the right.
+*/
+typedef struct
+{
+    fmpz_mat_t mat;
+    fmpz pN;
+    slong e;
+    slong N;
+}
+qadic_frobenius_precomp_struct;
+
+typedef qadic_frobenius_precomp_struct qadic_frobenius_precomp_t[1];
+
+FLINT_DLL void qadic_frobenius_precomp_init(qadic_frobenius_precomp_t F, 
+                                slong e, slong N, const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_frobenius_precomp_clear(qadic_frobenius_precomp_t F);
+
+FLINT_DLL void qadic_frobenius_vec_precomp(qadic_struct * rop, 
+                           const qadic_struct * op, slong n, 
+                           const qadic_frobenius_precomp_t F, 
+                           const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_frobenius_vec(qadic_struct * rop, 
+                           const qadic_struct * op, slong n, slong e, 
+                           const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_teichmuller_vec(qadic_struct * rop, 
+              const qadic_struct * op, slong n, const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_norm_vec(padic_struct * rop, 
+              const qadic_struct * op, slong n, const qadic_ctx_t ctx);
+
 /* Output ********************************************************************/
 
 FLINT_DLL int qadic_fprint_pretty(FILE *file, const qadic_t op, const qadic_ctx_t ctx);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "qadic.h"
 
 extern slong _padic_exp_bound(slong v, slong N, const fmpz_t p);
@@ -77,8 +79,15 @@ _qadic_exp_bsplit_series(fmpz *P, fmpz_t Q, fmpz *T,
     }
 }
 
+/*
+    Sets $(T, Q)$ to a fraction equal to $\exp(x)$ modulo $p^N$, where 
+    $x = (x, len)$ has valuation at least $v$ and $T$ is a vector of 
+    length $2 d - 1$ whose first $d$ entries are set.  $Q$ is a unit 
+    and neither $T$ nor $Q$ need to be reduced modulo $p^N$.
+ */
+
 static void 
-_qadic_exp_bsplit(fmpz *y, const fmpz *x, slong v, slong len, 
+_qadic_exp_bsplit(fmpz *T, fmpz_t Q, const fmpz *x, slong v, slong len, 
                   const fmpz *a, const slong *j, slong lena, 
                   const fmpz_t p, slong N)
 {
@@ -87,18 +96,17 @@ _qadic_exp_bsplit(fmpz *y, const fmpz *x, slong v, slong len,
 
     if (n == 1)
     {
-        fmpz_one(y + 0);
-        _fmpz_vec_zero(y + 1, d - 1);
+        fmpz_one(T + 0);
+        _fmpz_vec_zero(T + 1, d - 1);
+        fmpz_one(Q);
     }
     else
     {
-        fmpz *P, *T;
-        fmpz_t Q, R;
+        fmpz *P;
+        fmpz_t R;
         slong f;
 
         P = _fmpz_vec_init(2*d - 1);
-        T = _fmpz_vec_init(2*d - 1);
-        fmpz_init(Q);
         fmpz_init(R);
 
         _qadic_exp_bsplit_series(P, Q, T, x, len, 1, n, a, j, lena);
@@ -110,29 +118,69 @@ _qadic_exp_bsplit(fmpz *y, const fmpz *x, slong v, slong len,
         fmpz_pow_ui(R, p, f);
         _fmpz_vec_scalar_divexact_fmpz(T, T, d, R);
 
-        _padic_inv(Q, Q, p, N);
-        _fmpz_vec_scalar_mul_fmpz(y, T, d, Q);
-
         _fmpz_vec_clear(P, 2*d - 1);
-        _fmpz_vec_clear(T, 2*d - 1);
-        fmpz_clear(Q);
         fmpz_clear(R);
     }
 }
 
+typedef struct
+{
+    fmpz ** T;
+    fmpz * Q;
+    fmpz ** r;
+    const slong * w;
+    slong num;
+    slong start;
+    slong step;
+    const fmpz * a;
+    const slong * j;
+    slong lena;
+    const fmpz * p;
+    slong N;
+    const fmpz * pN;
+}
+qadic_exp_arg_t;
+
+static void
+_qadic_exp_blocks(qadic_exp_arg_t * arg)
+{
+    const slong d = arg->j[arg->lena - 1];
+    slong i;
+
+    for (i = arg->start; i < arg->num; i += arg->step)
+    {
+        _qadic_exp_bsplit(arg->T[i], arg->Q + i, arg->r[i], arg->w[i], d, 
+                          arg->a, arg->j, arg->lena, arg->p, arg->N);
+        _fmpz_vec_scalar_mod_fmpz(arg->T[i], arg->T[i], d, arg->pN);
+        fmpz_mod(arg->Q + i, arg->Q + i, arg->pN);
+    }
+}
+
+static void *
+_qadic_exp_blocks_worker(void * arg_ptr)
+{
+    _qadic_exp_blocks((qadic_exp_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void _qadic_exp_balanced(fmpz *rop, const fmpz *x, slong v, slong len, 
                          const fmpz *a, const slong *j, slong lena, 
                          const fmpz_t p, slong N, const fmpz_t pN)
 {
     const slong d = j[lena - 1];
 
+    pthread_t * threads;
+    qadic_exp_arg_t * args;
     fmpz_t pw;
-    fmpz *r, *s, *t;
-    slong i, w;
+    fmpz *r[FLINT_BITS], *T[FLINT_BITS], *Q, *s, *t;
+    slong w[FLINT_BITS];
+    slong i, k, num, num_threads;
 
-    r = _fmpz_vec_init(d);
     s = _fmpz_vec_init(2*d - 1);
     t = _fmpz_vec_init(d);
+    Q = _fmpz_vec_init(FLINT_BITS);
     fmpz_init(pw);
 
     fmpz_pow_ui(pw, p, v);
@@ -140,35 +188,96 @@ void _qadic_exp_balanced(fmpz *rop, const fmpz *x, slong v, slong len,
     _fmpz_vec_scalar_mod_fmpz(t, t, len, pN);
     _fmpz_vec_zero(t + len, d - len);
 
+    /* split x into blocks of valuation w and 2 w digits */
     fmpz_set(pw, p);
+    for (k = 1, num = 0; !_fmpz_vec_is_zero(t, d); k *= 2)
+    {
+        fmpz_mul(pw, pw, pw);
+
+        r[num] = _fmpz_vec_init(d);
+        for (i = 0; i < d; i++)
+        {
+            fmpz_fdiv_r(r[num] + i, t + i, pw);
+            fmpz_sub(t + i, t + i, r[num] + i);
+        }
+
+        if (!_fmpz_vec_is_zero(r[num], d))
+        {
+            T[num] = _fmpz_vec_init(2*d - 1);
+            w[num++] = k;
+        }
+        else
+        {
+            _fmpz_vec_clear(r[num], d);
+        }
+    }
+
     fmpz_one(rop + 0);
     _fmpz_vec_zero(rop + 1, d - 1);
-    w = 1;
 
-    while (!_fmpz_vec_is_zero(t, d))
+    if (num > 0)
     {
-        fmpz_mul(pw, pw, pw);
+        /* the blocks are independent and only their denominators need 
+           to be inverted, so evaluate them in parallel */
+        num_threads = FLINT_MIN(flint_get_num_threads(), num);
 
-        for (i = 0; i < d; i++)
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(qadic_exp_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
         {
-            fmpz_fdiv_r(r + i, t + i, pw);
-            fmpz_sub(t + i, t + i, r + i);
+            args[i].T = T;
+            args[i].Q = Q;
+            args[i].r = r;
+            args[i].w = w;
+            args[i].num = num;
+            args[i].start = i;
+            args[i].step = num_threads;
+            args[i].a = a;
+            args[i].j = j;
+            args[i].lena = lena;
+            args[i].p = p;
+            args[i].N = N;
+            args[i].pN = pN;
         }
 
-        if (!_fmpz_vec_is_zero(r, d))
+        for (i = 0; i < num_threads - 1; i++)
+            pthread_create(&threads[i], NULL, 
+                           _qadic_exp_blocks_worker, &args[i]);
+
+        _qadic_exp_blocks(&args[num_threads - 1]);
+
+        for (i = 0; i < num_threads - 1; i++)
+            pthread_join(threads[i], NULL);
+
+        _fmpz_vec_set(rop, T[0], d);
+        for (i = 1; i < num; i++)
         {
-            _qadic_exp_bsplit(r, r, w, d, a, j, lena, p, N);
-            _fmpz_poly_mul(s, rop, d, r, d);
+            _fmpz_poly_mul(s, rop, d, T[i], d);
             _fmpz_poly_reduce(s, 2*d - 1, a, j, lena);
             _fmpz_vec_scalar_mod_fmpz(rop, s, d, pN);
+
+            fmpz_mul(Q + 0, Q + 0, Q + i);
+            fmpz_mod(Q + 0, Q + 0, pN);
+        }
+
+        _padic_inv(Q + 0, Q + 0, p, N);
+        _fmpz_vec_scalar_mul_fmpz(rop, rop, d, Q + 0);
+        _fmpz_vec_scalar_mod_fmpz(rop, rop, d, pN);
+
+        for (i = 0; i < num; i++)
+        {
+            _fmpz_vec_clear(r[i], d);
+            _fmpz_vec_clear(T[i], 2*d - 1);
         }
 
-        w *= 2;
+        flint_free(threads);
+        flint_free(args);
     }
 
-    _fmpz_vec_clear(r, d);
     _fmpz_vec_clear(s, 2*d - 1);
     _fmpz_vec_clear(t, d);
+    _fmpz_vec_clear(Q, FLINT_BITS);
     fmpz_clear(pw);
 }
 
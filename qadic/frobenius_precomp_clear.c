@@ -0,0 +1,18 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+
+void qadic_frobenius_precomp_clear(qadic_frobenius_precomp_t F)
+{
+    fmpz_mat_clear(F->mat);
+    fmpz_clear(&F->pN);
+}
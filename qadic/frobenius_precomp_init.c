@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+
+void qadic_frobenius_precomp_init(qadic_frobenius_precomp_t F, 
+                                  slong e, slong N, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+    const fmpz *p = (&ctx->pctx)->p;
+
+    if (N < 1)
+    {
+        flint_printf("Exception (qadic_frobenius_precomp_init).  N < 1.\n");
+        flint_abort();
+    }
+
+    e = e % d;
+    if (e < 0)
+        e += d;
+
+    F->e = e;
+    F->N = N;
+    fmpz_init(&F->pN);
+    fmpz_pow_ui(&F->pN, p, N);
+    fmpz_mat_init(F->mat, d, d);
+
+    if (e == 0)
+    {
+        fmpz_mat_one(F->mat);
+    }
+    else
+    {
+        fmpz *s, *t;
+        slong i;
+
+        s = _fmpz_vec_init(2*d - 1);
+        t = _fmpz_vec_init(2*d - 1);
+
+        /* t := Sigma^e(X) mod p^N */
+        if (N == 1)
+        {
+            fmpz op[2] = {WORD(0), WORD(1)};
+            fmpz_t q;
+
+            fmpz_init(q);
+            fmpz_pow_ui(q, p, e);
+            _qadic_pow(t, op, 2, q, ctx->a, ctx->j, ctx->len, p);
+            fmpz_clear(q);
+        }
+        else
+        {
+            _qadic_frobenius_a(t, e, ctx->a, ctx->j, ctx->len, p, N);
+        }
+
+        /* Row i is Sigma^e(X^i) = Sigma^e(X)^i */
+        fmpz_one(fmpz_mat_entry(F->mat, 0, 0));
+        _fmpz_vec_set(F->mat->rows[1], t, d);
+        for (i = 2; i < d; i++)
+        {
+            _fmpz_poly_mul(s, F->mat->rows[i - 1], d, t, d);
+            _fmpz_poly_reduce(s, 2*d - 1, ctx->a, ctx->j, ctx->len);
+            _fmpz_vec_scalar_mod_fmpz(F->mat->rows[i], s, d, &F->pN);
+        }
+
+        _fmpz_vec_clear(s, 2*d - 1);
+        _fmpz_vec_clear(t, 2*d - 1);
+    }
+}
@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+
+void qadic_frobenius_vec(qadic_struct * rop, const qadic_struct * op, 
+                         slong n, slong e, const qadic_ctx_t ctx)
+{
+    qadic_frobenius_precomp_t F;
+    slong k, N;
+
+    /* the largest relative precision required */
+    for (k = 0, N = 0; k < n; k++)
+        if (!qadic_is_zero(op + k))
+            N = FLINT_MAX(N, qadic_prec(rop + k) - (op + k)->val);
+
+    if (N <= 0)
+    {
+        for (k = 0; k < n; k++)
+            qadic_zero(rop + k);
+        return;
+    }
+
+    qadic_frobenius_precomp_init(F, e, N, ctx);
+    qadic_frobenius_vec_precomp(rop, op, n, F, ctx);
+    qadic_frobenius_precomp_clear(F);
+}
@@ -0,0 +1,94 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+
+void qadic_frobenius_vec_precomp(qadic_struct * rop, 
+                                 const qadic_struct * op, slong n, 
+                                 const qadic_frobenius_precomp_t F, 
+                                 const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+    const fmpz *p = (&ctx->pctx)->p;
+
+    fmpz_mat_t A, C;
+    fmpz_t pN;
+    slong i, k, m, N, lastN;
+    slong *idx, *val;
+
+    idx = flint_malloc(n * sizeof(slong));
+    val = flint_malloc(n * sizeof(slong));
+
+    /* Collect the elements which are non-zero to their precision */
+    for (k = 0, m = 0; k < n; k++)
+    {
+        N = qadic_prec(rop + k);
+
+        if (qadic_is_zero(op + k) || (op + k)->val >= N)
+            continue;
+
+        if (N - (op + k)->val > F->N)
+        {
+            flint_printf("Exception (qadic_frobenius_vec_precomp).  "
+                         "Precision exceeds that of the precomputation.\n");
+            flint_abort();
+        }
+
+        idx[m++] = k;
+    }
+
+    /* Apply Sigma^e to all coefficient vectors by a single product */
+    fmpz_mat_init(A, m, d);
+    fmpz_mat_init(C, m, d);
+
+    for (i = 0; i < m; i++)
+    {
+        k = idx[i];
+        _fmpz_vec_set(A->rows[i], (op + k)->coeffs, (op + k)->length);
+        val[i] = (op + k)->val;
+    }
+
+    if (F->e == 0)
+        fmpz_mat_swap(A, C);
+    else
+        fmpz_mat_mul(C, A, F->mat);
+
+    for (k = 0; k < n; k++)
+        if (qadic_is_zero(op + k) || (op + k)->val >= qadic_prec(rop + k))
+            qadic_zero(rop + k);
+
+    fmpz_init(pN);
+    lastN = -1;
+
+    for (i = 0; i < m; i++)
+    {
+        k = idx[i];
+        N = qadic_prec(rop + k) - val[i];
+
+        if (N != lastN)
+        {
+            fmpz_pow_ui(pN, p, N);
+            lastN = N;
+        }
+
+        padic_poly_fit_length(rop + k, d);
+        _fmpz_vec_scalar_mod_fmpz((rop + k)->coeffs, C->rows[i], d, pN);
+        (rop + k)->val = val[i];
+        _padic_poly_set_length(rop + k, d);
+        _padic_poly_normalise(rop + k);
+    }
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(C);
+    fmpz_clear(pN);
+    flint_free(idx);
+    flint_free(val);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -9,11 +10,47 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "fmpz_mod_poly.h"
 #include "qadic.h"
 
 extern slong _padic_log_bound(slong v, slong N, const fmpz_t p);
 
+static void 
+_qadic_log_bsplit_series(fmpz *P, fmpz_t B, fmpz *T, 
+                         const fmpz *y, slong len, slong lo, slong hi, 
+                         const fmpz *a, const slong *j, slong lena, 
+                         slong thread_limit);
+
+typedef struct
+{
+    fmpz * P;
+    fmpz * B;
+    fmpz * T;
+    const fmpz * y;
+    slong len;
+    slong lo;
+    slong hi;
+    const fmpz * a;
+    const slong * j;
+    slong lena;
+    slong thread_limit;
+}
+qadic_log_bsplit_arg_t;
+
+static void *
+_qadic_log_bsplit_series_worker(void * arg_ptr)
+{
+    qadic_log_bsplit_arg_t * arg = (qadic_log_bsplit_arg_t *) arg_ptr;
+
+    _qadic_log_bsplit_series(arg->P, arg->B, arg->T, arg->y, arg->len, 
+                             arg->lo, arg->hi, arg->a, arg->j, arg->lena, 
+                             arg->thread_limit);
+
+    flint_cleanup();
+    return NULL;
+}
+
 /*
     Assumes that P, T are vectors of length 2 d - 1.
 
@@ -21,13 +58,17 @@ extern slong _padic_log_bound(slong v, slong N, const fmpz_t p);
 
     Assumes that 1 <= lo < hi.
 
+    While thread_limit is larger than one and the range is long enough, 
+    the left half of the product tree is evaluated in a separate thread.
+
     Does not support aliasing.
  */
 
 static void 
 _qadic_log_bsplit_series(fmpz *P, fmpz_t B, fmpz *T, 
                          const fmpz *y, slong len, slong lo, slong hi, 
-                         const fmpz *a, const slong *j, slong lena)
+                         const fmpz *a, const slong *j, slong lena, 
+                         slong thread_limit)
 {
     const slong d = j[lena - 1];
 
@@ -65,9 +106,36 @@ _qadic_log_bsplit_series(fmpz *P, fmpz_t B, fmpz *T,
         W  = _fmpz_vec_init(2*d - 1);
         fmpz_init(RB);
 
-        _qadic_log_bsplit_series(P, B, T, y, len, lo, m, a, j, lena);
-
-        _qadic_log_bsplit_series(RP, RB, RT, y, len, m, hi, a, j, lena);
+        if (thread_limit > 1 && hi - lo >= PADIC_BSPLIT_THREAD_CUTOFF)
+        {
+            pthread_t thread;
+            qadic_log_bsplit_arg_t arg;
+
+            arg.P = P;
+            arg.B = B;
+            arg.T = T;
+            arg.y = y;
+            arg.len = len;
+            arg.lo = lo;
+            arg.hi = m;
+            arg.a = a;
+            arg.j = j;
+            arg.lena = lena;
+            arg.thread_limit = thread_limit / 2;
+
+            pthread_create(&thread, NULL, _qadic_log_bsplit_series_worker, 
+                           &arg);
+
+            _qadic_log_bsplit_series(RP, RB, RT, y, len, m, hi, a, j, lena, 
+                                     thread_limit - thread_limit / 2);
+
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            _qadic_log_bsplit_series(P, B, T, y, len, lo, m, a, j, lena, 1);
+            _qadic_log_bsplit_series(RP, RB, RT, y, len, m, hi, a, j, lena, 1);
+        }
 
         _fmpz_poly_mul(W, RT, d, P, d);
         _fmpz_poly_reduce(W, 2*d - 1, a, j, lena);
@@ -97,13 +165,15 @@ _qadic_log_bsplit_series(fmpz *P, fmpz_t B, fmpz *T,
     The result may not be reduced modulo p^N, but it is 
     reduced modulo f(X) given by the data (a, j, lena).
 
+    Uses the precomputed data S for inversion modulo p^N.
+
     Supports aliasing between y and z.
  */
 
 static void 
 _qadic_log_bsplit(fmpz *z, const fmpz *y, slong v, slong len, 
                   const fmpz *a, const slong *j, slong lena, 
-                  const fmpz_t p, slong N)
+                  const fmpz_t p, slong N, const padic_inv_t S)
 {
     const slong d = j[lena - 1];
 
@@ -119,13 +189,14 @@ _qadic_log_bsplit(fmpz *z, const fmpz *y, slong v, slong len,
     fmpz_init(B);
     fmpz_init(C);
 
-    _qadic_log_bsplit_series(P, B, T, y, len, 1, n, a, j, lena);
+    _qadic_log_bsplit_series(P, B, T, y, len, 1, n, a, j, lena, 
+                             flint_get_num_threads());
 
     n = fmpz_remove(B, B, p);
     fmpz_pow_ui(C, p, n);
     _fmpz_vec_scalar_divexact_fmpz(T, T, d, C);
 
-    _padic_inv(B, B, p, N);
+    _padic_inv_precomp(B, B, S);
     _fmpz_vec_scalar_mul_fmpz(z, T, d, B);
 
     _fmpz_vec_clear(P, 2*d - 1);
@@ -167,6 +238,7 @@ void _qadic_log_balanced(fmpz *z, const fmpz *y, slong len,
     const slong d = j[lena - 1];
 
     fmpz_t pv;
+    padic_inv_t S;
     fmpz *r, *s, *t, *u;
     slong i, w;
 
@@ -175,6 +247,7 @@ void _qadic_log_balanced(fmpz *z, const fmpz *y, slong len,
     t = _fmpz_vec_init(d);
     u = _fmpz_vec_init(d);
     fmpz_init(pv);
+    _padic_inv_precompute(S, p, N);
 
     fmpz_set(pv, p);
     _fmpz_vec_scalar_mod_fmpz(t, y, len, pN);
@@ -208,7 +281,7 @@ void _qadic_log_balanced(fmpz *z, const fmpz *y, slong len,
 
         if (!_fmpz_vec_is_zero(r, d))
         {
-            _qadic_log_bsplit(r, r, w, d, a, j, lena, p, N);
+            _qadic_log_bsplit(r, r, w, d, a, j, lena, p, N, S);
             _fmpz_vec_sub(z, z, r, d);
             _fmpz_vec_scalar_mod_fmpz(z, z, d, pN);
         }
@@ -221,6 +294,7 @@ void _qadic_log_balanced(fmpz *z, const fmpz *y, slong len,
     _fmpz_vec_clear(t, d);
     _fmpz_vec_clear(u, d);
     fmpz_clear(pv);
+    _padic_inv_clear(S);
 }
 
 int qadic_log_balanced(qadic_t rop, const qadic_t op, const qadic_ctx_t ctx)
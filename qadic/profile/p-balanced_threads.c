@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Benchmarks for the balanced q-adic exponential and logarithm 
+    with several threads.
+
+    We consider the set-up with p = 17, d = 8, N = 2^i, i = 8, ..., 14, 
+    and compute the exponential of p A and the logarithm of 1 + p A 
+    modulo p^N, where A = [a{0},...,a{d-1}] with a{i} = (3+i)^{3N}.  
+    Wall times are reported in milliseconds for 1, 2, 4 and 8 threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "flint.h"
+#include "fmpz.h"
+#include "qadic.h"
+#include "profiler.h"
+
+int
+main(void)
+{
+    const slong d = 8;
+    slong i, j, k, n;
+    slong threads[] = {1, 2, 4, 8};
+    fmpz_t p;
+
+    fmpz_init_set_ui(p, 17);
+
+    flint_printf("Benchmark for q-adic exp and log (balanced), threaded.\n");
+    flint_printf("     N  threads      exp      log\n");
+    fflush(stdout);
+
+    for (i = 8; i <= 14; i++)
+    {
+        qadic_ctx_t ctx;
+        qadic_t a, e, z;
+        fmpz_t f, pow;
+
+        n = WORD(1) << i;
+
+        qadic_ctx_init_conway(ctx, p, d, 0, 0, "X", PADIC_SERIES);
+
+        qadic_init2(a, n);
+        qadic_init2(e, n);
+        qadic_init2(z, n);
+        fmpz_init(f);
+        fmpz_init(pow);
+
+        fmpz_pow_ui(pow, p, n - 1);
+        padic_poly_fit_length(a, d);
+        for (j = 0; j < d; j++)
+        {
+            fmpz_set_ui(f, 3 + j);
+            fmpz_powm_ui(a->coeffs + j, f, 3 * n, pow);
+        }
+        _padic_poly_set_length(a, d);
+        _padic_poly_normalise(a);
+        a->val = 1;
+
+        qadic_one(e);
+        qadic_add(e, e, a, ctx);
+
+        for (k = 0; k < 4; k++)
+        {
+            timeit_t t0, t1;
+
+            flint_set_num_threads(threads[k]);
+
+            timeit_start(t0);
+            qadic_exp_balanced(z, a, ctx);
+            timeit_stop(t0);
+
+            timeit_start(t1);
+            qadic_log_balanced(z, e, ctx);
+            timeit_stop(t1);
+
+            flint_printf("%6wd  %7wd  %7wd  %7wd\n", n, threads[k], 
+                         t0->wall, t1->wall);
+        }
+
+        qadic_clear(a);
+        qadic_clear(e);
+        qadic_clear(z);
+        fmpz_clear(f);
+        fmpz_clear(pow);
+        qadic_ctx_clear(ctx);
+    }
+
+    fmpz_clear(p);
+    flint_cleanup();
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "qadic.h"
+
+typedef struct
+{
+    qadic_struct * rop;
+    const qadic_struct * op;
+    slong start;
+    slong stop;
+    const qadic_ctx_struct * ctx;
+}
+qadic_teichmuller_vec_arg_t;
+
+static void
+_qadic_teichmuller_vec_range(qadic_teichmuller_vec_arg_t * arg)
+{
+    slong k;
+
+    for (k = arg->start; k < arg->stop; k++)
+        qadic_teichmuller(arg->rop + k, arg->op + k, arg->ctx);
+}
+
+static void *
+_qadic_teichmuller_vec_worker(void * arg_ptr)
+{
+    _qadic_teichmuller_vec_range((qadic_teichmuller_vec_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void qadic_teichmuller_vec(qadic_struct * rop, const qadic_struct * op, 
+                           slong n, const qadic_ctx_t ctx)
+{
+    pthread_t * threads;
+    qadic_teichmuller_vec_arg_t * args;
+    slong i, num_threads;
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), n));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(qadic_teichmuller_vec_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].rop = rop;
+        args[i].op = op;
+        args[i].start = (i * n) / num_threads;
+        args[i].stop = ((i + 1) * n) / num_threads;
+        args[i].ctx = ctx;
+    }
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_create(&threads[i], NULL, 
+                       _qadic_teichmuller_vec_worker, &args[i]);
+
+    _qadic_teichmuller_vec_range(&args[num_threads - 1]);
+
+    for (i = 0; i < num_threads - 1; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -40,6 +41,8 @@ main(void)
         N = n_randint(state, 50) + 1;
         qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         qadic_init2(a, N);
         qadic_init2(b, N);
         qadic_init2(c, N);
@@ -50,6 +53,8 @@ main(void)
         ans1 = qadic_exp_balanced(c, b, ctx);
         ans2 = qadic_exp_balanced(b, b, ctx);
 
+        flint_set_num_threads(1);
+
         result = ((ans1 == ans2) && (!ans1 || qadic_equal(b, c)));
         if (!result)
         {
@@ -85,6 +90,8 @@ main(void)
         N   = n_randint(state, 50) + 1;
         qadic_ctx_init_conway(ctx, p, deg, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         qadic_init2(a, N);
         qadic_init2(b, N);
         qadic_init2(c, N);
@@ -103,6 +110,8 @@ main(void)
 
         ans3 = qadic_exp_balanced(g, c, ctx);
 
+        flint_set_num_threads(1);
+
         result = (!ans1 || !ans2 || (ans3 && qadic_equal(f, g)));
         if (!result)
         {
@@ -129,6 +138,53 @@ main(void)
         qadic_ctx_clear(ctx);
     }
 
+    /* Compare with rectangular at larger precision, using threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong deg, N;
+        qadic_ctx_t ctx;
+
+        qadic_t a, b, c;
+        int ans1, ans2;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        deg = n_randint(state, 4) + 1;
+        N = n_randint(state, 1000) + 100;
+        qadic_ctx_init_conway(ctx, p, deg, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        qadic_init2(a, N);
+        qadic_init2(b, N);
+        qadic_init2(c, N);
+
+        qadic_randtest_val(a, state, (*p == WORD(2)) + 1, ctx);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        ans1 = qadic_exp_balanced(b, a, ctx);
+        ans2 = qadic_exp_rectangular(c, a, ctx);
+
+        flint_set_num_threads(1);
+
+        result = (ans1 && ans2 && qadic_equal(b, c));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n\n");
+            flint_printf("N = %wd\n", N);
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            abort();
+        }
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
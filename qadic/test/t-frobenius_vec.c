@@ -0,0 +1,174 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("frobenius_vec... ");
+    fflush(stdout);
+
+    /* Compare with qadic_frobenius, with and without aliasing */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, e, k, n;
+        qadic_ctx_t ctx;
+        qadic_struct *a, *b, *c;
+        int alias;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = z_randint(state, 50) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        n = n_randint(state, 10);
+        e = z_randint(state, 20);
+        alias = n_randint(state, 2);
+
+        a = flint_malloc(n * sizeof(qadic_struct));
+        b = flint_malloc(n * sizeof(qadic_struct));
+        c = flint_malloc(n * sizeof(qadic_struct));
+
+        for (k = 0; k < n; k++)
+        {
+            slong Nk = N - (slong) n_randint(state, 5);
+
+            qadic_init2(a + k, Nk);
+            qadic_init2(b + k, Nk);
+            qadic_init2(c + k, Nk);
+
+            qadic_randtest(a + k, state, ctx);
+            qadic_frobenius(c + k, a + k, e, ctx);
+        }
+
+        if (alias)
+        {
+            for (k = 0; k < n; k++)
+                qadic_set(b + k, a + k, ctx);
+            qadic_frobenius_vec(b, b, n, e, ctx);
+        }
+        else
+        {
+            qadic_frobenius_vec(b, a, n, e, ctx);
+        }
+
+        result = 1;
+        for (k = 0; k < n && result; k++)
+            result = qadic_equal(b + k, c + k);
+
+        if (!result)
+        {
+            k--;
+            flint_printf("FAIL:\n\n");
+            flint_printf("alias = %d, e = %wd, k = %wd\n", alias, e, k);
+            flint_printf("a = "), qadic_print_pretty(a + k, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b + k, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c + k, ctx), flint_printf("\n");
+            abort();
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            qadic_clear(a + k);
+            qadic_clear(b + k);
+            qadic_clear(c + k);
+        }
+        flint_free(a);
+        flint_free(b);
+        flint_free(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    /* Reuse a precomputation of higher precision for several batches */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, e, k, r, n;
+        qadic_ctx_t ctx;
+        qadic_frobenius_precomp_t F;
+        qadic_struct *a, *b;
+        qadic_t c;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = n_randint(state, 50) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        e = z_randint(state, 20);
+        qadic_frobenius_precomp_init(F, e, N + n_randint(state, 10), ctx);
+
+        for (r = 0; r < 3; r++)
+        {
+            n = n_randint(state, 10);
+
+            a = flint_malloc(n * sizeof(qadic_struct));
+            b = flint_malloc(n * sizeof(qadic_struct));
+
+            for (k = 0; k < n; k++)
+            {
+                qadic_init2(a + k, N);
+                qadic_init2(b + k, N);
+
+                /* elements of non-negative valuation, as F->N >= N */
+                qadic_randtest_int(a + k, state, ctx);
+            }
+
+            qadic_frobenius_vec_precomp(b, a, n, F, ctx);
+
+            qadic_init2(c, N);
+            for (k = 0; k < n; k++)
+            {
+                qadic_frobenius(c, a + k, e, ctx);
+
+                result = qadic_equal(b + k, c);
+                if (!result)
+                {
+                    flint_printf("FAIL (precomp):\n\n");
+                    flint_printf("e = %wd, F->N = %wd\n", e, F->N);
+                    flint_printf("a = "), qadic_print_pretty(a + k, ctx), flint_printf("\n");
+                    flint_printf("b = "), qadic_print_pretty(b + k, ctx), flint_printf("\n");
+                    flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+                    abort();
+                }
+            }
+            qadic_clear(c);
+
+            for (k = 0; k < n; k++)
+            {
+                qadic_clear(a + k);
+                qadic_clear(b + k);
+            }
+            flint_free(a);
+            flint_free(b);
+        }
+
+        qadic_frobenius_precomp_clear(F);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
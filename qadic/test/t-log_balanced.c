@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011, 2012, 2013 Sebastian Pancratz
+    Copyright (C) 2026 FLINT contributors
 
     This file is part of FLINT.
 
@@ -44,6 +45,8 @@ main(void)
         N = n_randint(state, 50) + 1;
         qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         qadic_init2(a, N);
         qadic_init2(b, N);
 
@@ -57,6 +60,8 @@ main(void)
         ans1 = qadic_log_balanced(b, a, ctx);
         ans2 = qadic_log_balanced(a, a, ctx);
 
+        flint_set_num_threads(1);
+
         result = (ans1 == ans2) && (!ans1 || qadic_equal(a, b));
         if (!result)
         {
@@ -87,6 +92,8 @@ main(void)
         N = n_randint(state, 50) + 1;
         qadic_ctx_init_conway(ctx, p, deg, FLINT_MAX(0,N-10), FLINT_MAX(0,N+10), "a", PADIC_SERIES);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         qadic_init2(a, N);
         qadic_init2(b, N);
         qadic_init2(c, N);
@@ -117,6 +124,8 @@ main(void)
 
         qadic_log_balanced(g, c, ctx);
 
+        flint_set_num_threads(1);
+
         result = (qadic_equal(f, g));
         if (!result)
         {
@@ -158,6 +167,8 @@ main(void)
         N = n_randint(state, 50) + 1;
         qadic_ctx_init_conway(ctx, p, deg, FLINT_MAX(0,N-10), FLINT_MAX(0,N+10), "a", PADIC_SERIES);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         qadic_init2(a, N);
         qadic_init2(b, N);
         qadic_init2(c, N);
@@ -167,6 +178,8 @@ main(void)
         qadic_exp(b, a, ctx);
         qadic_log_balanced(c, b, ctx);
 
+        flint_set_num_threads(1);
+
         result = (qadic_equal(a, c));
         if (!result)
         {
@@ -185,6 +198,57 @@ main(void)
         qadic_ctx_clear(ctx);
     }
 
+    /* Compare with rectangular at larger precision, using threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong deg, N;
+        qadic_ctx_t ctx;
+
+        qadic_t a, b, c, one;
+        int ans1, ans2;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        deg = n_randint(state, 4) + 1;
+        N = n_randint(state, 1000) + 100;
+        qadic_ctx_init_conway(ctx, p, deg, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        qadic_init2(a, N);
+        qadic_init2(b, N);
+        qadic_init2(c, N);
+        qadic_init2(one, N);
+
+        qadic_randtest_val(a, state, (*p == WORD(2)) + 1, ctx);
+        qadic_one(one);
+        qadic_add(a, a, one, ctx);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        ans1 = qadic_log_balanced(b, a, ctx);
+        ans2 = qadic_log_rectangular(c, a, ctx);
+
+        flint_set_num_threads(1);
+
+        result = (ans1 && ans2 && qadic_equal(b, c));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n\n");
+            flint_printf("N = %wd\n", N);
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            abort();
+        }
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+        qadic_clear(one);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
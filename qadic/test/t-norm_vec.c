@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("norm_vec... ");
+    fflush(stdout);
+
+    /* Compare with qadic_norm */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, k, n;
+        qadic_ctx_t ctx;
+        qadic_struct *a;
+        padic_struct *x, *y;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = z_randint(state, 50) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        n = n_randint(state, 10);
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        a = flint_malloc(n * sizeof(qadic_struct));
+        x = flint_malloc(n * sizeof(padic_struct));
+        y = flint_malloc(n * sizeof(padic_struct));
+
+        for (k = 0; k < n; k++)
+        {
+            qadic_init2(a + k, N);
+            padic_init2(x + k, N);
+            padic_init2(y + k, N);
+
+            qadic_randtest(a + k, state, ctx);
+            qadic_norm(y + k, a + k, ctx);
+        }
+
+        qadic_norm_vec(x, a, n, ctx);
+
+        flint_set_num_threads(1);
+
+        result = 1;
+        for (k = 0; k < n && result; k++)
+            result = padic_equal(x + k, y + k);
+
+        if (!result)
+        {
+            k--;
+            flint_printf("FAIL:\n\n");
+            flint_printf("k = %wd\n", k);
+            flint_printf("a = "), qadic_print_pretty(a + k, ctx), flint_printf("\n");
+            flint_printf("x = "), padic_print(x + k, &ctx->pctx), flint_printf("\n");
+            flint_printf("y = "), padic_print(y + k, &ctx->pctx), flint_printf("\n");
+            abort();
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            qadic_clear(a + k);
+            padic_clear(x + k);
+            padic_clear(y + k);
+        }
+        flint_free(a);
+        flint_free(x);
+        flint_free(y);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
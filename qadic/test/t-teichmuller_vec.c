@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 FLINT contributors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("teichmuller_vec... ");
+    fflush(stdout);
+
+    /* Compare with qadic_teichmuller, with and without aliasing */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, k, n;
+        qadic_ctx_t ctx;
+        qadic_struct *a, *b, *c;
+        int alias;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = n_randint(state, 50) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        n = n_randint(state, 10);
+        alias = n_randint(state, 2);
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        a = flint_malloc(n * sizeof(qadic_struct));
+        b = flint_malloc(n * sizeof(qadic_struct));
+        c = flint_malloc(n * sizeof(qadic_struct));
+
+        for (k = 0; k < n; k++)
+        {
+            qadic_init2(a + k, N);
+            qadic_init2(b + k, N);
+            qadic_init2(c + k, N);
+
+            qadic_randtest_int(a + k, state, ctx);
+            qadic_teichmuller(c + k, a + k, ctx);
+        }
+
+        if (alias)
+        {
+            for (k = 0; k < n; k++)
+                qadic_set(b + k, a + k, ctx);
+            qadic_teichmuller_vec(b, b, n, ctx);
+        }
+        else
+        {
+            qadic_teichmuller_vec(b, a, n, ctx);
+        }
+
+        flint_set_num_threads(1);
+
+        result = 1;
+        for (k = 0; k < n && result; k++)
+            result = qadic_equal(b + k, c + k);
+
+        if (!result)
+        {
+            k--;
+            flint_printf("FAIL:\n\n");
+            flint_printf("alias = %d, k = %wd\n", alias, k);
+            flint_printf("a = "), qadic_print_pretty(a + k, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b + k, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c + k, ctx), flint_printf("\n");
+            abort();
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            qadic_clear(a + k);
+            qadic_clear(b + k);
+            qadic_clear(c + k);
+        }
+        flint_free(a);
+        flint_free(b);
+        flint_free(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -507,6 +507,18 @@ n_mulmod_shoup(mp_limb_t w, mp_limb_t t, mp_limb_t w_precomp, mp_limb_t p)
     return r;
 }
 
+/* as n_mulmod_shoup, but returns w t mod p plus either 0 or p */
+static __inline__
+mp_limb_t
+n_mulmod_shoup_lazy(mp_limb_t w, mp_limb_t t, mp_limb_t w_precomp, mp_limb_t p)
+{
+   mp_limb_t q, r;
+
+   umul_ppmm(q, r, w_precomp, t);
+
+   return w * t - q * p;
+}
+
 #ifdef __cplusplus
 }
 #endif